@@ -35,6 +35,116 @@ struct Memory
 
     /** Array representing registers. */
     static RegisterMemory<Size> data;
+
+    /** Number of reads made via register proxies, per 8-bit register. */
+    static std::uint32_t readCount[Size];
+
+    /** Number of writes made via register proxies, per 8-bit register. */
+    static std::uint32_t writeCount[Size];
+
+    /**
+     * @brief Get the number of reads made via register proxies.
+     *
+     * @param[in] reg The 8-bit register.
+     *
+     * @return The number of reads of the register.
+     */
+    static std::uint32_t reads(const std::uint8_t& reg) noexcept;
+
+    /**
+     * @brief Get the number of writes made via register proxies.
+     *
+     * @param[in] reg The 8-bit register.
+     *
+     * @return The number of writes of the register.
+     */
+    static std::uint32_t writes(const std::uint8_t& reg) noexcept;
+
+    /**
+     * @brief Reset the access counters of all registers.
+     */
+    static void resetAccessCounts() noexcept;
+};
+
+/**
+ * @brief Proxy of an 8-bit register, counting the reads and writes made through it.
+ *
+ *        Compound assignments count as one read and one write, just like the load and
+ *        store of a read-modify-write on the target.
+ */
+class Register final
+{
+public:
+    /**
+     * @brief Create a proxy of a register.
+     *
+     *        Implicit, so that registers can be returned as proxies like the references used
+     *        on the target.
+     *
+     * @param[in] reg The 8-bit register.
+     */
+    Register(std::uint8_t& reg) noexcept;
+
+    /**
+     * @brief Read the register.
+     *
+     * @return The register value.
+     */
+    operator std::uint8_t() const noexcept;
+
+    /**
+     * @brief Write the register.
+     *
+     * @param[in] value The value to write.
+     *
+     * @return Reference to the proxy.
+     */
+    Register& operator=(std::uint8_t value) noexcept;
+
+    /**
+     * @brief Set bits in the register via read-modify-write.
+     *
+     * @param[in] mask Mask of the bits to set.
+     *
+     * @return Reference to the proxy.
+     */
+    Register& operator|=(std::uint8_t mask) noexcept;
+
+    /**
+     * @brief Keep bits in the register via read-modify-write.
+     *
+     * @param[in] mask Mask of the bits to keep.
+     *
+     * @return Reference to the proxy.
+     */
+    Register& operator&=(std::uint8_t mask) noexcept;
+
+    /** Proxies are copyable, since they refer to the same register. */
+    Register(const Register&) noexcept = default;
+
+    Register()                           = delete; // No default constructor.
+    Register& operator=(const Register&) = delete; // No copy assignment.
+
+private:
+    /** Index of the register in the register memory. */
+    const std::size_t myIndex;
+};
+
+/**
+ * @brief Simulated RAM region shared by the heap and the stack, for stack diagnostics.
+ *
+ *        The heap ends at the start of the region, the stack grows down from its end.
+ */
+struct Stack
+{
+    /** Size of the region in bytes. */
+    static constexpr std::size_t Size{256U};
+
+    /** Array representing the region. */
+    static std::uint8_t data[Size];
+
+    /** Simulated stack pointer, pointing at the lowest byte used by the stack. */
+    static std::uint8_t* pointer;
 };
 
 /**
@@ -44,9 +154,22 @@ struct Memory
  */
 void executeAssemblyCmd(const std::string& cmd) noexcept;
 
+/**
+ * @brief Get the CPU time consumed by the calling thread.
+ *
+ *        Time during which the thread is preempted by the host isn't counted, just like on 
+ *        the target, where time only passes by executing code. The host time of the model is
+ *        measured this way.
+ *
+ * @return The CPU time of the calling thread in ns.
+ */
+std::uint64_t cpuTime_ns() noexcept;
+
 /**
  * @brief Generate delay in ms. 
  *
+ *        Busy-wait like the delay loops of the target, hence the delay counts as CPU time.
+ *
  * @param[in] ms The delay duration in ms.
  */
 void delay_ms(std::uint16_t ms) noexcept;
@@ -54,12 +177,19 @@ void delay_ms(std::uint16_t ms) noexcept;
 /**
  * @brief Generate delay in us. 
  *
+ *        Busy-wait like the delay loops of the target, hence the delay counts as CPU time.
+ *
  * @param[in] ms The delay duration in us.
  */
 void delay_us(std::uint16_t us) noexcept;
 
 } // namespace test
 
+/** Simulated CPU frequency measured in Hz, same as the target default. */
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
 /** Mapping of AVR registers. */
 #define SREG     test::Memory::data.reg8[0U]
 #define MCUSR    test::Memory::data.reg8[1U]
@@ -280,12 +410,35 @@ void delay_us(std::uint16_t us) noexcept;
 #define ADPS2  2U
 #define ADIF   4U
 
+#define CS00   0U
 #define CS01   1U
+#define CS02   2U
+#define CS10   0U
 #define CS11   1U
+#define CS12   2U
+#define CS20   0U
 #define CS21   1U
+#define CS22   2U
+#define WGM00  0U
+#define WGM01  1U
+#define WGM02  3U
+#define WGM10  0U
+#define WGM11  1U
 #define WGM12  3U
+#define WGM13  4U
+#define WGM20  0U
+#define WGM21  1U
+#define WGM22  3U
+#define COM0A1 7U
+#define COM0B1 5U
+#define COM1A1 7U
+#define COM1B1 5U
+#define COM2A1 7U
+#define COM2B1 5U
 #define TOIE0  0U
 #define OCIE1A 1U
+#define TOIE1  0U
+#define TOV1   0U
 #define TOIE2  0U
 
 #define UDRE0  5U
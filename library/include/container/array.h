@@ -29,31 +29,31 @@ public:
     /**
      * @brief Create empty array of given size.
      */
-    Array() noexcept;
+    constexpr Array() noexcept;
 
     /**
      * @brief Create array containing given values.
      *
      * @tparam Values Type of the given values.
      * 
-     * @param[in] values Reference to given values.
+     * @param[in] values Reference to given values. Must not exceed the array size.
      */
     template <typename... Values>
-    explicit Array(const Values&&... values) noexcept;
+    constexpr explicit Array(const Values&&... values) noexcept;
 
     /**
      * @brief Create array containing given values.
      *
      * @param[in] values Reference to given values.
      */
-    explicit Array(const T (&values)[Size]) noexcept;
+    constexpr explicit Array(const T (&values)[Size]) noexcept;
 
     /**
      * @brief Create array as a copy of another array.
      *
      * @param[in] other Reference to other array to copy from.
      */
-    Array(const Array<T, Size>& other) noexcept;
+    constexpr Array(const Array<T, Size>& other) noexcept;
 
     /**
      * @brief Move memory from another array.
@@ -62,13 +62,22 @@ public:
      *
      * @param[in] other Reference to other array to move memory from.
      */
-    Array(Array<T, Size>&& other) noexcept;
+    constexpr Array(Array<T, Size>&& other) noexcept;
 
     /**
      * @brief Delete array.
      */
     ~Array() noexcept = default;
 
+    /**
+     * @brief Copy values from another array.
+     * 
+     * @param[in] other Reference to array holding the values to copy.
+     * 
+     * @return Reference to this array.    
+     */
+    constexpr Array<T, Size>& operator=(const Array<T, Size>& other) noexcept;
+
     /**
      * @brief Copy values from another array.
      *
@@ -79,7 +88,7 @@ public:
      * @return Reference to this array.    
      */
     template <size_t ValueCount>
-    Array<T, Size>& operator=(const Array<T, ValueCount>& other) noexcept;
+    constexpr Array<T, Size>& operator=(const Array<T, ValueCount>& other) noexcept;
 
      /**
      * @brief Move values from another array.
@@ -90,7 +99,7 @@ public:
      * 
      * @return Reference to this array.    
      */
-    Array<T, Size>& operator=(Array<T, Size>&& other) noexcept;
+    constexpr Array<T, Size>& operator=(Array<T, Size>&& other) noexcept;
 
     /**
      * @brief Assign given values to array.
@@ -102,7 +111,7 @@ public:
      * @return Reference to this array.
      */
     template <size_t ValueCount>
-    Array<T, Size>& operator=(const T (&values)[ValueCount]) noexcept;
+    constexpr Array<T, Size>& operator=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Add values from another array.
@@ -114,7 +123,7 @@ public:
      * @return Reference to this array.     
      */
     template <size_t ValueCount>
-    Array& operator+=(const Array<T, ValueCount>& other) noexcept;
+    constexpr Array& operator+=(const Array<T, ValueCount>& other) noexcept;
 
     /**
      * @brief Add given values to array.
@@ -126,7 +135,7 @@ public:
      * @return Reference to this array.    
      */
     template <size_t ValueCount>
-    Array& operator+=(const T (&values)[ValueCount]) noexcept;
+    constexpr Array& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get element at given index in the array.
@@ -135,7 +144,7 @@ public:
      * 
      * @return Reference to the element at given index.
      */
-    T& operator[](size_t index) noexcept;
+    constexpr T& operator[](size_t index) noexcept;
 
     /**
      * @brief Get element at given index in the array.
@@ -144,97 +153,97 @@ public:
      * 
      * @return Reference to the element at given index.
      */
-    const T& operator[](size_t index) const noexcept;
+    constexpr const T& operator[](size_t index) const noexcept;
 
     /**
      * @brief Get data held by the array.
      *
      * @return Pointer to the data held by the array.
      */
-    T* data() noexcept;
+    constexpr T* data() noexcept;
 
     /**
      * @brief Get data held by the array.
      *
      * @return Pointer to the data held by the array.
      */
-    T* data() const noexcept;
+    constexpr const T* data() const noexcept;
 
     /**
      * @brief Get the size of the array.
      *
      * @return The size of the array measured in the number of elements it can hold.
      */
-    size_t size() const noexcept;
+    static constexpr size_t size() noexcept { return Size; }
 
      /**
      * @brief Get the beginning of the array.
      *
      * @return Iterator pointing at the beginning of the array.
      */
-    Iterator begin() noexcept;
+    constexpr Iterator begin() noexcept;
 
     /**
      * @brief Get the beginning of the array.
      *
      * @return Iterator pointing at the beginning of the array.
      */
-    ConstIterator begin() const noexcept;
+    constexpr ConstIterator begin() const noexcept;
 
     /**
      * @brief Get the end of the array.
      *
      * @return Iterator pointing at the end of the array.
      */
-    Iterator end() noexcept;
+    constexpr Iterator end() noexcept;
 
     /**
      * @brief Get the end of the array.
      *
      * @return Iterator pointing at the end of the array.
      */
-    ConstIterator end() const noexcept;
+    constexpr ConstIterator end() const noexcept;
 
     /**
      * @brief Get the reverse beginning of the array.
      *
      * @return Iterator pointing at the reverse beginning of the array.
      */
-    Iterator rbegin() noexcept;
+    constexpr Iterator rbegin() noexcept;
 
     /**
      * @brief Get the reverse beginning of the array.
      *
      * @return Iterator pointing at the reverse beginning of the array.
      */
-    ConstIterator rbegin() const noexcept;
+    constexpr ConstIterator rbegin() const noexcept;
 
     /**
      * @brief Get the reverse end of the array.
      *
      * @return Iterator pointing at the reverse end of the array.
      */
-    Iterator rend() noexcept;
+    constexpr Iterator rend() noexcept;
 
     /**
      * @brief Get the reverse end of the array.
      *
      * @return Iterator pointing at the reverse end of the array.
      */
-    ConstIterator rend() const noexcept;
+    constexpr ConstIterator rend() const noexcept;
 
     /**
      * @brief Clear array content.
      */
-    void clear() noexcept;
+    constexpr void clear() noexcept;
 
 protected:
 
     template <size_t ValueCount>
-    void copy(const T (&values)[ValueCount], size_t offset = 0U) noexcept;
+    constexpr void copy(const T (&values)[ValueCount], size_t offset = 0U) noexcept;
     
     template <size_t ValueCount>
-    void copy(const Array<T, ValueCount>& other, size_t offset = 0U) noexcept;
+    constexpr void copy(const Array<T, ValueCount>& other, size_t offset = 0U) noexcept;
 
     /** Statically-sized data field. */
     T myData[Size];
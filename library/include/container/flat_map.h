@@ -0,0 +1,210 @@
+/**
+ * @brief Implementation of sorted flat maps.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/static_vector.h"
+#include "container/vector.h"
+
+namespace container
+{
+/**
+ * @brief Key-value entry of a flat map.
+ *
+ * @tparam K The key type.
+ * @tparam V The value type.
+ */
+template <typename K, typename V>
+struct FlatMapEntry
+{
+    /** The key of the entry. */
+    K key;
+
+    /** The value of the entry. */
+    V value;
+};
+
+/**
+ * @brief Class for implementation of sorted flat maps.
+ *
+ *        The entries are stored contiguously, sorted by key. Lookups use binary search, which
+ *        makes them O(log n), while insertions and removals shift the subsequent entries and
+ *        are O(n). This suits small maps that are mostly read, such as command tables and
+ *        registries, where the contiguous storage also makes iteration cache-friendly.
+ *
+ *        Keys are compared with operator< only, two keys are considered equal if neither is
+ *        less than the other.
+ *
+ *        Use StaticFlatMap for a map with static capacity, which never allocates memory and
+ *        can be built at compile time.
+ *
+ * @tparam K       The key type. Must be comparable with operator<.
+ * @tparam V       The value type.
+ * @tparam Storage The storage holding the entries (default = Vector).
+ */
+template <typename K, typename V, typename Storage = Vector<FlatMapEntry<K, V>>>
+class FlatMap
+{
+public:
+    /** Map entry. */
+    using Entry = FlatMapEntry<K, V>;
+
+    /** Map iterator, iterates the entries in key order. */
+    using Iterator = typename Storage::Iterator;
+
+    /** Constant map iterator, iterates the entries in key order. */
+    using ConstIterator = typename Storage::ConstIterator;
+
+    /**
+     * @brief Create empty map.
+     */
+    constexpr FlatMap() noexcept;
+
+    /**
+     * @brief Create map containing given entries.
+     *
+     *        The entries don't need to be sorted. For duplicate keys, the first entry is kept.
+     *
+     * @tparam EntryCount The number of entries.
+     *
+     * @param[in] entries Reference to the entries to add.
+     */
+    template <size_t EntryCount>
+    constexpr explicit FlatMap(const Entry (&entries)[EntryCount]) noexcept;
+
+    /**
+     * @brief Delete map.
+     */
+    ~FlatMap() noexcept = default;
+
+    /**
+     * @brief Get the size of map.
+     *
+     * @return The number of entries in the map.
+     */
+    constexpr size_t size() const noexcept;
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return True if the map is empty, false otherwise.
+     */
+    constexpr bool empty() const noexcept;
+
+    /**
+     * @brief Get the beginning of map.
+     *
+     * @return Iterator pointing at the entry with the lowest key.
+     */
+    constexpr Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of map.
+     *
+     * @return Iterator pointing at the entry with the lowest key.
+     */
+    constexpr ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of map.
+     *
+     * @return Iterator pointing at the end of map.
+     */
+    constexpr Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of map.
+     *
+     * @return Iterator pointing at the end of map.
+     */
+    constexpr ConstIterator end() const noexcept;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key The key to search for.
+     *
+     * @return Pointer to the value, or nullptr if the key isn't present.
+     */
+    constexpr V* find(const K& key) noexcept;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key The key to search for.
+     *
+     * @return Pointer to the value, or nullptr if the key isn't present.
+     */
+    constexpr const V* find(const K& key) const noexcept;
+
+    /**
+     * @brief Check if the map contains given key.
+     *
+     * @param[in] key The key to search for.
+     *
+     * @return True if the key is present, false otherwise.
+     */
+    constexpr bool contains(const K& key) const noexcept;
+
+    /**
+     * @brief Insert new entry.
+     *
+     * @param[in] key   The key of the entry.
+     * @param[in] value The value of the entry.
+     *
+     * @return True if the entry was inserted, false if the key is already present or the
+     *         storage couldn't hold another entry.
+     */
+    constexpr bool insert(const K& key, const V& value) noexcept;
+
+    /**
+     * @brief Insert new entry, or assign the value of an existing entry.
+     *
+     * @param[in] key   The key of the entry.
+     * @param[in] value The value of the entry.
+     *
+     * @return True if the entry was inserted or assigned, false if the storage couldn't hold
+     *         another entry.
+     */
+    constexpr bool insertOrAssign(const K& key, const V& value) noexcept;
+
+    /**
+     * @brief Erase the entry with given key.
+     *
+     * @param[in] key The key of the entry to erase.
+     *
+     * @return True if the entry was erased, false if the key isn't present.
+     */
+    constexpr bool erase(const K& key) noexcept;
+
+    /**
+     * @brief Erase all entries.
+     */
+    constexpr void clear() noexcept;
+
+private:
+    constexpr size_t lowerBound(const K& key) const noexcept;
+    constexpr bool isMatch(size_t index, const K& key) const noexcept;
+    constexpr bool insertAt(size_t index, const Entry& entry) noexcept;
+
+    /** Storage holding the entries, sorted by key. */
+    Storage myEntries;
+};
+
+/**
+ * @brief Sorted flat map with static capacity.
+ *
+ *        The entries are stored inside the map itself, hence no memory is ever allocated.
+ *        Maps of literal key and value types can be built at compile time.
+ *
+ * @tparam K The key type. Must be comparable with operator<.
+ * @tparam V The value type. Must be default constructible.
+ * @tparam N The map capacity in number of entries. Must be greater than 0.
+ */
+template <typename K, typename V, size_t N>
+using StaticFlatMap = FlatMap<K, V, StaticVector<FlatMapEntry<K, V>, N>>;
+} // namespace container
+
+#include "impl/flat_map_impl.h"
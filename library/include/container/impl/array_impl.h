@@ -9,22 +9,22 @@ namespace container
 {
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-Array<T, Size>::Array() noexcept
+constexpr Array<T, Size>::Array() noexcept
     : myData{} {}
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <typename... Values>
-Array<T, Size>::Array(const Values&&... values) noexcept
-    : Array()
+constexpr Array<T, Size>::Array(const Values&&... values) noexcept
+    : myData{static_cast<T>(values)...}
 { 
-    const T array[sizeof...(values)] = {(values)...};
-    copy(array);
+    // Generate a compiler error if too many values are given.
+    static_assert(sizeof...(values) <= Size, "Number of values exceeds the array size!");
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-Array<T, Size>::Array(const T (&values)[Size]) noexcept
+constexpr Array<T, Size>::Array(const T (&values)[Size]) noexcept
     : Array()
 { 
     copy(values); 
@@ -32,21 +32,24 @@ Array<T, Size>::Array(const T (&values)[Size]) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-Array<T, Size>::Array(const Array<T, Size>& other) noexcept
-    : myData{other.myData} {}
+constexpr Array<T, Size>::Array(const Array<T, Size>& other) noexcept
+    : Array()
+{
+    copy(other);
+}
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-Array<T, Size>::Array(Array<T, Size>&& other) noexcept
-    : myData{other.myData}
+constexpr Array<T, Size>::Array(Array<T, Size>&& other) noexcept
+    : Array()
 {
+    copy(other);
     other.clear();
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-template <size_t ValueCount>
-Array<T, Size>& Array<T, Size>::operator=(const Array<T, ValueCount>& other) noexcept
+constexpr Array<T, Size>& Array<T, Size>::operator=(const Array<T, Size>& other) noexcept
 {
     copy(other);
     return *this;
@@ -54,17 +57,29 @@ Array<T, Size>& Array<T, Size>::operator=(const Array<T, ValueCount>& other) noe
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-Array<T, Size>& Array<T, Size>::operator=(Array<T, Size>&& other) noexcept
+template <size_t ValueCount>
+constexpr Array<T, Size>& Array<T, Size>::operator=(const Array<T, ValueCount>& other) noexcept
 {
     copy(other);
-    other.clear();
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr Array<T, Size>& Array<T, Size>::operator=(Array<T, Size>&& other) noexcept
+{
+    if (this != &other)
+    {
+        copy(other);
+        other.clear();
+    }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <size_t ValueCount>
-Array<T, Size>& Array<T, Size>::operator=(const T (&values)[ValueCount]) noexcept
+constexpr Array<T, Size>& Array<T, Size>::operator=(const T (&values)[ValueCount]) noexcept
 {
     copy(values);
     return *this;
@@ -73,7 +88,7 @@ Array<T, Size>& Array<T, Size>::operator=(const T (&values)[ValueCount]) noexcep
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <size_t ValueCount>
-Array<T, Size>& Array<T, Size>::operator+=(const Array<T, ValueCount>& other) noexcept
+constexpr Array<T, Size>& Array<T, Size>::operator+=(const Array<T, ValueCount>& other) noexcept
 {
     copy(other, ValueCount);
     return *this;
@@ -82,7 +97,7 @@ Array<T, Size>& Array<T, Size>::operator+=(const Array<T, ValueCount>& other) no
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <size_t ValueCount>
-Array<T, Size>& Array<T, Size>::operator+=(const T (&values)[ValueCount]) noexcept
+constexpr Array<T, Size>& Array<T, Size>::operator+=(const T (&values)[ValueCount]) noexcept
 {
     copy(values, ValueCount);
     return *this;
@@ -90,88 +105,90 @@ Array<T, Size>& Array<T, Size>::operator+=(const T (&values)[ValueCount]) noexce
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-T& Array<T, Size>::operator[](const size_t index) noexcept { return myData[index]; }
+constexpr T& Array<T, Size>::operator[](const size_t index) noexcept { return myData[index]; }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-const T& Array<T, Size>::operator[](const size_t index) const noexcept { return myData[index]; }
-
-// -----------------------------------------------------------------------------
-template <typename T, size_t Size>
-T* Array<T, Size>::data() noexcept { return myData; }
+constexpr const T& Array<T, Size>::operator[](const size_t index) const noexcept 
+{ 
+    return myData[index]; 
+}
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-T* Array<T, Size>::data() const noexcept{ return myData; }
+constexpr T* Array<T, Size>::data() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-size_t Array<T, Size>::size() const noexcept { return Size; }
+constexpr const T* Array<T, Size>::data() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::Iterator Array<T, Size>::begin() noexcept { return Iterator{myData}; }
+constexpr typename Array<T, Size>::Iterator Array<T, Size>::begin() noexcept 
+{ 
+    return Iterator{myData}; 
+}
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::ConstIterator Array<T, Size>::begin() const noexcept
+constexpr typename Array<T, Size>::ConstIterator Array<T, Size>::begin() const noexcept
 { 
     return ConstIterator{myData};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::Iterator Array<T, Size>::end() noexcept
+constexpr typename Array<T, Size>::Iterator Array<T, Size>::end() noexcept
 { 
     return Iterator{myData + Size}; 
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::ConstIterator Array<T, Size>::end() const noexcept
+constexpr typename Array<T, Size>::ConstIterator Array<T, Size>::end() const noexcept
 { 
     return ConstIterator{myData + Size};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::Iterator Array<T, Size>::rbegin() noexcept
+constexpr typename Array<T, Size>::Iterator Array<T, Size>::rbegin() noexcept
 { 
     return Iterator{myData + Size - 1U};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::ConstIterator Array<T, Size>::rbegin() const noexcept
+constexpr typename Array<T, Size>::ConstIterator Array<T, Size>::rbegin() const noexcept
 { 
     return ConstIterator{myData + Size - 1U};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::Iterator Array<T, Size>::rend() noexcept
+constexpr typename Array<T, Size>::Iterator Array<T, Size>::rend() noexcept
 { 
     return Iterator{myData - 1U};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-typename Array<T, Size>::ConstIterator Array<T, Size>::rend() const noexcept
+constexpr typename Array<T, Size>::ConstIterator Array<T, Size>::rend() const noexcept
 { 
     return ConstIterator{myData - 1U};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-void Array<T, Size>::clear() noexcept
+constexpr void Array<T, Size>::clear() noexcept
 {
-    for (auto& i : *this) { i = {}; }
+    for (size_t i{}; i < Size; ++i) { myData[i] = T{}; }
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <size_t ValueCount>
-void Array<T, Size>::copy(const T (&values)[ValueCount], const size_t offset) noexcept
+constexpr void Array<T, Size>::copy(const T (&values)[ValueCount], const size_t offset) noexcept
 {
     for (size_t i{}; i + offset < Size && i < ValueCount; ++i) 
     {
@@ -182,9 +199,9 @@ void Array<T, Size>::copy(const T (&values)[ValueCount], const size_t offset) no
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 template <size_t ValueCount>
-void Array<T, Size>::copy(const Array<T, ValueCount>& other, const size_t offset) noexcept
+constexpr void Array<T, Size>::copy(const Array<T, ValueCount>& other, const size_t offset) noexcept
 {
-    for (size_t i{}; i + offset < Size && i < other.Size(); ++i) 
+    for (size_t i{}; i + offset < Size && i < ValueCount; ++i) 
     {
         myData[offset + i] = other[i];
     }
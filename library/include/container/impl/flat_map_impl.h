@@ -0,0 +1,163 @@
+/**
+ * @brief Implementation details of container::FlatMap class.
+ *
+ * @note Don't include this header, use <flat_map.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr FlatMap<K, V, Storage>::FlatMap() noexcept
+    : myEntries{}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+template <size_t EntryCount>
+constexpr FlatMap<K, V, Storage>::FlatMap(const Entry (&entries)[EntryCount]) noexcept
+    : myEntries{}
+{
+    for (size_t i{}; i < EntryCount; ++i) { insert(entries[i].key, entries[i].value); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr size_t FlatMap<K, V, Storage>::size() const noexcept { return myEntries.size(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::empty() const noexcept { return 0U == myEntries.size(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr typename FlatMap<K, V, Storage>::Iterator FlatMap<K, V, Storage>::begin() noexcept
+{
+    return myEntries.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr typename FlatMap<K, V, Storage>::ConstIterator
+    FlatMap<K, V, Storage>::begin() const noexcept
+{
+    return myEntries.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr typename FlatMap<K, V, Storage>::Iterator FlatMap<K, V, Storage>::end() noexcept
+{
+    return myEntries.end();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr typename FlatMap<K, V, Storage>::ConstIterator
+    FlatMap<K, V, Storage>::end() const noexcept
+{
+    return myEntries.end();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr V* FlatMap<K, V, Storage>::find(const K& key) noexcept
+{
+    const size_t index{lowerBound(key)};
+    return isMatch(index, key) ? &myEntries[index].value : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr const V* FlatMap<K, V, Storage>::find(const K& key) const noexcept
+{
+    const size_t index{lowerBound(key)};
+    return isMatch(index, key) ? &myEntries[index].value : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::contains(const K& key) const noexcept
+{
+    return isMatch(lowerBound(key), key);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::insert(const K& key, const V& value) noexcept
+{
+    const size_t index{lowerBound(key)};
+    return isMatch(index, key) ? false : insertAt(index, Entry{key, value});
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::insertOrAssign(const K& key, const V& value) noexcept
+{
+    const size_t index{lowerBound(key)};
+    if (!isMatch(index, key)) { return insertAt(index, Entry{key, value}); }
+    myEntries[index].value = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::erase(const K& key) noexcept
+{
+    const size_t index{lowerBound(key)};
+    if (!isMatch(index, key)) { return false; }
+
+    // Shift the subsequent entries one step forward, then remove the last entry.
+    for (size_t i{index}; i + 1U < myEntries.size(); ++i)
+    {
+        myEntries[i] = utils::forward<Entry>(myEntries[i + 1U]);
+    }
+    return myEntries.popBack();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr void FlatMap<K, V, Storage>::clear() noexcept { myEntries.clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr size_t FlatMap<K, V, Storage>::lowerBound(const K& key) const noexcept
+{
+    // Find the first entry whose key isn't less than the given key.
+    size_t low{};
+    size_t high{myEntries.size()};
+
+    while (low < high)
+    {
+        const size_t middle{low + (high - low) / 2U};
+        if (myEntries[middle].key < key) { low = middle + 1U; }
+        else { high = middle; }
+    }
+    return low;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::isMatch(const size_t index, const K& key) const noexcept
+{
+    return (index < myEntries.size()) && !(key < myEntries[index].key);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Storage>
+constexpr bool FlatMap<K, V, Storage>::insertAt(const size_t index, const Entry& entry) noexcept
+{
+    // Grow the storage by one entry, then shift the subsequent entries one step back.
+    if (!myEntries.pushBack(entry)) { return false; }
+
+    for (size_t i{myEntries.size() - 1U}; i > index; --i)
+    {
+        myEntries[i] = utils::forward<Entry>(myEntries[i - 1U]);
+    }
+    myEntries[index] = entry;
+    return true;
+}
+} // namespace container
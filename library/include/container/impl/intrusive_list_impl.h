@@ -0,0 +1,267 @@
+/**
+ * @brief Implementation details of container::IntrusiveList class.
+ * 
+ * @note Don't include this header, use <intrusive_list.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename Tag>
+IntrusiveListHook<Tag>::IntrusiveListHook() noexcept
+    : myPrevious{nullptr}
+    , myNext{nullptr} {}
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+IntrusiveListHook<Tag>::IntrusiveListHook(const IntrusiveListHook&) noexcept
+    : IntrusiveListHook() {}
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+IntrusiveListHook<Tag>::~IntrusiveListHook() noexcept { unlink(); }
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+IntrusiveListHook<Tag>& IntrusiveListHook<Tag>::operator=(const IntrusiveListHook&) noexcept
+{
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+bool IntrusiveListHook<Tag>::isLinked() const noexcept { return myNext != nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+void IntrusiveListHook<Tag>::unlink() noexcept
+{
+    if (!isLinked()) { return; }
+    myPrevious->myNext = myNext;
+    myNext->myPrevious = myPrevious;
+    myPrevious         = nullptr;
+    myNext             = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Tag>
+void IntrusiveListHook<Tag>::linkBefore(IntrusiveListHook& next) noexcept
+{
+    // Nothing to do if the hook is already in place, linking before itself would unlink next.
+    if ((&next == this) || (myNext == &next)) { return; }
+    unlink();
+    myPrevious               = next.myPrevious;
+    myNext                   = &next;
+    next.myPrevious->myNext  = this;
+    next.myPrevious          = this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>::IntrusiveList() noexcept
+    : myRoot{}
+{
+    myRoot.myPrevious = &myRoot;
+    myRoot.myNext     = &myRoot;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>::~IntrusiveList() noexcept { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+bool IntrusiveList<T, Tag>::empty() const noexcept { return myRoot.myNext == &myRoot; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+size_t IntrusiveList<T, Tag>::size() const noexcept
+{
+    size_t count{};
+    for (auto hook{myRoot.myNext}; hook != &myRoot; hook = hook->myNext) { count++; }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::front() noexcept { return empty() ? nullptr : element(myRoot.myNext); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+const T* IntrusiveList<T, Tag>::front() const noexcept 
+{
+    return empty() ? nullptr : element(myRoot.myNext); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::back() noexcept { return empty() ? nullptr : element(myRoot.myPrevious); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+const T* IntrusiveList<T, Tag>::back() const noexcept 
+{
+    return empty() ? nullptr : element(myRoot.myPrevious); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::begin() noexcept
+{
+    return Iterator{myRoot.myNext};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::begin() const noexcept 
+{
+    return ConstIterator{myRoot.myNext}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::end() noexcept
+{
+    return Iterator{&myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::end() const noexcept
+{
+    return ConstIterator{&myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::rbegin() noexcept
+{
+    return Iterator{myRoot.myPrevious};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::rbegin() const noexcept 
+{
+    return ConstIterator{myRoot.myPrevious}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::rend() noexcept
+{
+    return Iterator{&myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::rend() const noexcept
+{
+    return ConstIterator{&myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::pushFront(T& element) noexcept 
+{
+    static_cast<Hook&>(element).linkBefore(*myRoot.myNext); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::pushBack(T& element) noexcept
+{
+    static_cast<Hook&>(element).linkBefore(myRoot);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::insert(Iterator& iterator, T& element) noexcept
+{
+    static_cast<Hook&>(element).linkBefore(*static_cast<Hook*>(iterator.address()));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::popFront() noexcept { return empty() ? nullptr : unlink(myRoot.myNext); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::popBack() noexcept
+{
+    return empty() ? nullptr : unlink(myRoot.myPrevious);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::remove(T& element) noexcept { static_cast<Hook&>(element).unlink(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::clear() noexcept
+{
+    while (!empty()) { unlink(myRoot.myNext); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::atomicPushFront(T& element) noexcept
+{
+    utils::InterruptGuard guard{};
+    pushFront(element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::atomicPushBack(T& element) noexcept
+{
+    utils::InterruptGuard guard{};
+    pushBack(element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::atomicPopFront() noexcept
+{
+    utils::InterruptGuard guard{};
+    return popFront();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::atomicPopBack() noexcept
+{
+    utils::InterruptGuard guard{};
+    return popBack();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::atomicRemove(T& element) noexcept
+{
+    utils::InterruptGuard guard{};
+    remove(element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::element(Hook* hook) noexcept { return static_cast<T*>(hook); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+const T* IntrusiveList<T, Tag>::element(const Hook* hook) noexcept
+{
+    return static_cast<const T*>(hook);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Tag>
+T* IntrusiveList<T, Tag>::unlink(Hook* hook) noexcept
+{
+    hook->unlink();
+    return element(hook);
+}
+} // namespace container
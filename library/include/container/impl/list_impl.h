@@ -12,197 +12,229 @@ namespace container
 /**
  * @brief Implementation of node holding data in a linked list.
  * 
- * @param[in] T The node type, i.e. the type of the stored data.
+ * @tparam T         The node type, i.e. the type of the stored data.
+ * @tparam SlabSize  The number of nodes allocated at once by the allocator.
+ * @tparam Allocator The allocator policy.
  */
-template <typename T>
-struct List<T>::Node 
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+struct List<T, SlabSize, Allocator>::Node 
 {
     Node* previous; // Pointer to previous node.
     Node* next;     // Pointer to next data.
     T data;         // Data the node holds.
 
-    static Node* create(const T& data) noexcept;
-    static void destroy(Node* self) noexcept;
     static Node* get(Iterator& iterator) noexcept;
     static const Node* get(ConstIterator& iterator) noexcept;
 };
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>::List() noexcept
     : myFirst{nullptr}
     , myLast{nullptr}
-    , mySize{nullptr} {}
+    , mySize{}
+    , myAllocator{} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const size_t size, const T& startValue) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>::List(const size_t size, const T& startValue) noexcept
     : List() 
 { 
     resize(size, startValue); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
 template <typename... Values> 
-List<T>::List(const Values&&... values) noexcept
+List<T, SlabSize, Allocator>::List(const Values&&... values) noexcept
+    : List()
 { 
     const T array[sizeof...(values)]{(values)...};
     addValues(array);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::~List() noexcept { clear(); }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>::~List() noexcept { clear(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const List<T>& other) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>::List(const List& other) noexcept
     : List()
 {
     copy(other);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(List<T>&& other) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>::List(List&& other) noexcept
     : myFirst{other.myFirst}
     , myLast{other.myLast}
     , mySize{other.mySize}
+    , myAllocator{static_cast<NodeAllocator&&>(other.myAllocator)}
 {
     other.myFirst = nullptr;
     other.myLast  = nullptr;
-    other.mySize = 0U;
+    other.mySize  = 0U;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(const List<T>& other) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>& List<T, SlabSize, Allocator>::operator=(const List& other) noexcept
 {
-    clear();
-    copy(other);
+    if (this != &other)
+    {
+        clear();
+        copy(other);
+    }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(List<T>&& other) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>& List<T, SlabSize, Allocator>::operator=(List&& other) noexcept
 {
-    clear();
-    myFirst = other.myFirst;
-    myLast  = other.myLast;
-    mySize  = other.mySize;
-
-    other.myFirst = nullptr;
-    other.myLast  = nullptr;
-    other.mySize = 0U;
+    if (this != &other)
+    {
+        clear();
+        myFirst     = other.myFirst;
+        myLast      = other.myLast;
+        mySize      = other.mySize;
+        myAllocator = static_cast<NodeAllocator&&>(other.myAllocator);
+
+        other.myFirst = nullptr;
+        other.myLast  = nullptr;
+        other.mySize  = 0U;
+    }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator+=(const List<T>& other) noexcept 
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+List<T, SlabSize, Allocator>& List<T, SlabSize, Allocator>::operator+=(const List& other) noexcept 
 { 
     copy(other); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
 template <size_t ValueCount>
-List<T>& List<T>::operator+=(const T (&values)[ValueCount]) noexcept 
+List<T, SlabSize, Allocator>& List<T, SlabSize, Allocator>::operator+=(const T (&values)[ValueCount]) noexcept 
 { 
     addValues(values); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& List<T>::operator[](Iterator& iterator) noexcept { return *iterator; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+T& List<T, SlabSize, Allocator>::operator[](Iterator& iterator) noexcept { return *iterator; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& List<T>::operator[] (ConstIterator& iterator) const noexcept { return *iterator; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+const T& List<T, SlabSize, Allocator>::operator[](ConstIterator& iterator) const noexcept 
+{ 
+    return *iterator; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t List<T>::size() const noexcept { return mySize; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+size_t List<T, SlabSize, Allocator>::size() const noexcept { return mySize; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::clear() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+void List<T, SlabSize, Allocator>::clear() noexcept
 {
     removeAllNodes();
     myFirst = nullptr;
     myLast  = nullptr;
-    mySize = 0U;
+    mySize  = 0U;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::empty() const noexcept { return mySize == 0U; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::empty() const noexcept { return mySize == 0U; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::begin() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Iterator List<T, SlabSize, Allocator>::begin() noexcept
 { 
-    return mySize > 0U ? Iterator{myFirst} : Iterator{nullptr};
+    return Iterator{myFirst};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::begin() const noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::ConstIterator List<T, SlabSize, Allocator>::begin() const noexcept
 { 
-    return mySize > 0U ? ConstIterator{myFirst} : ConstIterator{nullptr};
+    return ConstIterator{myFirst};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::end() noexcept { return Iterator{nullptr}; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Iterator List<T, SlabSize, Allocator>::end() noexcept 
+{ 
+    return Iterator{nullptr}; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::end() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::ConstIterator List<T, SlabSize, Allocator>::end() const noexcept 
+{ 
+    return ConstIterator{nullptr}; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rbegin() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Iterator List<T, SlabSize, Allocator>::rbegin() noexcept
 { 
-    return mySize > 0U ? Iterator{myLast} : Iterator{nullptr};
+    return Iterator{myLast};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rbegin() const noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::ConstIterator List<T, SlabSize, Allocator>::rbegin() const noexcept
 { 
-    return mySize > 0U ? ConstIterator{myLast} : ConstIterator{nullptr};
+    return ConstIterator{myLast};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rend() noexcept { return Iterator{nullptr}; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Iterator List<T, SlabSize, Allocator>::rend() noexcept 
+{ 
+    return Iterator{nullptr}; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rend() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::ConstIterator List<T, SlabSize, Allocator>::rend() const noexcept 
+{ 
+    return ConstIterator{nullptr}; 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::resize(const size_t newSize, const T& startValue) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::resize(const size_t newSize, const T& startValue) noexcept
 {
     while (mySize < newSize) 
     {
         if (!pushBack(startValue)) { return false; }
     }
-    while (mySize > newSize) { popFront(); }
+    while (mySize > newSize) { popBack(); }
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushFront(const T& value) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::reserve(const size_t nodeCount) noexcept
+{
+    return myAllocator.reserve(nodeCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::pushFront(const T& value) noexcept
 {
-    auto node1{Node::create(value)};
+    auto node1{createNode(value)};
     if (node1 == nullptr) { return false; }
 
     if (mySize++ == 0U) 
@@ -221,10 +253,10 @@ bool List<T>::pushFront(const T& value) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushBack(const T& value) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::pushBack(const T& value) noexcept
 {
-    auto node2{Node::create(value)};
+    auto node2{createNode(value)};
     if (node2 == nullptr) { return false; }  
 
     if (mySize++ == 0U) 
@@ -243,14 +275,17 @@ bool List<T>::pushBack(const T& value) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::insert(Iterator& iterator, const T& value) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::insert(Iterator& iterator, const T& value) noexcept
 {
-    if (iterator == nullptr) {  return false; }
-    auto node2{Node::create(value)};
-    if (node2 == nullptr) return false;   
-    auto node1{Node::get(iterator)->previous};
-    auto node3{node1->next};
+    // Place the value at the front or the back of the list if applicable.
+    auto node3{Node::get(iterator)};
+    if (node3 == nullptr) { return pushBack(value); }
+    if (node3 == myFirst) { return pushFront(value); }
+
+    auto node2{createNode(value)};
+    if (node2 == nullptr) { return false; }
+    auto node1{node3->previous};
 
     node1->next     = node2;
     node2->previous = node1;
@@ -261,8 +296,8 @@ bool List<T>::insert(Iterator& iterator, const T& value) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popFront() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+void List<T, SlabSize, Allocator>::popFront() noexcept
 {
     if (mySize <= 1U) { clear(); }
     else
@@ -270,15 +305,15 @@ void List<T>::popFront() noexcept
         auto node1{myFirst};
         auto node2{node1->next};
         node2->previous = nullptr;
-        Node::destroy(node1);
+        destroyNode(node1);
         myFirst = node2;
         mySize--;
     }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popBack() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+void List<T, SlabSize, Allocator>::popBack() noexcept
 {
     if (mySize <= 1U) { clear(); }
     else 
@@ -286,56 +321,47 @@ void List<T>::popBack() noexcept
         auto node2{myLast};
         auto node1{node2->previous};
         node1->next = nullptr;     
-        Node::destroy(node2);
+        destroyNode(node2);
         myLast = node1;
         mySize--;
     }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::remove(Iterator& iterator) noexcept
-{
-    if (iterator == nullptr) { return false; } 
-    else 
-    {
-        auto node2{iterator.get()};
-        auto node1{node2->previous};
-        auto node3{node2->next};
-        node1->next = node3;
-        node3->previous = node1;
-        Node::destroy(node2);
-        mySize--;
-        return true;
-    }
-}
-
-// -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::copy(const List<T>& other) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::remove(Iterator& iterator) noexcept
 {
-    for (size_t i{}; i < other.size(); ++i) 
-    {
-        if (!pushBack(other[i])) { return false; }
-    }
+    auto node2{Node::get(iterator)};
+    if (node2 == nullptr) { return false; } 
+    auto node1{node2->previous};
+    auto node3{node2->next};
+
+    if (node1 == nullptr) { myFirst = node3; }
+    else { node1->next = node3; }
+    if (node3 == nullptr) { myLast = node1; }
+    else { node3->previous = node1; }
+
+    destroyNode(node2);
+    mySize--;
+    iterator = Iterator{node3};
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-template <size_t ValueCount>
-void List<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+bool List<T, SlabSize, Allocator>::copy(const List& other) noexcept
 {
-    for (size_t i{}; i < ValueCount && offset + i < mySize; ++i)
+    for (const auto& value : other) 
     {
-        (*this)[offset + i] = values[i];
+        if (!pushBack(value)) { return false; }
     }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
 template <size_t ValueCount>
-bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
+bool List<T, SlabSize, Allocator>::addValues(const T (&values)[ValueCount]) noexcept
 {
     if (ValueCount == 0U) { return false; }
     for (size_t i{}; i < ValueCount; ++i)
@@ -346,44 +372,47 @@ bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::removeAllNodes() noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+void List<T, SlabSize, Allocator>::removeAllNodes() noexcept
 {
-    for (auto i{begin()}; i != end();) 
+    auto node{myFirst};
+
+    while (node != nullptr)
     {
-        auto next{Node::get(i)->next};
-        Node::destroy(Node::get(i));
-        i = next;
+        auto next{node->next};
+        destroyNode(node);
+        node = next;
     }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::create(const T& data) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Node* List<T, SlabSize, Allocator>::createNode(const T& value) noexcept
 {
-    auto self{utils::newMemory<Node>()};
-    if (self == nullptr) { return nullptr; }
-    self->data     = data;
-    self->previous = nullptr;
-    self->next     = nullptr;
-    return self;
+    auto node{myAllocator.allocate()};
+    if (node == nullptr) { return nullptr; }
+    return utils::constructAt(node, nullptr, nullptr, value);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::Node::destroy(Node* self) noexcept { utils::deleteMemory(self); }
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+void List<T, SlabSize, Allocator>::destroyNode(Node* node) noexcept
+{
+    utils::destroyAt(node);
+    myAllocator.deallocate(node);
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::get(Iterator& iterator) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+typename List<T, SlabSize, Allocator>::Node* List<T, SlabSize, Allocator>::Node::get(Iterator& iterator) noexcept
 { 
     return static_cast<Node*>(iterator.address()); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const typename List<T>::Node* List<T>::Node::get(ConstIterator& iterator) noexcept
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+const typename List<T, SlabSize, Allocator>::Node* List<T, SlabSize, Allocator>::Node::get(ConstIterator& iterator) noexcept
 {
-    return static_cast<Node*>(iterator.address());
+    return static_cast<const Node*>(iterator.address());
 }
 } // namespace container
@@ -0,0 +1,124 @@
+/**
+ * @brief Implementation details of fixed-capacity lock-free ring buffers.
+ *
+ * @note Don't include this header, use <ring_buffer.h> instead!
+ */
+#pragma once
+
+#include <string.h>
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+RingBuffer<T, N>::RingBuffer() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::size() const noexcept
+{
+    const Index tail{utils::atomicLoad(myTail)};
+    return static_cast<Index>(utils::atomicLoad(myHead) - tail);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::empty() const noexcept { return size() == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::full() const noexcept { return size() == N; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::push(const T& value) noexcept
+{
+    // The head is only modified by the producer, hence no atomic load is required.
+    const Index head{myHead};
+    if (static_cast<Index>(head - utils::atomicLoad(myTail)) == N) { return false; }
+    myData[head & Mask] = value;
+    utils::atomicStore(myHead, static_cast<Index>(head + 1U));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::push(const T* values, size_t count) noexcept
+{
+    const Index head{myHead};
+    const size_t available{N - static_cast<Index>(head - utils::atomicLoad(myTail))};
+    if (count > available) { count = available; }
+
+    const size_t start{static_cast<size_t>(head & Mask)};
+    const size_t first{(count < N - start) ? count : N - start};
+    copy(myData + start, values, first);
+    copy(myData, values + first, count - first);
+    utils::atomicStore(myHead, static_cast<Index>(head + count));
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::pop(T& value) noexcept
+{
+    // The tail is only modified by the consumer, hence no atomic load is required.
+    const Index tail{myTail};
+    if (utils::atomicLoad(myHead) == tail) { return false; }
+    value = myData[tail & Mask];
+    utils::atomicStore(myTail, static_cast<Index>(tail + 1U));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::pop(T* values, size_t count) noexcept
+{
+    const Index tail{myTail};
+    const size_t available{static_cast<Index>(utils::atomicLoad(myHead) - tail)};
+    if (count > available) { count = available; }
+
+    const size_t start{static_cast<size_t>(tail & Mask)};
+    const size_t first{(count < N - start) ? count : N - start};
+    copy(values, myData + start, first);
+    copy(values + first, myData, count - first);
+    utils::atomicStore(myTail, static_cast<Index>(tail + count));
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::peek(T& value) const noexcept
+{
+    const Index tail{myTail};
+    if (utils::atomicLoad(myHead) == tail) { return false; }
+    value = myData[tail & Mask];
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void RingBuffer<T, N>::clear() noexcept
+{
+    utils::atomicStore(myTail, utils::atomicLoad(myHead));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void RingBuffer<T, N>::copy(T* destination, const T* source, const size_t count) noexcept
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (count > 0U) { memcpy(destination, source, count * sizeof(T)); }
+    }
+    else
+    {
+        for (size_t i{}; i < count; ++i) { destination[i] = source[i]; }
+    }
+}
+} // namespace container
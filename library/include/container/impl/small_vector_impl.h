@@ -0,0 +1,137 @@
+/**
+ * @brief Implementation details of container::SmallVector class.
+ * 
+ * @note Don't include this header, use <small_vector.h> instead!
+ */
+#pragma once 
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector() noexcept
+    : Vector<T>{inlineData(), N} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const size_t size) noexcept
+    : SmallVector()
+{
+    this->resize(size);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+SmallVector<T, N>::SmallVector(const Values&&... values) noexcept
+    : SmallVector()
+{
+    const T array[sizeof...(values)]{(values)...};
+    this->addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const Vector<T>& other) noexcept
+    : SmallVector()
+{
+    this->copy(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const SmallVector& other) noexcept
+    : SmallVector()
+{
+    this->copy(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(Vector<T>&& other) noexcept
+    : SmallVector()
+{
+    this->moveFrom(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept
+    : SmallVector()
+{
+    this->moveFrom(other);
+    other.clear();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(const Vector<T>& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        this->copy(other);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other) noexcept
+{
+    return operator=(static_cast<const Vector<T>&>(other));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(Vector<T>&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        this->moveFrom(other);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        operator=(static_cast<Vector<T>&&>(other));
+        other.clear();
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::isInline() const noexcept { return this->usesInlineData(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::clear() noexcept
+{
+    Vector<T>::clear();
+    if (!isInline()) { this->useInlineData(inlineData(), N); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::shrinkToFit() noexcept
+{
+    // Move the content back to the inline storage when it fits.
+    if (!isInline() && (this->mySize <= N))
+    {
+        this->useInlineData(inlineData(), N);
+        return true;
+    }
+    return Vector<T>::shrinkToFit();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::inlineData() noexcept { return reinterpret_cast<T*>(myBuffer); }
+} // namespace container
@@ -0,0 +1,241 @@
+/**
+ * @brief Implementation details of container::StaticVector class.
+ *
+ * @note Don't include this header, use <static_vector.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector() noexcept
+    : myData{}
+    , mySize{}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(const size_t size) noexcept
+    : myData{}
+    , mySize{size < N ? size : N}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+constexpr StaticVector<T, N>::StaticVector(const Values&&... values) noexcept
+    : myData{static_cast<T>(values)...}
+    , mySize{sizeof...(values)}
+{
+    // Generate a compiler error if too many values are given.
+    static_assert(sizeof...(values) <= N, "Number of values exceeds the vector capacity!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::operator[](const size_t index) noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr const T& StaticVector<T, N>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr T* StaticVector<T, N>::data() noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr const T* StaticVector<T, N>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr size_t StaticVector<T, N>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::empty() const noexcept { return 0U == mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::full() const noexcept { return N == mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::Iterator StaticVector<T, N>::begin() noexcept
+{
+    return Iterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::begin() const noexcept
+{
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::Iterator StaticVector<T, N>::end() noexcept
+{
+    return Iterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::end() const noexcept
+{
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::Iterator StaticVector<T, N>::rbegin() noexcept
+{
+    return mySize > 0U ? Iterator{myData + mySize - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::rbegin() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData + mySize - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::Iterator StaticVector<T, N>::rend() noexcept
+{
+    return mySize > 0U ? Iterator{myData - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::rend() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr T* StaticVector<T, N>::last() noexcept
+{
+    return mySize > 0U ? myData + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr const T* StaticVector<T, N>::last() const noexcept
+{
+    return mySize > 0U ? myData + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::clear() noexcept { resize(0U); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::resize(const size_t newSize) noexcept
+{
+    if (newSize > N) { return false; }
+
+    // Reset removed elements so that any resources they hold are released.
+    for (size_t i{newSize}; i < mySize; ++i) { myData[i] = T{}; }
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::pushBack(const T& value) noexcept
+{
+    if (full()) { return false; }
+    myData[mySize++] = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::pushBack(T&& value) noexcept
+{
+    if (full()) { return false; }
+    myData[mySize++] = utils::forward<T>(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Args>
+constexpr bool StaticVector<T, N>::emplaceBack(Args&&... args) noexcept
+{
+    if (full()) { return false; }
+    myData[mySize++] = T{utils::forward<Args>(args)...};
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::popBack() noexcept
+{
+    return empty() ? false : resize(mySize - 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::insert(const size_t index, const T& value) noexcept
+{
+    if (full() || (index > mySize)) { return false; }
+
+    // Copy the value first in case it refers to an element of this vector.
+    T copy{value};
+
+    for (size_t i{mySize}; i > index; --i) { myData[i] = utils::forward<T>(myData[i - 1U]); }
+    myData[index] = utils::forward<T>(copy);
+    ++mySize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::insert(const Iterator& iterator, const T& value) noexcept
+{
+    return insert(indexOf(iterator), value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::erase(const size_t index) noexcept
+{
+    if (index >= mySize) { return false; }
+
+    for (size_t i{index}; i + 1U < mySize; ++i) { myData[i] = utils::forward<T>(myData[i + 1U]); }
+    return resize(mySize - 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr bool StaticVector<T, N>::erase(const Iterator& iterator) noexcept
+{
+    return erase(indexOf(iterator));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+constexpr size_t StaticVector<T, N>::indexOf(const Iterator& iterator) noexcept
+{
+    // Compare the iterator against each position, pointer subtraction isn't available for
+    // iterators. Return an invalid index if the iterator doesn't point into this vector.
+    for (size_t i{}; i <= mySize; ++i)
+    {
+        if (Iterator{myData + i} == iterator) { return i; }
+    }
+    return N + 1U;
+}
+} // namespace container
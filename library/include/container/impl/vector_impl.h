@@ -5,6 +5,8 @@
  */
 #pragma once 
 
+#include <string.h>
+
 #include "utils/utils.h"
 
 namespace container
@@ -13,7 +15,8 @@ namespace container
 template <typename T>
 Vector<T>::Vector() noexcept
     : myData{nullptr}
-    , mySize{} {}
+    , mySize{}
+    , myCapacity{} {}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -46,10 +49,7 @@ template <typename T>
 Vector<T>::Vector(Vector&& other) noexcept
     : Vector()
 {
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    moveFrom(other);
 }
 
 // -----------------------------------------------------------------------------
@@ -63,8 +63,11 @@ Vector<T>::~Vector() noexcept
 template <typename T>
 Vector<T>& Vector<T>::operator=(const Vector<T>& other) noexcept
 {
-    clear();
-    copy(other);
+    if (this != &other)
+    {
+        clear();
+        copy(other);
+    }
     return *this;
 }
 
@@ -72,11 +75,11 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& other) noexcept
 template <typename T>
 Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept
 {
-    clear();
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    if (this != &other)
+    {
+        clear();
+        moveFrom(other);
+    }
     return *this;
 }
 
@@ -129,6 +132,10 @@ const T* Vector<T>::data() const noexcept { return myData; }
 template <typename T>
 size_t Vector<T>::size() const noexcept { return mySize; }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t Vector<T>::capacity() const noexcept { return myCapacity & ~InlineFlag; }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::empty() const noexcept { return mySize == 0U; }
@@ -188,94 +195,181 @@ typename Vector<T>::ConstIterator Vector<T>::rend() const noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-T* Vector<T>::last() noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+T* Vector<T>::last() noexcept { return mySize > 0U ? myData + mySize - 1U : nullptr; }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-const T* Vector<T>::last() const noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+const T* Vector<T>::last() const noexcept 
+{ 
+    return mySize > 0U ? myData + mySize - 1U : nullptr; 
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void Vector<T>::clear() noexcept 
 {
-    utils::deleteMemory<T>(myData);
-    myData = nullptr;
+    // Inline storage is kept, since it isn't owned by the vector.
+    destroy(0U, mySize);
     mySize = 0U;
+    if (usesInlineData()) { return; }
+    utils::deleteMemory<T>(myData);
+    myData     = nullptr;
+    myCapacity = 0U;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::resize(const size_t newSize) noexcept 
 {
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
-    if (copy == nullptr) { return false; }
-    myData = copy;
+    if (newSize < mySize) 
+    { 
+        destroy(newSize, mySize); 
+    }
+    else
+    {
+        if (!reserve(newSize)) { return false; }
+        for (size_t i{mySize}; i < newSize; ++i) { utils::constructAt(myData + i); }
+    }
     mySize = newSize;
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::pushBack(const T& value) noexcept 
+bool Vector<T>::reserve(const size_t newCapacity) noexcept 
 {
-    if (!resize(mySize + 1U)) { return false; }
-    myData[mySize - 1U] = value;
-    return true;
+    return newCapacity <= capacity() ? true : reallocate(newCapacity);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::popBack() noexcept 
+bool Vector<T>::shrinkToFit() noexcept 
 {
-    if (mySize <= 1U) 
+    if ((mySize == myCapacity) || usesInlineData()) { return true; }
+
+    // Release the memory of empty vectors rather than reallocating it.
+    if (mySize == 0U)
     {
         clear();
         return true;
-    } 
-    else 
-    {
-        return resize(mySize - 1U);
     }
+    return reallocate(mySize);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::copy(const Vector<T>& other) noexcept 
+bool Vector<T>::pushBack(const T& value) noexcept { return emplaceBack(value); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::pushBack(T&& value) noexcept 
+{ 
+    return emplaceBack(utils::forward<T>(value)); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename... Args>
+bool Vector<T>::emplaceBack(Args&&... args) noexcept 
 {
-    if (!resize(other.mySize)) { return false; }
-    assign(other);
+    if (mySize < capacity())
+    {
+        utils::constructAt(myData + mySize++, utils::forward<Args>(args)...);
+        return true;
+    }
+
+    // The arguments may refer to elements of this vector, hence they must be used before 
+    // the current elements are released.
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        const T value{utils::forward<Args>(args)...};
+        if (!reallocate(nextCapacity())) { return false; }
+        utils::constructAt(myData + mySize++, value);
+    }
+    else
+    {
+        const auto newCapacity{nextCapacity()};
+        auto block{utils::newMemory<T>(newCapacity)};
+        if (block == nullptr) { return false; }
+        utils::constructAt(block + mySize, utils::forward<Args>(args)...);
+        relocate(block, myData, mySize);
+        if (!usesInlineData()) { utils::deleteMemory<T>(myData); }
+        myData     = block;
+        myCapacity = newCapacity;
+        mySize++;
+    }
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-void Vector<T>::assign(const Vector<T>& other, const size_t offset) noexcept 
+bool Vector<T>::popBack() noexcept 
 {
-    for (size_t i{}; offset + i < mySize && i < other.mySize; ++i) 
-    {
-        myData[offset + i] = other.myData[i];
+    if (mySize > 0U) 
+    { 
+        mySize--; 
+        destroy(mySize, mySize + 1U);
     }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-template <size_t ValueCount>
-void Vector<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept 
+Vector<T>::Vector(T* inlineData, const size_t inlineCapacity) noexcept
+    : myData{inlineData}
+    , mySize{}
+    , myCapacity{inlineCapacity | InlineFlag} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::usesInlineData() const noexcept { return (myCapacity & InlineFlag) != 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::useInlineData(T* inlineData, const size_t inlineCapacity) noexcept
+{
+    // The content is moved to the inline storage, which must be able to hold it.
+    relocate(inlineData, myData, mySize);
+    if (!usesInlineData()) { utils::deleteMemory<T>(myData); }
+    myData     = inlineData;
+    myCapacity = inlineCapacity | InlineFlag;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::moveFrom(Vector<T>& other) noexcept
 {
-    for (size_t i{}; i < ValueCount && offset + i < mySize; ++i) 
+    // Inline storage cannot be taken over, move the elements one by one instead.
+    if (other.usesInlineData())
     {
-        myData[offset + i] = values[i];
+        if (!reserve(other.mySize)) { return; }
+        relocate(myData, other.myData, other.mySize);
+        mySize       = other.mySize;
+        other.mySize = 0U;
+        return;
     }
+
+    // Take over the allocated memory, the other vector is left without memory.
+    myData           = other.myData;
+    mySize           = other.mySize;
+    myCapacity       = other.myCapacity;
+    other.myData     = nullptr;
+    other.mySize     = 0U;
+    other.myCapacity = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::copy(const Vector<T>& other) noexcept 
+{
+    return addValues(other.myData, other.mySize);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::addValues(const Vector<T>& other) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + other.mySize)) { return false; }
-    assign(other, offset);
-    return true;
+    return addValues(other.myData, other.mySize);
 }
 
 // -----------------------------------------------------------------------------
@@ -283,9 +377,96 @@ template <typename T>
 template <size_t ValueCount>
 bool Vector<T>::addValues(const T (&values)[ValueCount]) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + ValueCount)) { return false; }
-    assign(values, offset);
+    return addValues(values, ValueCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::addValues(const T* values, const size_t count) noexcept 
+{
+    // Reserve memory for the new values, which may be stored in this vector.
+    if (count == 0U) { return true; }
+    const bool ownValues{(mySize > 0U) && (values >= myData) && (values < myData + mySize)};
+    const auto offset{ownValues ? static_cast<size_t>(values - myData) : 0U};
+    if (!reserve(mySize + count)) { return false; }
+    if (ownValues) { values = myData + offset; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memcpy(myData + mySize, values, sizeof(T) * count);
+    }
+    else
+    {
+        for (size_t i{}; i < count; ++i) { utils::constructAt(myData + mySize + i, values[i]); }
+    }
+    mySize += count;
     return true;
 }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::reallocate(const size_t newCapacity) noexcept 
+{
+    // Trivially copyable elements on the heap are moved by the allocator.
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (!usesInlineData())
+        {
+            auto copy{utils::reallocMemory<T>(myData, newCapacity)};
+            if (copy == nullptr) { return false; }
+            myData     = copy;
+            myCapacity = newCapacity;
+            return true;
+        }
+    }
+
+    // Move the elements to a new block otherwise.
+    auto block{utils::newMemory<T>(newCapacity)};
+    if (block == nullptr) { return false; }
+    relocate(block, myData, mySize);
+    if (!usesInlineData()) { utils::deleteMemory<T>(myData); }
+    myData     = block;
+    myCapacity = newCapacity;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t Vector<T>::nextCapacity() const noexcept 
+{
+    // Double the capacity, fall back on linear growth if doubling would overflow.
+    constexpr auto maxCapacity{~InlineFlag / sizeof(T)};
+    const auto current{capacity()};
+    if (current == 0U) { return 1U; }
+    return current <= maxCapacity / 2U ? 2U * current : current + 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::destroy(const size_t start, const size_t end) noexcept 
+{
+    if constexpr (!type_traits::is_trivially_destructible<T>::value)
+    {
+        for (size_t i{start}; i < end; ++i) { utils::destroyAt(myData + i); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::relocate(T* destination, T* source, const size_t count) noexcept 
+{
+    // Copy trivially copyable elements as raw memory, move the elements one by one otherwise.
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (count > 0U) { memcpy(destination, source, sizeof(T) * count); }
+    }
+    else
+    {
+        for (size_t i{}; i < count; ++i)
+        {
+            utils::constructAt(destination + i, utils::forward<T>(source[i]));
+            utils::destroyAt(source + i);
+        }
+    }
+}
 } // namespace container
@@ -0,0 +1,324 @@
+/**
+ * @brief Implementation of intrusive doubly linked lists.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace container
+{
+template <typename T, typename Tag>
+class IntrusiveList;
+
+/**
+ * @brief Hook linking an object into an intrusive list.
+ *
+ *        Derive from this class to make objects linkable. The object is automatically unlinked
+ *        when deleted. Copies of the object are created unlinked. Use different tags to link
+ *        the same object into several lists at once.
+ *
+ * @tparam Tag Tag identifying the hook (default = void).
+ */
+template <typename Tag = void>
+class IntrusiveListHook
+{
+public:
+    /**
+     * @brief Create unlinked hook.
+     */
+    IntrusiveListHook() noexcept;
+
+    /**
+     * @brief Create unlinked hook, the links of the other hook are not copied.
+     */
+    IntrusiveListHook(const IntrusiveListHook&) noexcept;
+
+    /**
+     * @brief Unlink the hook before deletion.
+     */
+    ~IntrusiveListHook() noexcept;
+
+    /**
+     * @brief Keep the links of the hook, the links of the other hook are not copied.
+     *
+     * @return Reference to this hook.
+     */
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept;
+
+    /**
+     * @brief Check if the hook is linked into a list.
+     *
+     * @return True if the hook is linked, false otherwise.
+     */
+    bool isLinked() const noexcept;
+
+    /**
+     * @brief Unlink the hook from its list in O(1).
+     *
+     *        Nothing is done if the hook isn't linked.
+     *
+     * @note Use IntrusiveList::atomicRemove() if the list is modified in interrupt context.
+     */
+    void unlink() noexcept;
+
+private:
+    template <typename, typename>
+    friend class IntrusiveList;
+
+    void linkBefore(IntrusiveListHook& next) noexcept;
+
+    /** Pointer to the previous hook in the list. */
+    IntrusiveListHook* myPrevious;
+
+    /** Pointer to the next hook in the list. */
+    IntrusiveListHook* myNext;
+};
+
+/**
+ * @brief Class for implementation of intrusive doubly linked lists.
+ *
+ *        The links are stored in the elements themselves, which must derive from
+ *        IntrusiveListHook<Tag>. The list never allocates memory and never copies the elements,
+ *        which must outlive their membership in the list.
+ *
+ *        The list is circular with the list itself acting as the end node, hence elements can
+ *        be unlinked in O(1) without access to the list. As a consequence, size() is O(n).
+ *
+ *        The atomic variants of the modifiers disable interrupts while the links are updated.
+ *        Use them outside interrupt context for lists also modified by interrupt handlers.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T   The element type. Must derive from IntrusiveListHook<Tag>.
+ * @tparam Tag Tag identifying the hook to use (default = void).
+ */
+template <typename T, typename Tag = void>
+class IntrusiveList
+{
+public:
+    /** List iterator. */
+    class Iterator;
+
+    /** Constant list iterator. */
+    class ConstIterator;
+
+    /** Hook type linking the elements. */
+    using Hook = IntrusiveListHook<Tag>;
+
+    /**
+     * @brief Create empty list.
+     */
+    IntrusiveList() noexcept;
+
+    /**
+     * @brief Unlink all elements before deletion.
+     */
+    ~IntrusiveList() noexcept;
+
+    /**
+     * @brief Check if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the size of list.
+     *
+     * @note The elements are counted, which makes this operation O(n).
+     *
+     * @return The size of list in the number of elements it holds.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the first element of the list.
+     *
+     * @return Pointer to the first element, or nullptr if the list is empty.
+     */
+    T* front() noexcept;
+
+    /**
+     * @brief Get the first element of the list.
+     *
+     * @return Pointer to the first element, or nullptr if the list is empty.
+     */
+    const T* front() const noexcept;
+
+    /**
+     * @brief Get the last element of the list.
+     *
+     * @return Pointer to the last element, or nullptr if the list is empty.
+     */
+    T* back() noexcept;
+
+    /**
+     * @brief Get the last element of the list.
+     *
+     * @return Pointer to the last element, or nullptr if the list is empty.
+     */
+    const T* back() const noexcept;
+
+    /**
+     * @brief Get the beginning of list.
+     *
+     * @return Iterator pointing at the beginning of list.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of list.
+     *
+     * @return Iterator pointing at the beginning of list.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of list.
+     *
+     * @return Iterator pointing at the end of list.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of list.
+     *
+     * @return Iterator pointing at the end of list.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the reverse beginning of list.
+     *
+     * @return Iterator pointing at the reverse beginning of list.
+     */
+    Iterator rbegin() noexcept;
+
+    /**
+     * @brief Get the reverse beginning of list.
+     *
+     * @return Iterator pointing at the reverse beginning of list.
+     */
+    ConstIterator rbegin() const noexcept;
+
+    /**
+     * @brief Get the reverse end of list.
+     *
+     * @return Iterator pointing at the reverse end of list.
+     */
+    Iterator rend() noexcept;
+
+    /**
+     * @brief Get the reverse end of list.
+     *
+     * @return Iterator pointing at the reverse end of list.
+     */
+    ConstIterator rend() const noexcept;
+
+    /**
+     * @brief Link element at the front of list.
+     *
+     *        An element already linked into a list is moved.
+     *
+     * @param[in] element Reference to the element to link.
+     */
+    void pushFront(T& element) noexcept;
+
+    /**
+     * @brief Link element at the back of list.
+     *
+     *        An element already linked into a list is moved.
+     *
+     * @param[in] element Reference to the element to link.
+     */
+    void pushBack(T& element) noexcept;
+
+    /**
+     * @brief Link element at given position in the list.
+     *
+     *        The element is placed in front of the element the iterator is pointing at.
+     *        An element already linked into a list is moved.
+     *
+     * @param[in] iterator Reference to iterator pointing at the location to place the element.
+     * @param[in] element  Reference to the element to link.
+     */
+    void insert(Iterator& iterator, T& element) noexcept;
+
+    /**
+     * @brief Unlink the element at the front of list.
+     *
+     * @return Pointer to the unlinked element, or nullptr if the list is empty.
+     */
+    T* popFront() noexcept;
+
+    /**
+     * @brief Unlink the element at the back of list.
+     *
+     * @return Pointer to the unlinked element, or nullptr if the list is empty.
+     */
+    T* popBack() noexcept;
+
+    /**
+     * @brief Unlink given element from the list in O(1).
+     *
+     * @param[in] element Reference to the element to unlink.
+     */
+    void remove(T& element) noexcept;
+
+    /**
+     * @brief Unlink all elements.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Link element at the front of list with interrupts disabled.
+     *
+     * @param[in] element Reference to the element to link.
+     */
+    void atomicPushFront(T& element) noexcept;
+
+    /**
+     * @brief Link element at the back of list with interrupts disabled.
+     *
+     * @param[in] element Reference to the element to link.
+     */
+    void atomicPushBack(T& element) noexcept;
+
+    /**
+     * @brief Unlink the element at the front of list with interrupts disabled.
+     *
+     * @return Pointer to the unlinked element, or nullptr if the list is empty.
+     */
+    T* atomicPopFront() noexcept;
+
+    /**
+     * @brief Unlink the element at the back of list with interrupts disabled.
+     *
+     * @return Pointer to the unlinked element, or nullptr if the list is empty.
+     */
+    T* atomicPopBack() noexcept;
+
+    /**
+     * @brief Unlink given element from the list with interrupts disabled.
+     *
+     * @param[in] element Reference to the element to unlink.
+     */
+    void atomicRemove(T& element) noexcept;
+
+    IntrusiveList(const IntrusiveList&)            = delete; // No copy constructor.
+    IntrusiveList(IntrusiveList&&)                 = delete; // No move constructor.
+    IntrusiveList& operator=(const IntrusiveList&) = delete; // No copy assignment.
+    IntrusiveList& operator=(IntrusiveList&&)      = delete; // No move assignment.
+
+private:
+    static T* element(Hook* hook) noexcept;
+    static const T* element(const Hook* hook) noexcept;
+    T* unlink(Hook* hook) noexcept;
+
+    /** Hook acting as both the beginning and the end of the list. */
+    Hook myRoot;
+};
+} // namespace container
+
+#include "impl/intrusive_list_impl.h"
+#include "iterator/intrusive_list_iterator.h"
@@ -23,7 +23,7 @@ public:
     /**
      * @brief Create empty iterator.
      */
-    explicit Iterator() noexcept
+    constexpr explicit Iterator() noexcept
         : myData{nullptr} {}
 
     /**
@@ -31,7 +31,7 @@ public:
      *
      * @param[in] data Reference to data the iterator is set to point at.
      */
-    Iterator(T& data) noexcept
+    constexpr Iterator(T& data) noexcept
         : myData{&data} {}
 
     /**
@@ -39,7 +39,7 @@ public:
      *
      * @param[in] data Pointer to data the iterator is set to point at.
      */
-    Iterator(T* data) noexcept
+    constexpr Iterator(T* data) noexcept
         : myData{data} {}
 
     /**
@@ -52,7 +52,7 @@ public:
      * 
      * @param[in] other Reference to iterator to copy.
      */
-    Iterator(const Iterator& other) noexcept
+    constexpr Iterator(const Iterator& other) noexcept
         : myData{other.myData} {}
 
     /**
@@ -62,7 +62,7 @@ public:
      * 
      * @param[in] other Reference to iterator to move resources from.
      */
-    Iterator(Iterator&& other) noexcept
+    constexpr Iterator(Iterator&& other) noexcept
         : myData{other.myData} { other.myData = nullptr; }
 
     /**
@@ -72,7 +72,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    Iterator& operator=(const Iterator& other) noexcept 
+    constexpr Iterator& operator=(const Iterator& other) noexcept 
     { 
         if (this != &other) { myData = other.myData; }
         return *this;
@@ -87,7 +87,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    Iterator& operator=(Iterator&& other) noexcept
+    constexpr Iterator& operator=(Iterator&& other) noexcept
     {
         if (this != &other)
         {
@@ -102,7 +102,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    Iterator& operator++() noexcept 
+    constexpr Iterator& operator++() noexcept 
     { 
         ++myData; 
         return *this;
@@ -113,7 +113,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    Iterator& operator--() noexcept 
+    constexpr Iterator& operator--() noexcept 
     { 
         --myData; 
         return *this;
@@ -124,7 +124,7 @@ public:
      *
      * @return The previous state of this iterator.
      */
-    Iterator operator++(int) noexcept 
+    constexpr Iterator operator++(int) noexcept 
     { 
         auto previous{*this};
         ++myData;
@@ -136,7 +136,7 @@ public:
      *
      * @return The previous state of this iterator.
      */
-    Iterator operator--(int) noexcept 
+    constexpr Iterator operator--(int) noexcept 
     { 
         auto previous{*this};
         --myData; 
@@ -148,7 +148,7 @@ public:
      *
      * @param[in] incrementCount The number of times the iterator will be incremented.
      */
-    void operator+=(const size_t incrementCount) noexcept
+    constexpr void operator+=(const size_t incrementCount) noexcept
     {
         for (size_t i{}; i < incrementCount; ++i) { ++myData; }
     }
@@ -158,7 +158,7 @@ public:
      *
      * @param[in] decrementCount The number of times the iterator will be decremented.
      */
-    void operator-=(const size_t decrementCount) noexcept
+    constexpr void operator-=(const size_t decrementCount) noexcept
     {
         for (size_t i{}; i < decrementCount; ++i) { --myData; }
     }
@@ -170,7 +170,10 @@ public:
      * 
      * @return True if the iterators point at the same address, false otherwise.
      */
-    bool operator==(const Iterator& other) const noexcept { return myData == other.myData; }
+    constexpr bool operator==(const Iterator& other) const noexcept
+    {
+        return myData == other.myData;
+    }
 
     /**
      * @brief Check if the iterator and referenced other iterator point at different addresses.
@@ -179,7 +182,10 @@ public:
      * 
      * @return True if the iterators point at the different addresses, false otherwise.
      */
-    bool operator!=(const Iterator& other) const noexcept { return myData != other.myData; }
+    constexpr bool operator!=(const Iterator& other) const noexcept
+    {
+        return myData != other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's higher than
@@ -190,7 +196,10 @@ public:
      * @return True if iterator points at an address that's higher than the address
      *         pointed to by referenced other iterator, false otherwise.
      */
-    bool operator>(const Iterator& other) const noexcept { return myData > other.myData; }
+    constexpr bool operator>(const Iterator& other) const noexcept
+    {
+        return myData > other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's lower than
@@ -201,7 +210,10 @@ public:
      * @return True if iterator points at an address that's lower than the address
      *         pointed to by referenced other iterator, false otherwise.
      */
-    bool operator<(const Iterator& other) const noexcept { return myData < other.myData; }
+    constexpr bool operator<(const Iterator& other) const noexcept
+    {
+        return myData < other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's higher or equal
@@ -212,7 +224,10 @@ public:
      * @return True if iterator points at an address that's higher or equal to the
      *         address pointed to by referenced other iterator, false otherwise.
      */
-    bool operator>=(const Iterator& other) const noexcept { return myData >= other.myData; }
+    constexpr bool operator>=(const Iterator& other) const noexcept
+    {
+        return myData >= other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's lower or equal
@@ -223,21 +238,24 @@ public:
      * @return True if iterator points at an address that's lower or equal to the
      *         address pointed to by referenced other iterator, false otherwise.
      */
-    bool operator<=(const Iterator& other) const noexcept { return myData <= other.myData; }
+    constexpr bool operator<=(const Iterator& other) const noexcept
+    {
+        return myData <= other.myData;
+    }
 
     /**
      * @brief Get the value stored at the address the iterator is pointing at.
      *
      * @return Reference to the value at the address the iterator is pointing at.
      */
-    T& operator*() noexcept { return *myData; }
+    constexpr T& operator*() noexcept { return *myData; }
 
     /**
      * @brief Get the value stored at the address the iterator is pointing at.
      *
      * @return Reference to the value at the address the iterator is pointing at.
      */
-    const T& operator*() const noexcept { return *myData; }
+    constexpr const T& operator*() const noexcept { return *myData; }
 
 private:
     T* myData; // Pointer to the data this iterator is referring to.
@@ -258,7 +276,7 @@ public:
     /**
      * @brief Create empty iterator.
      */
-    ConstIterator() noexcept
+    constexpr ConstIterator() noexcept
         : myData{nullptr} {}
 
     /**
@@ -266,7 +284,7 @@ public:
      *
      * @param[in] data Reference to data the iterator is set to point at.
      */
-    ConstIterator(const T& data) noexcept
+    constexpr ConstIterator(const T& data) noexcept
         : myData{&data} {}
 
     /**
@@ -274,7 +292,7 @@ public:
      *
      * @param[in] data Pointer to data the iterator is set to point at.
      */
-    ConstIterator(const T* data) noexcept
+    constexpr ConstIterator(const T* data) noexcept
         : myData{data} {}
 
     /**
@@ -287,7 +305,7 @@ public:
      * 
      * @param[in] other Reference to iterator to copy.
      */
-    ConstIterator(const ConstIterator& other) noexcept
+    constexpr ConstIterator(const ConstIterator& other) noexcept
         : myData{other.myData} {}
 
     /**
@@ -297,7 +315,7 @@ public:
      * 
      * @param[in] other Reference to iterator to move resources from.
      */
-    ConstIterator(ConstIterator&& other) noexcept
+    constexpr ConstIterator(ConstIterator&& other) noexcept
         : myData{other.myData} { other.myData = nullptr; }
 
     /**
@@ -307,7 +325,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    ConstIterator& operator=(const ConstIterator& other) noexcept
+    constexpr ConstIterator& operator=(const ConstIterator& other) noexcept
     {
         if (this != &other) { myData = other.myData; }
         return *this;
@@ -322,7 +340,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    ConstIterator& operator=(ConstIterator&& other) noexcept
+    constexpr ConstIterator& operator=(ConstIterator&& other) noexcept
     {
         if (this != &other)
         {
@@ -337,7 +355,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    ConstIterator& operator++() noexcept
+    constexpr ConstIterator& operator++() noexcept
     {
         ++myData;
         return *this;
@@ -348,7 +366,7 @@ public:
      * 
      * @return Reference to this iterator.
      */
-    ConstIterator& operator--() noexcept
+    constexpr ConstIterator& operator--() noexcept
     {
         --myData;
         return *this;
@@ -359,7 +377,7 @@ public:
      * 
      * @return The previous state of this iterator.
      */
-    ConstIterator operator++(int) noexcept
+    constexpr ConstIterator operator++(int) noexcept
     {
         auto previous{*this};
         ++myData;
@@ -371,7 +389,7 @@ public:
      * 
      * @return The previous state of this iterator.
      */
-    ConstIterator operator--(int) noexcept
+    constexpr ConstIterator operator--(int) noexcept
     {
         auto previous{*this};
         --myData;
@@ -383,7 +401,7 @@ public:
      *
      * @param[in] incrementCount The number of times the iterator will be incremented.
      */
-    void operator+=(const size_t incrementCount) noexcept
+    constexpr void operator+=(const size_t incrementCount) noexcept
     {
         for (size_t i{}; i < incrementCount; ++i) { ++myData; }
     }
@@ -393,7 +411,7 @@ public:
      *
      * @param[in] decrementCount The number of times the iterator will be decremented.
      */
-    void operator-=(const size_t decrementCount) noexcept
+    constexpr void operator-=(const size_t decrementCount) noexcept
     {
         for (size_t i{}; i < decrementCount; ++i) { --myData; }
     }
@@ -405,7 +423,10 @@ public:
      * 
      * @return True if the iterators point at the same address, false otherwise.
      */
-    bool operator==(const ConstIterator& other) const noexcept { return myData == other.myData; }
+    constexpr bool operator==(const ConstIterator& other) const noexcept
+    {
+        return myData == other.myData;
+    }
 
     /**
      * @brief Check if the iterator and referenced other iterator point at different addresses.
@@ -414,7 +435,10 @@ public:
      * 
      * @return True if the iterators point at the different addresses, false otherwise.
      */
-    bool operator!=(const ConstIterator& other) const noexcept { return myData != other.myData; }
+    constexpr bool operator!=(const ConstIterator& other) const noexcept
+    {
+        return myData != other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's higher than
@@ -425,7 +449,10 @@ public:
      * @return True if iterator points at an address that's higher than the address
      *         pointed to by referenced other iterator, false otherwise.
      */
-    bool operator>(const ConstIterator& other) const noexcept { return myData > other.myData; }
+    constexpr bool operator>(const ConstIterator& other) const noexcept
+    {
+        return myData > other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's lower than
@@ -436,7 +463,10 @@ public:
      * @return True if iterator points at an address that's lower than the address
      *         pointed to by referenced other iterator, false otherwise.
      */
-    bool operator<(const ConstIterator& other) const noexcept { return myData < other.myData; }
+    constexpr bool operator<(const ConstIterator& other) const noexcept
+    {
+        return myData < other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's higher or equal
@@ -447,7 +477,10 @@ public:
      * @return True if iterator points at an address that's higher or equal to the
      *         address pointed to by referenced other iterator, false otherwise.
      */
-    bool operator>=(const ConstIterator& other) const noexcept { return myData >= other.myData; }
+    constexpr bool operator>=(const ConstIterator& other) const noexcept
+    {
+        return myData >= other.myData;
+    }
 
     /**
      * @brief Check if the iterator points at an address that's lower or equal
@@ -458,14 +491,17 @@ public:
      * @return True if iterator points at an address that's lower or equal to the
      *         address pointed to by referenced other iterator, false otherwise.
      */
-    bool operator<=(const ConstIterator& other) const noexcept { return myData <= other.myData; }
+    constexpr bool operator<=(const ConstIterator& other) const noexcept
+    {
+        return myData <= other.myData;
+    }
 
     /**
      * @brief Get the value stored at the address the iterator is pointing at.
      *
      * @return Reference to the value at the address the iterator is pointing at.
      */
-    const T& operator*() const noexcept { return *myData; }
+    constexpr const T& operator*() const noexcept { return *myData; }
 
 private:
     /** Pointer to the data this iterator is referring to. */
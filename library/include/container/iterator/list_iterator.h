@@ -10,10 +10,12 @@ namespace container
 /**
  * @brief Implementation of mutable list iterators.
  *
- * @tparam T The list type.
+ * @tparam T         The list type.
+ * @tparam SlabSize  The number of nodes allocated at once by the allocator.
+ * @tparam Allocator The allocator policy.
  */
-template <typename T>
-class List<T>::Iterator final
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+class List<T, SlabSize, Allocator>::Iterator final
 {
 public:
     /**
@@ -208,10 +210,12 @@ private:
 /**
  * @brief Implementation of constant list iterators.
  *
- * @tparam T The list type.
+ * @tparam T         The list type.
+ * @tparam SlabSize  The number of nodes allocated at once by the allocator.
+ * @tparam Allocator The allocator policy.
  */
-template <typename T>
-class List<T>::ConstIterator 
+template <typename T, size_t SlabSize, template <typename, size_t> class Allocator>
+class List<T, SlabSize, Allocator>::ConstIterator 
 {
 public:
     /**
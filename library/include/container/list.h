@@ -5,14 +5,29 @@
 
 #include <stddef.h>
 
+#include "memory/pool.h"
+
 namespace container 
 {
 /**
  * @brief Class for implementation of doubly linked lists.
  * 
- * @tparam T The list type.
+ *        Nodes are allocated by the given allocator policy. By default a fixed-block pool is 
+ *        used, which makes insertion and removal O(1) without heap allocations except when the 
+ *        pool needs a new slab. Released nodes are kept in the pool until the list is deleted.
+ * 
+ *        Each list owns its pool, hence a list holds memory for up to SlabSize - 1 unused nodes
+ *        on top of its content, i.e. (SlabSize - 1) * (sizeof(T) + 2 pointers). The default
+ *        slab size is kept small for that reason; lists expected to grow large should use a
+ *        larger slab size to make fewer and larger allocations.
+ * 
+ * @tparam T         The list type.
+ * @tparam SlabSize  The number of nodes allocated at once by the allocator (default = 2).
+ * @tparam Allocator The allocator policy, such as memory::Pool or memory::HeapAllocator.
+ *                   Must provide allocate(), deallocate() and reserve().
  */
-template <typename T>
+template <typename T, size_t SlabSize = 2U, 
+          template <typename, size_t> class Allocator = memory::Pool>
 class List
 {        
 public:
@@ -55,7 +70,7 @@ public:
      *
      * @param[in] other Reference to other list to copy from.
      */
-    List(const List<T>& other) noexcept;
+    List(const List& other) noexcept;
 
     /**
      * @brief Move memory from another list.
@@ -64,7 +79,7 @@ public:
      *
      * @param[in] other Reference to other list to move memory from.
      */
-    List(List<T>&& other) noexcept;
+    List(List&& other) noexcept;
 
      /**
      * @brief Copy the content of list to assigned list. 
@@ -75,7 +90,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(const List<T>& other) noexcept;
+    List& operator=(const List& other) noexcept;
 
     /**
      * @brief Move the content from other list.
@@ -88,7 +103,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(List<T>&& other) noexcept;
+    List& operator=(List&& other) noexcept;
 
     /**
      * @brief Add values from another list.
@@ -97,7 +112,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator+=(const List<T>& other) noexcept;
+    List& operator+=(const List& other) noexcept;
 
     /**
      * @brief Push values to the back of list.
@@ -109,7 +124,7 @@ public:
      * @return Reference to this list.
      */
     template <size_t ValueCount>
-    List<T>& operator+=(const T (&values)[ValueCount]) noexcept;
+    List& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get reference to the value at given position in the list.
@@ -138,6 +153,8 @@ public:
 
     /**
      * @brief Clear the list.
+     * 
+     *        The memory of the removed nodes is kept by the allocator for reuse.
      */
     void clear() noexcept;
 
@@ -214,6 +231,17 @@ public:
      */
     bool resize(size_t newSize, const T& startValue = static_cast<T>(0)) noexcept;
 
+    /**
+     * @brief Reserve memory for given number of additional nodes.
+     * 
+     *        Call this method at startup to make subsequent insertions heap-free.
+     *
+     * @param[in] nodeCount The number of nodes to reserve memory for.
+     * 
+     * @return True if the memory was reserved, false otherwise.
+     */
+    bool reserve(size_t nodeCount) noexcept;
+
     /**
      * @brief Insert value at the front of list.
      *
@@ -234,6 +262,9 @@ public:
 
     /**
      * @brief Insert value at given position in the list.
+     * 
+     *        The value is placed in front of the value the iterator is pointing at, or at the 
+     *        back of the list if the iterator is pointing at the end.
      *
      * @param[in] iterator Reference to iterator pointing at the location to place the new value.
      * @param[in] value    Reference to the value to add.
@@ -254,6 +285,8 @@ public:
     
     /**
      * @brief Remove value at given position in the list.
+     * 
+     *        The iterator is set to point at the next value once the removal is completed.
      *
      * @param[in] iterator Reference to iterator pointing at the value to remove.
      *
@@ -265,12 +298,15 @@ protected:
     /** Node holding data stored in the list. */
     struct Node;
 
-    bool copy(const List<T>& other) noexcept;
-    template <size_t ValueCount>
-    void assign(const T (&values)[ValueCount], size_t offset = 0U) noexcept;
+    /** Allocator used for allocating nodes. */
+    using NodeAllocator = Allocator<Node, SlabSize>;
+
+    bool copy(const List& other) noexcept;
     template <size_t ValueCount>
     bool addValues(const T (&values)[ValueCount]) noexcept;
     void removeAllNodes() noexcept;
+    Node* createNode(const T& value) noexcept;
+    void destroyNode(Node* node) noexcept;
 
     /** Pointer to the first node of the list. */
     Node* myFirst;
@@ -280,6 +316,9 @@ protected:
 
     /** The size of the list in number of nodes. */
     size_t mySize;
+
+    /** Allocator providing memory for the nodes. */
+    NodeAllocator myAllocator;
 };
 } // namespace container
 
@@ -0,0 +1,161 @@
+/**
+ * @brief Implementation of fixed-capacity lock-free ring buffers.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/type_traits.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of fixed-capacity ring buffers.
+ *
+ *        The buffer is lock-free for a single producer and a single consumer, such as an
+ *        interrupt handler and the main loop. The producer only modifies the head index and
+ *        the consumer only modifies the tail index; each index is published with release
+ *        semantics once the associated elements have been written or read.
+ *
+ *        The indices are free-running and masked with N - 1, hence all N slots are usable
+ *        and no modulo operation is required.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T The element type. Must be default constructible and copy assignable.
+ * @tparam N The capacity in number of elements. Must be a power of two.
+ */
+template <typename T, size_t N>
+class RingBuffer final
+{
+    // Generate a compiler error if the capacity isn't a power of two.
+    static_assert((N > 1U) && ((N & (N - 1U)) == 0U), "Capacity must be a power of two!");
+
+    // Generate a compiler error if the capacity is too large for the index type.
+    static_assert(N <= 32768U, "Capacity must not exceed 32768 elements!");
+
+public:
+    /** Index type, single-byte indices can be accessed atomically on the AVR. */
+    using Index = typename type_traits::conditional<(N <= 128U), uint8_t, uint16_t>::type;
+
+    /**
+     * @brief Create empty ring buffer.
+     */
+    RingBuffer() noexcept;
+
+    /**
+     * @brief Delete ring buffer.
+     */
+    ~RingBuffer() noexcept = default;
+
+    /**
+     * @brief Get the capacity of the ring buffer.
+     *
+     * @return The capacity in number of elements.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Get the number of elements in the ring buffer.
+     *
+     * @note The result is a snapshot if the buffer is used from another context.
+     *
+     * @return The number of elements the ring buffer holds.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check if the ring buffer is empty.
+     *
+     * @return True if the ring buffer is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the ring buffer is full.
+     *
+     * @return True if the ring buffer is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Push value to the ring buffer (producer only).
+     *
+     * @param[in] value The value to push.
+     *
+     * @return True if the value was pushed, false if the ring buffer is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Push values to the ring buffer (producer only).
+     *
+     *        As many values as there is room for are pushed. The values are copied in at most
+     *        two contiguous blocks and published at once.
+     *
+     * @param[in] values Pointer to the values to push.
+     * @param[in] count  The number of values to push.
+     *
+     * @return The number of values pushed.
+     */
+    size_t push(const T* values, size_t count) noexcept;
+
+    /**
+     * @brief Pop value from the ring buffer (consumer only).
+     *
+     * @param[out] value Reference to variable to store the popped value.
+     *
+     * @return True if a value was popped, false if the ring buffer is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Pop values from the ring buffer (consumer only).
+     *
+     *        As many values as available are popped. The values are copied in at most two
+     *        contiguous blocks and released at once.
+     *
+     * @param[out] values Pointer to destination holding room for at least count values.
+     * @param[in]  count  The maximum number of values to pop.
+     *
+     * @return The number of values popped.
+     */
+    size_t pop(T* values, size_t count) noexcept;
+
+    /**
+     * @brief Read the next value without removing it (consumer only).
+     *
+     * @param[out] value Reference to variable to store the value.
+     *
+     * @return True if a value was read, false if the ring buffer is empty.
+     */
+    bool peek(T& value) const noexcept;
+
+    /**
+     * @brief Remove all values from the ring buffer (consumer only).
+     */
+    void clear() noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete; // No copy constructor.
+    RingBuffer(RingBuffer&&)                 = delete; // No move constructor.
+    RingBuffer& operator=(const RingBuffer&) = delete; // No copy assignment.
+    RingBuffer& operator=(RingBuffer&&)      = delete; // No move assignment.
+
+private:
+    static constexpr Index Mask{static_cast<Index>(N - 1U)};
+
+    static void copy(T* destination, const T* source, size_t count) noexcept;
+
+    /** Storage holding the elements. */
+    T myData[N];
+
+    /** Free-running write index, modified by the producer only. */
+    Index myHead;
+
+    /** Free-running read index, modified by the consumer only. */
+    Index myTail;
+};
+} // namespace container
+
+#include "impl/ring_buffer_impl.h"
@@ -0,0 +1,183 @@
+/**
+ * @brief Implementation of dynamic vectors with inline storage for small sizes.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container/vector.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of dynamic vectors with inline storage.
+ *
+ *        Up to N elements are stored inside the vector itself, so that no memory is allocated
+ *        until the vector grows beyond that. Since the class derives from Vector<T>, it uses
+ *        the same iterator types and can be passed wherever a Vector<T> is expected.
+ *
+ *        The inline storage is only tracked by this class. Once the content has spilled to
+ *        the heap, clearing or moving it through a Vector<T> reference leaves the vector
+ *        without memory, and the inline storage is taken into use again by clear() or
+ *        shrinkToFit() of this class.
+ *
+ * @tparam T The vector type.
+ * @tparam N The inline capacity in number of elements. Must be greater than 0.
+ */
+template <typename T, size_t N>
+class SmallVector final : public Vector<T>
+{
+    // Generate a compiler error if the inline capacity is set to 0.
+    static_assert(N > 0U, "Inline capacity must be greater than 0!");
+
+public:
+    /**
+     * @brief Create empty vector.
+     */
+    SmallVector() noexcept;
+
+    /**
+     * @brief Create vector of given size.
+     *
+     * @param[in] size The size of vector, i.e. the number of elements it holds.
+     */
+    explicit SmallVector(size_t size) noexcept;
+
+    /**
+     * @brief Create vector containing given values.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param[in] values The values to add to the vector.
+     */
+    template <typename... Values>
+    explicit SmallVector(const Values&&... values) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    SmallVector(const Vector<T>& other) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    SmallVector(const SmallVector& other) noexcept;
+
+    /**
+     * @brief Move content from another vector.
+     *
+     *        Allocated memory is taken over, while inline content is copied.
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to other vector to move content from.
+     */
+    SmallVector(Vector<T>&& other) noexcept;
+
+    /**
+     * @brief Move content from another vector.
+     *
+     *        Allocated memory is taken over, while inline content is copied.
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to other vector to move content from.
+     */
+    SmallVector(SmallVector&& other) noexcept;
+
+    /**
+     * @brief Delete vector.
+     */
+    ~SmallVector() noexcept = default;
+
+    /**
+     * @brief Copy the content of vector to assigned vector.
+     *
+     *        Previous values are cleared before copying.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(const Vector<T>& other) noexcept;
+
+    /**
+     * @brief Copy the content of vector to assigned vector.
+     *
+     *        Previous values are cleared before copying.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(const SmallVector& other) noexcept;
+
+    /**
+     * @brief Move the content from other vector.
+     *
+     *        Previous values are cleared before moving.
+     *
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to vector holding the data to move.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(Vector<T>&& other) noexcept;
+
+    /**
+     * @brief Move the content from other vector.
+     *
+     *        Previous values are cleared before moving.
+     *
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to vector holding the data to move.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(SmallVector&& other) noexcept;
+
+    /**
+     * @brief Clear content of vector and release allocated memory.
+     *
+     *        The inline storage is used again afterwards.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Release unused memory, so that the capacity of vector equals its size.
+     *
+     *        The content is moved back to the inline storage if it fits, hence the capacity
+     *        never drops below the inline capacity.
+     *
+     * @return True if the capacity matches the size of vector, false otherwise.
+     */
+    bool shrinkToFit() noexcept;
+
+    /**
+     * @brief Check whether the content is stored inline.
+     *
+     * @return True if the content is stored inline, false if it has spilled to the heap.
+     */
+    bool isInline() const noexcept;
+
+    /**
+     * @brief Get the inline capacity of the vector.
+     *
+     * @return The number of elements that can be stored without allocating memory.
+     */
+    static constexpr size_t inlineCapacity() noexcept { return N; }
+
+private:
+    T* inlineData() noexcept;
+
+    /** Inline storage holding the first N elements. */
+    alignas(T) uint8_t myBuffer[N * sizeof(T)];
+};
+} // namespace container
+
+#include "impl/small_vector_impl.h"
@@ -0,0 +1,324 @@
+/**
+ * @brief Implementation of static-capacity vectors of any data type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+#include "utils/utils.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of static-capacity vectors.
+ *
+ *        The vector holds up to N elements stored inside the vector itself, hence no memory is
+ *        ever allocated. Operations that would exceed the capacity fail and return false.
+ *
+ *        All operations are constexpr, so vectors of literal types can be built and modified
+ *        at compile time. To enable this, all N elements are default constructed up front,
+ *        and elements removed from the vector are reset to their default value.
+ *
+ * @tparam T The vector type. Must be default constructible.
+ * @tparam N The vector capacity in number of elements. Must be greater than 0.
+ */
+template <typename T, size_t N>
+class StaticVector final
+{
+    // Generate a compiler error if the capacity is set to 0.
+    static_assert(N > 0U, "Vector capacity must be greater than 0!");
+
+public:
+    /** Vector iterator, the elements are contiguous just like in an array. */
+    using Iterator = typename Array<T, N>::Iterator;
+
+    /** Constant vector iterator. */
+    using ConstIterator = typename Array<T, N>::ConstIterator;
+
+    /**
+     * @brief Create empty vector.
+     */
+    constexpr StaticVector() noexcept;
+
+    /**
+     * @brief Create vector of given size.
+     *
+     *        The size is limited to the capacity of the vector.
+     *
+     * @param[in] size The size of vector, i.e. the number of elements it holds.
+     */
+    constexpr explicit StaticVector(size_t size) noexcept;
+
+    /**
+     * @brief Create vector containing given values.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param[in] values The values to add to the vector. Must not exceed the capacity.
+     */
+    template <typename... Values>
+    constexpr explicit StaticVector(const Values&&... values) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    StaticVector(const StaticVector& other) noexcept = default;
+
+    /**
+     * @brief Delete vector.
+     */
+    ~StaticVector() noexcept = default;
+
+    /**
+     * @brief Copy the content of another vector.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    StaticVector& operator=(const StaticVector& other) noexcept = default;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    constexpr T& operator[](size_t index) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    constexpr const T& operator[](size_t index) const noexcept;
+
+    /**
+     * @brief Get data held by the vector.
+     *
+     * @return Pointer to the data held by the vector.
+     */
+    constexpr T* data() noexcept;
+
+    /**
+     * @brief Get data held by the vector.
+     *
+     * @return Pointer to the data held by the vector.
+     */
+    constexpr const T* data() const noexcept;
+
+    /**
+     * @brief Get the size of vector.
+     *
+     * @return The size of vector in the number of elements it holds.
+     */
+    constexpr size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of vector.
+     *
+     * @return The number of elements the vector can hold.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Check if the vector is empty.
+     *
+     * @return True if the vector is empty, false otherwise.
+     */
+    constexpr bool empty() const noexcept;
+
+    /**
+     * @brief Check if the vector is full.
+     *
+     * @return True if the vector is full, false otherwise.
+     */
+    constexpr bool full() const noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of vector.
+     */
+    constexpr Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of vector.
+     */
+    constexpr ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of vector.
+     */
+    constexpr Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of vector.
+     */
+    constexpr ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the reverse beginning of vector.
+     *
+     * @return Iterator pointing at the reverse beginning of vector.
+     */
+    constexpr Iterator rbegin() noexcept;
+
+    /**
+     * @brief Get the reverse beginning of vector.
+     *
+     * @return Iterator pointing at the reverse beginning of vector.
+     */
+    constexpr ConstIterator rbegin() const noexcept;
+
+    /**
+     * @brief Get the reverse end of vector.
+     *
+     * @return Iterator pointing at the reverse end of vector.
+     */
+    constexpr Iterator rend() noexcept;
+
+    /**
+     * @brief Get the reverse end of vector.
+     *
+     * @return Iterator pointing at the reverse end of vector.
+     */
+    constexpr ConstIterator rend() const noexcept;
+
+    /**
+     * @brief Get the last element of vector.
+     *
+     * @return Pointer to the last element of vector, or nullptr if the vector is empty.
+     */
+    constexpr T* last() noexcept;
+
+    /**
+     * @brief Get the last element of vector.
+     *
+     * @return Pointer to the last element of vector, or nullptr if the vector is empty.
+     */
+    constexpr const T* last() const noexcept;
+
+    /**
+     * @brief Clear the content of vector.
+     */
+    constexpr void clear() noexcept;
+
+    /**
+     * @brief Resize vector to given size.
+     *
+     *        New elements are default constructed.
+     *
+     * @param[in] newSize The new size of vector.
+     *
+     * @return True if the vector was resized, false if the new size exceeds the capacity.
+     */
+    constexpr bool resize(size_t newSize) noexcept;
+
+    /**
+     * @brief Push new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false if the vector is full.
+     */
+    constexpr bool pushBack(const T& value) noexcept;
+
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was moved to the back of vector, false if the vector is full.
+     */
+    constexpr bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value at the back of vector.
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     *
+     * @param[in] args The arguments to pass to the constructor of T.
+     *
+     * @return True if the value was constructed at the back of vector, false if the vector
+     *         is full.
+     */
+    template <typename... Args>
+    constexpr bool emplaceBack(Args&&... args) noexcept;
+
+    /**
+     * @brief Pop value at the back of vector.
+     *
+     * @return True if the last value of vector was popped, false if the vector is empty.
+     */
+    constexpr bool popBack() noexcept;
+
+    /**
+     * @brief Insert value at given index, subsequent values are shifted one step back.
+     *
+     * @param[in] index The index at which to insert the value. Must not exceed the size.
+     * @param[in] value Reference to the value to insert.
+     *
+     * @return True if the value was inserted, false if the vector is full or the index
+     *         is invalid.
+     */
+    constexpr bool insert(size_t index, const T& value) noexcept;
+
+    /**
+     * @brief Insert value at the position the iterator is pointing at.
+     *
+     *        Subsequent values are shifted one step back.
+     *
+     * @param[in] iterator Iterator pointing at the position to insert the value.
+     * @param[in] value    Reference to the value to insert.
+     *
+     * @return True if the value was inserted, false if the vector is full or the iterator
+     *         is invalid.
+     */
+    constexpr bool insert(const Iterator& iterator, const T& value) noexcept;
+
+    /**
+     * @brief Erase value at given index, subsequent values are shifted one step forward.
+     *
+     * @param[in] index The index of the value to erase.
+     *
+     * @return True if the value was erased, false if the index is invalid.
+     */
+    constexpr bool erase(size_t index) noexcept;
+
+    /**
+     * @brief Erase the value the iterator is pointing at.
+     *
+     *        Subsequent values are shifted one step forward, hence the iterator points at the
+     *        next value once the operation is completed.
+     *
+     * @param[in] iterator Iterator pointing at the value to erase.
+     *
+     * @return True if the value was erased, false if the iterator is invalid.
+     */
+    constexpr bool erase(const Iterator& iterator) noexcept;
+
+private:
+    constexpr size_t indexOf(const Iterator& iterator) noexcept;
+
+    /** Statically-sized data field. */
+    T myData[N];
+
+    /** The number of elements held by the vector. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/static_vector_impl.h"
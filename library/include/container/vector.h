@@ -147,12 +147,20 @@ public:
     const T* data() const noexcept;
 
     /**
-     * @brief Get the size of vector in the number of elements it can hold.
+     * @brief Get the size of vector in the number of elements it holds.
      *
      * @return The size of vector as an unsigned integer.
      */
     size_t size() const noexcept;
 
+    /**
+     * @brief Get the capacity of vector in the number of elements it can hold
+     *        before new memory has to be allocated.
+     *
+     * @return The capacity of vector as an unsigned integer.
+     */
+    size_t capacity() const noexcept;
+
     /**
      * @brief Check if the vector is empty.
      *
@@ -231,12 +239,15 @@ public:
     const T* last() const noexcept;
 
     /**
-     * @brief Clear content of vector.
+     * @brief Clear content of vector and release allocated memory.
      */
     void clear() noexcept;
 
     /**
      * @brief Resize the vector to given new size.
+     * 
+     *        Memory is only reallocated if the new size exceeds the current capacity.
+     *        Added elements are value-initialized, removed elements are destroyed.
      *
      * @param[in] newSize The new size of vector.
      * 
@@ -244,8 +255,32 @@ public:
      */
     bool resize(size_t newSize) noexcept;
 
+    /**
+     * @brief Reserve memory for at least given number of elements.
+     * 
+     *        The size of the vector is left unchanged. Nothing is done if the capacity of
+     *        the vector already is sufficient.
+     *
+     * @param[in] newCapacity The requested capacity of vector.
+     * 
+     * @return True if the requested capacity is available, false otherwise.
+     */
+    bool reserve(size_t newCapacity) noexcept;
+
+    /**
+     * @brief Release unused memory, so that the capacity of vector equals its size.
+     * 
+     *        Content held in inline storage is left where it is.
+     * 
+     * @return True if the capacity matches the size of vector, false otherwise.
+     */
+    bool shrinkToFit() noexcept;
+
     /**
      * @brief Push new value to the back of vector.
+     * 
+     *        The capacity of vector is doubled when full, which makes the operation
+     *        amortized O(1).
      *
      * @param[in] value Reference to the new value to push to the vector.
      * 
@@ -253,8 +288,37 @@ public:
      */
     bool pushBack(const T& value) noexcept;
 
+    /**
+     * @brief Move new value to the back of vector.
+     * 
+     *        The capacity of vector is doubled when full, which makes the operation
+     *        amortized O(1).
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     * 
+     * @return True if the value was moved to the back of vector, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value in place at the back of vector.
+     * 
+     *        The capacity of vector is doubled when full, which makes the operation
+     *        amortized O(1).
+     *
+     * @tparam Args The types of arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was constructed at the back of vector, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
     /** 
-     * @brief Pop value at the back of vector noexcept.
+     * @brief Pop value at the back of vector.
+     * 
+     *        The capacity of vector is left unchanged, use shrinkToFit() to release memory.
      *
      * @return True if the last value of vector was popped, false otherwise.
      */
@@ -262,22 +326,45 @@ public:
 
 protected:
 
-    bool copy(const Vector<T>& other) noexcept;
-    void assign(const Vector<T>& other, size_t offset = 0) noexcept;
-
-    template <size_t ValueCount>
-    void assign(const T (&values)[ValueCount], size_t offset = 0) noexcept;
+    /**
+     * @brief Create empty vector using given inline storage until it runs out of space.
+     *
+     * @param[in] inlineData Pointer to the inline storage.
+     * @param[in] inlineCapacity The capacity of the inline storage in number of elements.
+     */
+    Vector(T* inlineData, size_t inlineCapacity) noexcept;
 
+    bool usesInlineData() const noexcept;
+    void useInlineData(T* inlineData, size_t inlineCapacity) noexcept;
+    void moveFrom(Vector<T>& other) noexcept;
+    bool copy(const Vector<T>& other) noexcept;
     bool addValues(const Vector<T>& other) noexcept;
 
     template <size_t ValueCount>
     bool addValues(const T (&values)[ValueCount]) noexcept;
 
+    bool addValues(const T* values, size_t count) noexcept;
+    bool reallocate(size_t newCapacity) noexcept;
+    size_t nextCapacity() const noexcept;
+    void destroy(size_t start, size_t end) noexcept;
+    
+    static void relocate(T* destination, T* source, size_t count) noexcept;
+
     /** Pointer to dynamic field holding data. */
     T* myData;
 
-    /** The size of the field in number of elements it can hold. */
+    /** The size of the field in number of elements it holds. */
     size_t mySize;
+
+    /** 
+     * The capacity of the field in number of elements it can hold. The most significant bit
+     * is set when the field is inline storage owned by a derived class, which keeps the
+     * bookkeeping out of plain vectors.
+     */
+    size_t myCapacity;
+
+    /** Flag set in the capacity when the field is inline storage. */
+    static constexpr size_t InlineFlag{~(static_cast<size_t>(-1) >> 1U)};
 };
 } // namespace container
 
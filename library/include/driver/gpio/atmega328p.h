@@ -5,7 +5,9 @@
 
 #include <stdint.h>
 
+#include "container/intrusive_list.h"
 #include "driver/gpio/interface.h"
+#include "utils/delegate.h"
 
 namespace driver 
 {
@@ -14,6 +16,21 @@ namespace gpio
 /** GPIO hardware structure. */
 struct Hardware;
 
+/**
+ * @brief Subscriber to the pin change interrupts of an I/O port.
+ * 
+ *        The subscribers of each I/O port are linked into a list, which is traversed by the 
+ *        pin change interrupt of the port.
+ */
+struct PinChangeSubscriber final : public container::IntrusiveListHook<>
+{
+    /** Callback to invoke when a subscribed pin changes. */
+    utils::Delegate<void()> callback;
+
+    /** Mask of the subscribed pins. */
+    uint8_t pinMask;
+};
+
 /**
  * @brief GPIO driver for ATmega328P.
  * 
@@ -33,10 +50,11 @@ public:
      *
      * @param[in] pin The pin number of the GPIO.
      * @param[in] direction The GPIO direction.
-     * @param[in] callback Callback associated with the GPIO (default = none).
+     * @param[in] callback Callback associated with the GPIO (default = none). Member functions
+     *                     can be bound via utils::Delegate::bind().
      */
     explicit Atmega328p(uint8_t pin, Direction direction, 
-        void (*callback)() = nullptr) noexcept;
+        const utils::Delegate<void()>& callback = {}) noexcept;
 
     /**
      * @brief Destructor.
@@ -103,6 +121,16 @@ public:
      * @note This operation is only supported for pins set to output.
      */
     void blink(const uint16_t& blinkSpeed_ms) noexcept;
+
+    /**
+     * @brief Set the callback to invoke on pin change interrupts of the GPIO.
+     * 
+     *        Each GPIO has a callback of its own, which is only invoked when the pin of the
+     *        GPIO has changed, also when several GPIOs on the same I/O port have callbacks.
+     * 
+     * @param[in] callback The new callback (none = no callback).
+     */
+    void setCallback(const utils::Delegate<void()>& callback) noexcept;
     
     Atmega328p()                             = delete; // No default constructor.
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
@@ -129,6 +157,9 @@ private:
 
     /** Pin the GPIO is connected to. */
     uint8_t myPin;
+
+    /** Subscription to the pin change interrupts of the associated I/O port. */
+    PinChangeSubscriber mySubscriber;
 };
 
 /**
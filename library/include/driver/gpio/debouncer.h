@@ -0,0 +1,155 @@
+/**
+ * @brief Sampling debounce engine for buttons on the same I/O port.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/port_group.h"
+#include "driver/gpio/port_map.h"
+#include "utils/delegate.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief Enumeration of button events.
+ */
+enum class ButtonEvent : uint8_t
+{
+    Pressed,     // The button was pressed.
+    Released,    // The button was released.
+    LongPressed, // The button has been held down for the long-press duration.
+    Count,       // The number of button events.
+};
+
+/**
+ * @brief Sampling debounce engine for buttons on the same I/O port.
+ *
+ *        The buttons are sampled periodically from a shared tick, such as the interrupt of a 
+ *        timer already running for other purposes, so no timer or pin change interrupt is 
+ *        dedicated to debouncing. All buttons are debounced in parallel with bitwise operations 
+ *        on vertical counters: a button changes state once it has been sampled in the new state 
+ *        four times in a row. Since no interrupts are disabled, presses on other buttons are 
+ *        never lost while one button bounces.
+ *
+ *        The pins must be configured as inputs, e.g. via the GPIO driver; the debouncer only
+ *        reads the pin register. This class is non-copyable and non-movable.
+ *
+ * @tparam PinIds The pin numbers of the buttons, see Atmega328p::Port. All pins must belong
+ *                to the same I/O port. The first pin is button 0.
+ */
+template <uint8_t... PinIds>
+class Debouncer final
+{
+    static_assert(0U < sizeof...(PinIds), "The debouncer must contain at least one button!");
+    static_assert(8U >= sizeof...(PinIds), "The debouncer supports up to 8 buttons!");
+
+public:
+    /** Handler of button events, invoked with the button index and the event. */
+    using Handler = utils::Delegate<void(uint8_t button, ButtonEvent event)>;
+
+    /** The number of buttons. */
+    static constexpr uint8_t ButtonCount{static_cast<uint8_t>(sizeof...(PinIds))};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] handler Handler to invoke on button events (default = none).
+     * @param[in] samplePeriod_ticks The number of ticks between each sample (default = 1).
+     * @param[in] longPress_samples The number of samples a button must be held down to emit a 
+     *                              long-press event (default = 0, no long-press events).
+     * @param[in] activeLow True if the buttons read low when pressed, such as buttons using 
+     *                      the internal pull-up resistors (default = true).
+     */
+    explicit Debouncer(const Handler& handler = {}, uint16_t samplePeriod_ticks = 1U, 
+                       uint16_t longPress_samples = 0U, bool activeLow = true) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Debouncer() noexcept = default;
+
+    /**
+     * @brief Get the debounced state of the buttons.
+     *
+     * @return Mask of the buttons pressed, bit i is set if button i is pressed.
+     */
+    uint8_t state() const noexcept;
+
+    /**
+     * @brief Check whether a button is pressed, according to the debounced state.
+     *
+     * @param[in] button The index of the button.
+     *
+     * @return True if the button is pressed, false otherwise.
+     */
+    bool isPressed(uint8_t button) const noexcept;
+
+    /**
+     * @brief Set the handler to invoke on button events.
+     *
+     * @param[in] handler The new handler (none = no handler).
+     */
+    void setHandler(const Handler& handler) noexcept;
+
+    /**
+     * @brief Advance the debouncer one tick, sample the buttons at the end of each sample
+     *        period and invoke the handler for each event.
+     *
+     *        Call this function from the shared tick, typically a timer interrupt.
+     */
+    void tick() noexcept;
+
+    Debouncer(const Debouncer&)            = delete; // No copy constructor.
+    Debouncer(Debouncer&&)                 = delete; // No move constructor.
+    Debouncer& operator=(const Debouncer&) = delete; // No copy assignment.
+    Debouncer& operator=(Debouncer&&)      = delete; // No move assignment.
+
+private:
+    /** The I/O port of the buttons (taken from the last pin, all pins are on the same port). */
+    static constexpr Atmega328p::IoPort IoPort{PinMap<(PinIds, ...)>::IoPort};
+
+    static_assert(((PinMap<PinIds>::IoPort == IoPort) && ...),
+                  "All buttons must belong to the same I/O port!");
+
+    uint8_t readButtons() const noexcept;
+    void sample() noexcept;
+    void notify(uint8_t mask, ButtonEvent event) noexcept;
+    void updateHoldCounts(uint8_t pressed) noexcept;
+
+    /** The buttons as a port group, used to gather the button bits from the pin register. */
+    using Buttons = PortGroup<Direction::Input, PinIds...>;
+
+    /** Handler to invoke on button events. */
+    Handler myHandler;
+
+    /** The number of ticks between each sample. */
+    const uint16_t mySamplePeriod;
+
+    /** The number of samples a button must be held down to emit a long-press event. */
+    const uint16_t myLongPressSamples;
+
+    /** The number of ticks since the last sample. */
+    uint16_t myTickCount;
+
+    /** The number of samples each button has been held down, saturated at the long press. */
+    uint16_t myHoldCounts[ButtonCount];
+
+    /** Mask to invert the pin states with, so that pressed buttons read as ones. */
+    const uint8_t myInvertMask;
+
+    /** Debounced state of the buttons (1 = pressed). */
+    uint8_t myState;
+
+    /** Low bits of the vertical counters. */
+    uint8_t myCount0;
+
+    /** High bits of the vertical counters. */
+    uint8_t myCount1;
+};
+} // namespace gpio
+} // namespace driver
+
+#include "impl/debouncer_impl.h"
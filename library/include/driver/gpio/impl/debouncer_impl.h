@@ -0,0 +1,115 @@
+/**
+ * @brief Implementation details of the sampling debounce engine.
+ *
+ * @note Don't include this header, use <debouncer.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+Debouncer<PinIds...>::Debouncer(const Handler& handler, const uint16_t samplePeriod_ticks, 
+                                const uint16_t longPress_samples, const bool activeLow) noexcept
+    : myHandler{handler}
+    , mySamplePeriod{0U < samplePeriod_ticks ? samplePeriod_ticks : static_cast<uint16_t>(1U)}
+    , myLongPressSamples{longPress_samples}
+    , myTickCount{0U}
+    , myHoldCounts{}
+    , myInvertMask{activeLow ? static_cast<uint8_t>((1U << ButtonCount) - 1U) : 
+                               static_cast<uint8_t>(0U)}
+    , myState{readButtons()}
+    , myCount0{0xFFU}
+    , myCount1{0xFFU}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+uint8_t Debouncer<PinIds...>::state() const noexcept { return utils::atomicLoad(myState); }
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+bool Debouncer<PinIds...>::isPressed(const uint8_t button) const noexcept
+{
+    return (ButtonCount > button) && utils::read(state(), button);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+void Debouncer<PinIds...>::setHandler(const Handler& handler) noexcept
+{
+    // The handler is read by the tick, which typically runs in interrupt context.
+    utils::InterruptGuard guard{};
+    myHandler = handler;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+void Debouncer<PinIds...>::tick() noexcept
+{
+    if (mySamplePeriod > ++myTickCount) { return; }
+    myTickCount = 0U;
+    sample();
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+uint8_t Debouncer<PinIds...>::readButtons() const noexcept
+{
+    return Buttons::gather(PortRegisters<IoPort>::pinx()) ^ myInvertMask;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+void Debouncer<PinIds...>::sample() noexcept
+{
+    // Count the buttons sampled in another state than the debounced state, reset the others.
+    // The 2-bit counters count down from 3, the state toggles when they wrap around.
+    uint8_t changed{static_cast<uint8_t>(myState ^ readButtons())};
+    myCount0 = static_cast<uint8_t>(~(myCount0 & changed));
+    myCount1 = static_cast<uint8_t>(myCount0 ^ (myCount1 & changed));
+    changed &= myCount0 & myCount1;
+
+    const uint8_t state{static_cast<uint8_t>(myState ^ changed)};
+    utils::atomicStore(myState, state);
+
+    if (0U != changed)
+    {
+        notify(state & changed, ButtonEvent::Pressed);
+        notify(static_cast<uint8_t>(~state) & changed, ButtonEvent::Released);
+    }
+    if ((0U != myLongPressSamples) && myHandler) { updateHoldCounts(state); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+void Debouncer<PinIds...>::notify(const uint8_t mask, const ButtonEvent event) noexcept
+{
+    if (!myHandler) { return; }
+
+    for (uint8_t i{}; i < ButtonCount; ++i)
+    {
+        if (utils::read(mask, i)) { myHandler(i, event); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t... PinIds>
+void Debouncer<PinIds...>::updateHoldCounts(const uint8_t pressed) noexcept
+{
+    for (uint8_t i{}; i < ButtonCount; ++i)
+    {
+        // Reset the count when released, emit a single long-press event per press.
+        if (!utils::read(pressed, i)) { myHoldCounts[i] = 0U; }
+        else if (myLongPressSamples > myHoldCounts[i])
+        {
+            if (myLongPressSamples == ++myHoldCounts[i]) { myHandler(i, ButtonEvent::LongPressed); }
+        }
+    }
+}
+} // namespace gpio
+} // namespace driver
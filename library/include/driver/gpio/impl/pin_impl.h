@@ -0,0 +1,129 @@
+/**
+ * @brief Implementation details of compile-time GPIO pins.
+ *
+ * @note Don't include this header, use <pin.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline Pin<PinId, DataDirection>::Pin() noexcept
+{
+    // Set data direction as specified, enable the internal pull-up resistor if specified.
+    if constexpr (IsOutput) { Registers::ddrx() |= Mask; }
+    else if constexpr (Direction::InputPullup == DataDirection) { Registers::portx() |= Mask; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline Pin<PinId, DataDirection>::~Pin() noexcept
+{
+    Registers::ddrx() &= static_cast<uint8_t>(~Mask);
+    Registers::portx() &= static_cast<uint8_t>(~Mask);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+constexpr Direction Pin<PinId, DataDirection>::direction() noexcept { return DataDirection; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline bool Pin<PinId, DataDirection>::read() const noexcept
+{
+    return 0U != (Registers::pinx() & Mask);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::write(const bool output) noexcept
+{
+    if (output) { set(); }
+    else { clear(); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::set() noexcept
+{
+    if constexpr (IsOutput) { Registers::portx() |= Mask; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::clear() noexcept
+{
+    if constexpr (IsOutput) { Registers::portx() &= static_cast<uint8_t>(~Mask); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::toggle() noexcept
+{
+    // The hardware will toggle the output when writing to the pin register.
+    if constexpr (IsOutput) { Registers::pinx() |= Mask; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::enableInterrupt(const bool enable) noexcept
+{
+    if (enable)
+    {
+        utils::set(PCICR, Registers::pcix());
+        Registers::pcmskx() |= Mask;
+    }
+    else { Registers::pcmskx() &= static_cast<uint8_t>(~Mask); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+inline void Pin<PinId, DataDirection>::enableInterruptOnPort(const bool enable) noexcept
+{
+    if (enable) { utils::set(PCICR, Registers::pcix()); }
+    else { utils::clear(PCICR, Registers::pcix()); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+bool PinAdapter<PinId, DataDirection>::isInitialized() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+Direction PinAdapter<PinId, DataDirection>::direction() const noexcept 
+{ 
+    return DataDirection; 
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+bool PinAdapter<PinId, DataDirection>::read() const noexcept { return myPin.read(); }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+void PinAdapter<PinId, DataDirection>::write(const bool output) noexcept { myPin.write(output); }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+void PinAdapter<PinId, DataDirection>::toggle() noexcept { myPin.toggle(); }
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+void PinAdapter<PinId, DataDirection>::enableInterrupt(const bool enable) noexcept
+{
+    myPin.enableInterrupt(enable);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PinId, Direction DataDirection>
+void PinAdapter<PinId, DataDirection>::enableInterruptOnPort(const bool enable) noexcept
+{
+    myPin.enableInterruptOnPort(enable);
+}
+} // namespace gpio
+} // namespace driver
@@ -0,0 +1,126 @@
+/**
+ * @brief Implementation details of the GPIO port group.
+ *
+ * @note Don't include this header, use <port_group.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+PortGroup<DataDirection, PinIds...>::PortGroup() noexcept
+{
+    // Set data direction as specified, enable the internal pull-up resistors if specified.
+    if constexpr (IsOutput) { Registers::ddrx() |= PortMask; }
+    else 
+    { 
+        Registers::ddrx() &= static_cast<uint8_t>(~PortMask);
+
+        if constexpr (Direction::InputPullup == DataDirection) { Registers::portx() |= PortMask; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+PortGroup<DataDirection, PinIds...>::~PortGroup() noexcept
+{
+    Registers::ddrx() &= static_cast<uint8_t>(~PortMask);
+    Registers::portx() &= static_cast<uint8_t>(~PortMask);
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+uint8_t PortGroup<DataDirection, PinIds...>::pinCount() const noexcept { return PinCount; }
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+uint8_t PortGroup<DataDirection, PinIds...>::read() const noexcept
+{
+    return gather(Registers::pinx());
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+void PortGroup<DataDirection, PinIds...>::write(const uint8_t value) noexcept
+{
+    if constexpr (IsOutput)
+    {
+        typename Registers::Register portx{Registers::portx()};
+        portx = static_cast<uint8_t>((portx & ~PortMask) | scatter(value));
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+void PortGroup<DataDirection, PinIds...>::set(const uint8_t mask) noexcept
+{
+    if constexpr (IsOutput) { Registers::portx() |= scatter(mask); }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+void PortGroup<DataDirection, PinIds...>::clear(const uint8_t mask) noexcept
+{
+    if constexpr (IsOutput) { Registers::portx() &= static_cast<uint8_t>(~scatter(mask)); }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+void PortGroup<DataDirection, PinIds...>::toggle(const uint8_t mask) noexcept
+{
+    // The hardware will toggle the outputs when writing to the pin register.
+    if constexpr (IsOutput) { Registers::pinx() = scatter(mask); }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+constexpr uint8_t PortGroup<DataDirection, PinIds...>::scatter(const uint8_t value) noexcept
+{
+    if constexpr (isContiguous()) { return static_cast<uint8_t>((value << Pins[0U]) & PortMask); }
+    else
+    {
+        uint8_t portValue{};
+
+        for (uint8_t i{}; i < PinCount; ++i)
+        {
+            if (value & (1U << i)) { portValue |= static_cast<uint8_t>(1U << Pins[i]); }
+        }
+        return portValue;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+constexpr uint8_t PortGroup<DataDirection, PinIds...>::gather(const uint8_t portValue) noexcept
+{
+    if constexpr (isContiguous()) 
+    { 
+        return static_cast<uint8_t>((portValue & PortMask) >> Pins[0U]); 
+    }
+    else
+    {
+        uint8_t value{};
+
+        for (uint8_t i{}; i < PinCount; ++i)
+        {
+            if (portValue & (1U << Pins[i])) { value |= static_cast<uint8_t>(1U << i); }
+        }
+        return value;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <Direction DataDirection, uint8_t... PinIds>
+constexpr bool PortGroup<DataDirection, PinIds...>::isContiguous() noexcept
+{
+    for (uint8_t i{1U}; i < PinCount; ++i)
+    {
+        if (Pins[i] != Pins[0U] + i) { return false; }
+    }
+    return true;
+}
+} // namespace gpio
+} // namespace driver
@@ -0,0 +1,59 @@
+/**
+ * @brief Implementation details of the compile-time GPIO pin and register mapping.
+ *
+ * @note Don't include this header, use <port_map.h> instead!
+ */
+#pragma once
+
+#include "arch/avr/hw_platform.h"
+
+namespace driver
+{
+namespace gpio
+{
+// -----------------------------------------------------------------------------
+template <Atmega328p::IoPort IoPort>
+inline typename PortRegisters<IoPort>::Register PortRegisters<IoPort>::ddrx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == IoPort) { return DDRB; }
+    else if constexpr (Atmega328p::IoPort::C == IoPort) { return DDRC; }
+    else { return DDRD; }
+}
+
+// -----------------------------------------------------------------------------
+template <Atmega328p::IoPort IoPort>
+inline typename PortRegisters<IoPort>::Register PortRegisters<IoPort>::portx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == IoPort) { return PORTB; }
+    else if constexpr (Atmega328p::IoPort::C == IoPort) { return PORTC; }
+    else { return PORTD; }
+}
+
+// -----------------------------------------------------------------------------
+template <Atmega328p::IoPort IoPort>
+inline typename PortRegisters<IoPort>::Register PortRegisters<IoPort>::pinx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == IoPort) { return PINB; }
+    else if constexpr (Atmega328p::IoPort::C == IoPort) { return PINC; }
+    else { return PIND; }
+}
+
+// -----------------------------------------------------------------------------
+template <Atmega328p::IoPort IoPort>
+inline typename PortRegisters<IoPort>::Register PortRegisters<IoPort>::pcmskx() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == IoPort) { return PCMSK0; }
+    else if constexpr (Atmega328p::IoPort::C == IoPort) { return PCMSK1; }
+    else { return PCMSK2; }
+}
+
+// -----------------------------------------------------------------------------
+template <Atmega328p::IoPort IoPort>
+inline uint8_t PortRegisters<IoPort>::pcix() noexcept
+{
+    if constexpr (Atmega328p::IoPort::B == IoPort) { return PCIE0; }
+    else if constexpr (Atmega328p::IoPort::C == IoPort) { return PCIE1; }
+    else { return PCIE2; }
+}
+} // namespace gpio
+} // namespace driver
@@ -0,0 +1,211 @@
+/**
+ * @brief GPIO pins resolved at compile time for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/interface.h"
+#include "driver/gpio/port_map.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief GPIO pin resolved at compile time.
+ *
+ *        The registers and the bit mask of the pin are resolved at compile time and all member
+ *        functions are non-virtual, so each operation compiles to a single I/O instruction on
+ *        the target, e.g. toggle() compiles to one SBI instruction. The pin holds no data.
+ *
+ *        The pin isn't registered by the GPIO driver and must not be used by other GPIO
+ *        instances. Pin change interrupts can be enabled, but callbacks are only supported by
+ *        the GPIO driver, see Atmega328p::setCallback(). Use PinAdapter where the pin must be
+ *        used through the GPIO interface.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam PinId         The pin number of the GPIO, see Atmega328p::Port.
+ * @tparam DataDirection The data direction of the GPIO.
+ */
+template <uint8_t PinId, Direction DataDirection>
+class Pin final
+{
+    static_assert(Direction::Count > DataDirection, "Invalid data direction!");
+
+public:
+    /** The I/O port of the pin. */
+    static constexpr Atmega328p::IoPort IoPort{PinMap<PinId>::IoPort};
+
+    /** Bit mask of the pin in the port registers. */
+    static constexpr uint8_t Mask{PinMap<PinId>::Mask};
+
+    /**
+     * @brief Constructor, set the data direction of the pin.
+     */
+    Pin() noexcept;
+
+    /**
+     * @brief Destructor, reset the pin to a tri-state input.
+     */
+    ~Pin() noexcept;
+
+    /**
+     * @brief Get the data direction of the GPIO.
+     * 
+     * @return The data direction of the GPIO.
+     */
+    static constexpr Direction direction() noexcept;
+
+    /**
+     * @brief Read input of the GPIO.
+     * 
+     * @return True if the input is high, false otherwise.
+     */
+    bool read() const noexcept;
+
+    /**
+     * @brief Write output to the GPIO.
+     * 
+     * @param[in] output The output value to write (true = high, false = low).
+     * 
+     * @note This operation is only supported for pins set to output.
+     */
+    void write(bool output) noexcept;
+
+    /**
+     * @brief Set the output of the GPIO high.
+     * 
+     * @note This operation is only supported for pins set to output.
+     */
+    void set() noexcept;
+
+    /**
+     * @brief Set the output of the GPIO low.
+     * 
+     * @note This operation is only supported for pins set to output.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Toggle the output of the GPIO.
+     * 
+     * @note This operation is only supported for pins set to output.
+     */
+    void toggle() noexcept;
+
+    /**
+     * @brief Enable/disable pin change interrupt for the GPIO.
+     * 
+     * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
+     */
+    void enableInterrupt(bool enable) noexcept;
+
+    /**
+     * @brief Enable pin change interrupt for I/O port associated with the GPIO.
+     * 
+     * @param[in] enable True to enable pin change interrupt for the I/O port, false otherwise.
+     */
+    void enableInterruptOnPort(bool enable) noexcept;
+
+    Pin(const Pin&)            = delete; // No copy constructor.
+    Pin(Pin&&)                 = delete; // No move constructor.
+    Pin& operator=(const Pin&) = delete; // No copy assignment.
+    Pin& operator=(Pin&&)      = delete; // No move assignment.
+
+private:
+    /** Registers of the I/O port. */
+    using Registers = PortRegisters<IoPort>;
+
+    /** Indicate whether the pin is an output. */
+    static constexpr bool IsOutput{Direction::Output == DataDirection};
+};
+
+/**
+ * @brief Adapter making a compile-time GPIO pin usable through the GPIO interface.
+ *
+ *        Each call costs one virtual call on top of the operation of the pin itself, but no
+ *        runtime lookup of the registers.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam PinId         The pin number of the GPIO, see Atmega328p::Port.
+ * @tparam DataDirection The data direction of the GPIO.
+ */
+template <uint8_t PinId, Direction DataDirection>
+class PinAdapter final : public Interface
+{
+public:
+    /**
+     * @brief Constructor, set the data direction of the pin.
+     */
+    PinAdapter() noexcept = default;
+
+    /**
+     * @brief Destructor, reset the pin to a tri-state input.
+     */
+    ~PinAdapter() noexcept override = default;
+
+    /**
+     * @brief Check whether the GPIO is initialized.
+     * 
+     *        Compile-time pins are always initialized, since invalid pins don't compile.
+     * 
+     * @return True.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Get the data direction of the GPIO.
+     * 
+     * @return The data direction of the GPIO.
+     */
+    Direction direction() const noexcept override;
+
+    /**
+     * @brief Read input of the GPIO.
+     * 
+     * @return True if the input is high, false otherwise.
+     */
+    bool read() const noexcept override;
+
+    /**
+     * @brief Write output to the GPIO.
+     * 
+     * @param[in] output The output value to write (true = high, false = low).
+     */
+    void write(bool output) noexcept override;
+
+    /**
+     * @brief Toggle the output of the GPIO.
+     */
+    void toggle() noexcept override;
+
+    /**
+     * @brief Enable/disable pin change interrupt for the GPIO.
+     * 
+     * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
+     */
+    void enableInterrupt(bool enable) noexcept override;
+
+    /**
+     * @brief Enable pin change interrupt for I/O port associated with the GPIO.
+     * 
+     * @param[in] enable True to enable pin change interrupt for the I/O port, false otherwise.
+     */
+    void enableInterruptOnPort(bool enable) noexcept override;
+
+    PinAdapter(const PinAdapter&)            = delete; // No copy constructor.
+    PinAdapter(PinAdapter&&)                 = delete; // No move constructor.
+    PinAdapter& operator=(const PinAdapter&) = delete; // No copy assignment.
+    PinAdapter& operator=(PinAdapter&&)      = delete; // No move assignment.
+
+private:
+    /** The adapted pin. */
+    Pin<PinId, DataDirection> myPin;
+};
+} // namespace gpio
+} // namespace driver
+
+#include "impl/pin_impl.h"
@@ -0,0 +1,154 @@
+/**
+ * @brief Groups of GPIO pins on the same I/O port, accessed with single register operations.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/interface.h"
+#include "driver/gpio/port_group_interface.h"
+#include "driver/gpio/port_map.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief Group of GPIO pins on the same I/O port.
+ *
+ *        The pin map is resolved at compile time, so each operation compiles to a single access
+ *        of the port registers, instead of one driver call per pin. Values are packed into and
+ *        unpacked from the pin positions at compile time as well; if the pins are contiguous
+ *        and in ascending order, this is a single shift.
+ *
+ *        The pins aren't registered by the GPIO driver and must not be used by other GPIO
+ *        instances. Writing and setting/clearing pins is a read-modify-write of the port
+ *        register, which must not be interrupted by an interrupt handler writing the same port.
+ *        Toggling is done via the pin register and is always safe.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam DataDirection The data direction of the pins.
+ * @tparam PinIds        The pin numbers of the pins in the group, see Atmega328p::Port.
+ *                       The first pin corresponds to bit 0 of the values read and written.
+ */
+template <Direction DataDirection, uint8_t... PinIds>
+class PortGroup final : public PortGroupInterface
+{
+    static_assert(0U < sizeof...(PinIds), "The group must contain at least one pin!");
+    static_assert(Direction::Count > DataDirection, "Invalid data direction!");
+
+public:
+    /** The I/O port of the group (taken from the last pin, all pins are on the same port). */
+    static constexpr Atmega328p::IoPort IoPort{PinMap<(PinIds, ...)>::IoPort};
+
+    static_assert(((PinMap<PinIds>::IoPort == IoPort) && ...),
+                  "All pins in the group must belong to the same I/O port!");
+
+    /** The number of pins in the group. */
+    static constexpr uint8_t PinCount{static_cast<uint8_t>(sizeof...(PinIds))};
+
+    /** Mask of the pins in the port registers. */
+    static constexpr uint8_t PortMask{(PinMap<PinIds>::Mask | ...)};
+
+    static_assert(PinCount == __builtin_popcount(PortMask), "Duplicate pins in the group!");
+
+    /**
+     * @brief Constructor, set the data direction of the pins.
+     */
+    PortGroup() noexcept;
+
+    /**
+     * @brief Destructor, reset the pins to tri-state inputs.
+     */
+    ~PortGroup() noexcept override;
+
+    /**
+     * @brief Get the number of pins in the group.
+     *
+     * @return The number of pins in the group.
+     */
+    uint8_t pinCount() const noexcept override;
+
+    /**
+     * @brief Read the input of the pins in the group.
+     *
+     * @return The packed pin states (1 = high, 0 = low).
+     */
+    uint8_t read() const noexcept override;
+
+    /**
+     * @brief Write output to the pins in the group.
+     *
+     * @param[in] value The packed output values (1 = high, 0 = low).
+     *
+     * @note This operation is only supported for output groups.
+     */
+    void write(uint8_t value) noexcept override;
+
+    /**
+     * @brief Set the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to set.
+     *
+     * @note This operation is only supported for output groups.
+     */
+    void set(uint8_t mask) noexcept override;
+
+    /**
+     * @brief Clear the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to clear.
+     *
+     * @note This operation is only supported for output groups.
+     */
+    void clear(uint8_t mask) noexcept override;
+
+    /**
+     * @brief Toggle the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to toggle.
+     *
+     * @note This operation is only supported for output groups.
+     */
+    void toggle(uint8_t mask) noexcept override;
+
+    /**
+     * @brief Scatter packed value to the pin positions in the port registers.
+     *
+     * @param[in] value The packed value.
+     *
+     * @return The value at the pin positions of the port registers.
+     */
+    static constexpr uint8_t scatter(uint8_t value) noexcept;
+
+    /**
+     * @brief Gather the pin positions of a port register value into a packed value.
+     *
+     * @param[in] portValue The port register value.
+     *
+     * @return The packed value.
+     */
+    static constexpr uint8_t gather(uint8_t portValue) noexcept;
+
+    PortGroup(const PortGroup&)            = delete; // No copy constructor.
+    PortGroup(PortGroup&&)                 = delete; // No move constructor.
+    PortGroup& operator=(const PortGroup&) = delete; // No copy assignment.
+    PortGroup& operator=(PortGroup&&)      = delete; // No move assignment.
+
+private:
+    /** Registers of the I/O port. */
+    using Registers = PortRegisters<IoPort>;
+
+    static constexpr bool isContiguous() noexcept;
+
+    /** The physical pins of the group, in group order. */
+    static constexpr uint8_t Pins[]{PinMap<PinIds>::Pin...};
+
+    /** Indicate whether the group consists of output pins. */
+    static constexpr bool IsOutput{Direction::Output == DataDirection};
+};
+} // namespace gpio
+} // namespace driver
+
+#include "impl/port_group_impl.h"
@@ -0,0 +1,69 @@
+/**
+ * @brief Interface for groups of GPIO pins on the same I/O port.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief Interface for groups of GPIO pins on the same I/O port.
+ *
+ *        The pins of a group are read and written together, i.e. with a single register access.
+ *        Values are packed: bit i of a value corresponds to the i:th pin of the group.
+ */
+class PortGroupInterface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PortGroupInterface() noexcept = default;
+
+    /**
+     * @brief Get the number of pins in the group.
+     *
+     * @return The number of pins in the group.
+     */
+    virtual uint8_t pinCount() const noexcept = 0;
+
+    /**
+     * @brief Read the input of the pins in the group.
+     *
+     * @return The packed pin states (1 = high, 0 = low).
+     */
+    virtual uint8_t read() const noexcept = 0;
+
+    /**
+     * @brief Write output to the pins in the group.
+     *
+     * @param[in] value The packed output values (1 = high, 0 = low).
+     */
+    virtual void write(uint8_t value) noexcept = 0;
+
+    /**
+     * @brief Set the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to set.
+     */
+    virtual void set(uint8_t mask) noexcept = 0;
+
+    /**
+     * @brief Clear the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to clear.
+     */
+    virtual void clear(uint8_t mask) noexcept = 0;
+
+    /**
+     * @brief Toggle the output of the given pins in the group.
+     *
+     * @param[in] mask Packed mask of the pins to toggle.
+     */
+    virtual void toggle(uint8_t mask) noexcept = 0;
+};
+} // namespace gpio
+} // namespace driver
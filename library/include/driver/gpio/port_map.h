@@ -0,0 +1,102 @@
+/**
+ * @brief Compile-time mapping of GPIO pins to I/O ports and registers for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief Compile-time mapping of a GPIO pin to its I/O port and physical pin.
+ *
+ * @tparam PinId The pin number of the GPIO, see Atmega328p::Port.
+ */
+template <uint8_t PinId>
+struct PinMap final
+{
+    static_assert(PinId <= Atmega328p::Port::C5, "Invalid GPIO pin!");
+
+    /** The I/O port the pin is associated with. */
+    static constexpr Atmega328p::IoPort IoPort{
+        PinId <= Atmega328p::Port::D7   ? Atmega328p::IoPort::D
+        : PinId <= Atmega328p::Port::B5 ? Atmega328p::IoPort::B
+                                        : Atmega328p::IoPort::C};
+
+    /** The physical pin, i.e. the bit in the registers of the I/O port. */
+    static constexpr uint8_t Pin{
+        IoPort == Atmega328p::IoPort::D   ? PinId
+        : IoPort == Atmega328p::IoPort::B ? PinId - Atmega328p::Port::B0
+                                          : PinId - Atmega328p::Port::C0};
+
+    /** Bit mask of the pin. */
+    static constexpr uint8_t Mask{static_cast<uint8_t>(1U << Pin)};
+};
+
+/**
+ * @brief Registers of an I/O port, resolved at compile time.
+ *
+ *        Since the register addresses are known at compile time, accesses via this structure
+ *        compile to single I/O instructions (IN, OUT, SBI, CBI) on the target.
+ *
+ * @tparam IoPort The I/O port.
+ */
+template <Atmega328p::IoPort IoPort>
+struct PortRegisters final
+{
+    static_assert(IoPort < Atmega328p::IoPort::Count, "Invalid I/O port!");
+
+#ifdef TESTSUITE
+    /** Register reference, a proxy counting the accesses in the test suite. */
+    using Register = test::Register;
+#else
+    /** Register reference. */
+    using Register = volatile uint8_t&;
+#endif
+
+    /**
+     * @brief Get the data direction register (DDRx) of the I/O port.
+     *
+     * @return Reference to the data direction register.
+     */
+    static Register ddrx() noexcept;
+
+    /**
+     * @brief Get the port register (PORTx) of the I/O port.
+     *
+     * @return Reference to the port register.
+     */
+    static Register portx() noexcept;
+
+    /**
+     * @brief Get the pin register (PINx) of the I/O port.
+     *
+     *        Writing ones to the pin register toggles the corresponding outputs.
+     *
+     * @return Reference to the pin register.
+     */
+    static Register pinx() noexcept;
+
+    /**
+     * @brief Get the pin change interrupt mask register (PCMSKx) of the I/O port.
+     *
+     * @return Reference to the pin change interrupt mask register.
+     */
+    static Register pcmskx() noexcept;
+
+    /**
+     * @brief Get the control bit of the I/O port in the pin change interrupt control register.
+     *
+     * @return The control bit (PCIEx).
+     */
+    static uint8_t pcix() noexcept;
+};
+} // namespace gpio
+} // namespace driver
+
+#include "impl/port_map_impl.h"
@@ -0,0 +1,152 @@
+/**
+ * @brief Hardware PWM driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/pwm/interface.h"
+
+namespace driver
+{
+namespace pwm
+{
+/** PWM hardware structure. */
+struct Hardware;
+
+/**
+ * @brief Hardware PWM driver for ATmega328P.
+ * 
+ *        The PWM signal is generated by the output compare units of the hardware timers, hence 
+ *        it costs no CPU time once configured. The following pins are supported:
+ * 
+ *        - Timer 0: pin 6 (OC0A) and pin 5 (OC0B), frequency selected by prescaler.
+ * 
+ *        - Timer 1: pin 9 (OC1A) and pin 10 (OC1B), any frequency from 1 Hz up to 62.5 kHz 
+ *          (fast mode) with at least 8-bit resolution.
+ * 
+ *        - Timer 2: pin 11 (OC2A) and pin 3 (OC2B), frequency selected by prescaler.
+ * 
+ *        The timer circuit is reserved while any of its outputs exists, so it can't be used by 
+ *        the timer driver simultaneously. Both outputs of a timer share its mode and frequency, 
+ *        i.e. setting the frequency of one output also changes the frequency of the other one.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /**
+     * @brief Enumeration of PWM modes.
+     */
+    enum class Mode : uint8_t
+    {
+        Fast,         // Fast PWM, highest frequency.
+        PhaseCorrect, // Phase correct PWM, symmetric pulses for motor control.
+        Count,        // The number of supported modes.
+    };
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] pin The pin number of the PWM output, see the class description.
+     * @param[in] frequency_hz The frequency in Hz (default = 1 kHz).
+     * @param[in] mode The PWM mode (default = fast PWM). Must match the mode of the other 
+     *                 output of the timer, if any.
+     */
+    explicit Atmega328p(uint8_t pin, uint32_t frequency_hz = 1000U, 
+                        Mode mode = Mode::Fast) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Atmega328p() noexcept override;
+
+    /**
+     * @brief Check whether the PWM output is initialized.
+     * 
+     *        An uninitialized output indicates that the specified pin doesn't support PWM, 
+     *        that the pin or the timer circuit was reserved, or that the mode or frequency
+     *        was invalid.
+     * 
+     * @return True if the output is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the PWM output is enabled.
+     * 
+     * @return True if the output is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Enable/disable the PWM output. Disabled outputs are held low.
+     * 
+     * @param[in] enable True to enable the output, false otherwise.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Get the duty cycle of the PWM output.
+     * 
+     * @return The duty cycle (0 = always low, 255 = always high).
+     */
+    uint8_t dutyCycle() const noexcept override;
+
+    /**
+     * @brief Set the duty cycle of the PWM output.
+     * 
+     * @param[in] dutyCycle The new duty cycle (0 = always low, 255 = always high).
+     */
+    void setDutyCycle(uint8_t dutyCycle) noexcept override;
+
+    /**
+     * @brief Get the frequency of the PWM output.
+     * 
+     * @return The frequency in Hz, or 0 if the output isn't initialized.
+     */
+    uint32_t frequency_hz() const noexcept override;
+
+    /**
+     * @brief Set the frequency of the PWM output and the other output of the timer.
+     * 
+     *        The nearest frequency supported by the hardware is used.
+     * 
+     * @param[in] frequency_hz The new frequency in Hz. Must be greater than 0.
+     * 
+     * @return True if the frequency was set, false if it's not supported.
+     */
+    bool setFrequency_hz(uint32_t frequency_hz) noexcept override;
+
+    /**
+     * @brief Get the PWM mode.
+     * 
+     * @return The PWM mode.
+     */
+    Mode mode() const noexcept;
+
+    Atmega328p()                             = delete; // No default constructor.
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    bool initHw(uint32_t frequency_hz) noexcept;
+    void updateOutput() noexcept;
+
+    /** Hardware structure associated with the output, or nullptr if uninitialized. */
+    const Hardware* myHw;
+
+    /** PWM mode. */
+    Mode myMode;
+
+    /** Duty cycle. */
+    uint8_t myDutyCycle;
+
+    /** Indicate whether the output is enabled. */
+    bool myEnabled;
+};
+} // namespace pwm
+} // namespace driver
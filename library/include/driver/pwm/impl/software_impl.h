@@ -0,0 +1,168 @@
+/**
+ * @brief Implementation details of the software PWM engine.
+ *
+ * @note Don't include this header, use <software.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace pwm
+{
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+Software<PeriodTicks, PinIds...>::Software() noexcept
+    : mySchedules{}
+    , myDutyCycles{}
+    , myActive{0U}
+    , myUpdatePending{false}
+    , myTick{0U}
+    , myNextEvent{0U}
+{
+    // Terminate the (empty) schedules, then set the pins to low outputs.
+    for (auto& schedule : mySchedules) { build(schedule); }
+    ((gpio::PortRegisters<gpio::PinMap<PinIds>::IoPort>::portx() &= 
+        static_cast<uint8_t>(~gpio::PinMap<PinIds>::Mask)), ...);
+    ((gpio::PortRegisters<gpio::PinMap<PinIds>::IoPort>::ddrx() |= 
+        gpio::PinMap<PinIds>::Mask), ...);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+Software<PeriodTicks, PinIds...>::~Software() noexcept
+{
+    ((gpio::PortRegisters<gpio::PinMap<PinIds>::IoPort>::ddrx() &= 
+        static_cast<uint8_t>(~gpio::PinMap<PinIds>::Mask)), ...);
+    ((gpio::PortRegisters<gpio::PinMap<PinIds>::IoPort>::portx() &= 
+        static_cast<uint8_t>(~gpio::PinMap<PinIds>::Mask)), ...);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+uint8_t Software<PeriodTicks, PinIds...>::dutyCycle(const uint8_t channel) const noexcept
+{
+    return ChannelCount > channel ? myDutyCycles[channel] : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+bool Software<PeriodTicks, PinIds...>::setDutyCycle(const uint8_t channel, const uint8_t dutyCycle) noexcept
+{
+    if ((ChannelCount <= channel) || (Period < dutyCycle)) { return false; }
+    myDutyCycles[channel] = dutyCycle;
+
+    // Withdraw any pending schedule, so that the interrupt keeps the active schedule while the
+    // other schedule is rebuilt. Then hand the new schedule over to the interrupt.
+    utils::atomicStore(myUpdatePending, false);
+    build(mySchedules[utils::atomicLoad(myActive) ^ 1U]);
+    utils::atomicStore(myUpdatePending, true);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+void Software<PeriodTicks, PinIds...>::tick() noexcept
+{
+    // Switch to the new schedule, if any, and set the pins at the start of each period.
+    // Only the I/O ports in use are accessed, each with a single write.
+    if (0U == myTick)
+    {
+        if (myUpdatePending)
+        {
+            myActive ^= 1U;
+            myUpdatePending = false;
+        }
+        myNextEvent = 0U;
+        startPeriod<gpio::Atmega328p::IoPort::B>(mySchedules[myActive].setMasks);
+        startPeriod<gpio::Atmega328p::IoPort::C>(mySchedules[myActive].setMasks);
+        startPeriod<gpio::Atmega328p::IoPort::D>(mySchedules[myActive].setMasks);
+    }
+
+    // Clear the pins whose duty cycle has elapsed.
+    const Event& event{mySchedules[myActive].events[myNextEvent]};
+
+    if (event.tick == myTick)
+    {
+        clearPins<gpio::Atmega328p::IoPort::B>(event.clearMasks);
+        clearPins<gpio::Atmega328p::IoPort::C>(event.clearMasks);
+        clearPins<gpio::Atmega328p::IoPort::D>(event.clearMasks);
+        myNextEvent++;
+    }
+    myTick = (Period - 1U) > myTick ? myTick + 1U : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+template <gpio::Atmega328p::IoPort IoPort>
+constexpr uint8_t Software<PeriodTicks, PinIds...>::portMask() noexcept
+{
+    return ((IoPort == gpio::PinMap<PinIds>::IoPort ? gpio::PinMap<PinIds>::Mask : 0U) | ...);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+template <gpio::Atmega328p::IoPort IoPort>
+void Software<PeriodTicks, PinIds...>::startPeriod(const uint8_t (&masks)[IoPortCount]) noexcept
+{
+    // Set the pins of the period and clear the other channels with a single write.
+    if constexpr (0U != portMask<IoPort>())
+    {
+        typename gpio::PortRegisters<IoPort>::Register portx{
+            gpio::PortRegisters<IoPort>::portx()};
+        portx = static_cast<uint8_t>((portx & ~portMask<IoPort>()) | 
+                                     masks[static_cast<uint8_t>(IoPort)]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+template <gpio::Atmega328p::IoPort IoPort>
+void Software<PeriodTicks, PinIds...>::clearPins(const uint8_t (&masks)[IoPortCount]) noexcept
+{
+    if constexpr (0U != portMask<IoPort>())
+    {
+        gpio::PortRegisters<IoPort>::portx() &= 
+            static_cast<uint8_t>(~masks[static_cast<uint8_t>(IoPort)]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+void Software<PeriodTicks, PinIds...>::build(Schedule& schedule) const noexcept
+{
+    uint8_t eventCount{};
+
+    for (auto& mask : schedule.setMasks) { mask = 0U; }
+
+    for (uint8_t channel{}; channel < ChannelCount; ++channel)
+    {
+        const uint8_t dutyCycle{myDutyCycles[channel]};
+        const uint8_t port{PortIndexes[channel]};
+
+        // Channels always low are never set, channels always high are never cleared.
+        if (0U == dutyCycle) { continue; }
+        schedule.setMasks[port] |= PinMasks[channel];
+        if (Period == dutyCycle) { continue; }
+
+        // Find the event of the duty cycle, insert a new event in sorted order if none exists.
+        uint8_t i{};
+        while ((i < eventCount) && (schedule.events[i].tick < dutyCycle)) { ++i; }
+
+        if ((i == eventCount) || (schedule.events[i].tick != dutyCycle))
+        {
+            for (uint8_t j{eventCount}; j > i; --j) 
+            { 
+                schedule.events[j] = schedule.events[j - 1U]; 
+            }
+            schedule.events[i] = Event{dutyCycle, {}};
+            eventCount++;
+        }
+        schedule.events[i].clearMasks[port] |= PinMasks[channel];
+    }
+    // Terminate the schedule with an event that is never reached.
+    schedule.events[eventCount] = Event{Period, {}};
+}
+} // namespace pwm
+} // namespace driver
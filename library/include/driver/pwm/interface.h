@@ -0,0 +1,80 @@
+/**
+ * @brief PWM interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief PWM interface.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check whether the PWM output is initialized.
+     * 
+     *        An uninitialized output indicates that the specified pin or the associated 
+     *        hardware was unavailable when the output was created.
+     * 
+     * @return True if the output is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Check whether the PWM output is enabled.
+     * 
+     * @return True if the output is enabled, false otherwise.
+     */
+    virtual bool isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Enable/disable the PWM output. Disabled outputs are held low.
+     * 
+     * @param[in] enable True to enable the output, false otherwise.
+     */
+    virtual void setEnabled(bool enable) noexcept = 0;
+
+    /**
+     * @brief Get the duty cycle of the PWM output.
+     * 
+     * @return The duty cycle (0 = always low, 255 = always high).
+     */
+    virtual uint8_t dutyCycle() const noexcept = 0;
+
+    /**
+     * @brief Set the duty cycle of the PWM output.
+     * 
+     * @param[in] dutyCycle The new duty cycle (0 = always low, 255 = always high).
+     */
+    virtual void setDutyCycle(uint8_t dutyCycle) noexcept = 0;
+
+    /**
+     * @brief Get the frequency of the PWM output.
+     * 
+     * @return The frequency in Hz.
+     */
+    virtual uint32_t frequency_hz() const noexcept = 0;
+
+    /**
+     * @brief Set the frequency of the PWM output.
+     * 
+     *        The nearest frequency supported by the hardware is used.
+     * 
+     * @param[in] frequency_hz The new frequency in Hz. Must be greater than 0.
+     * 
+     * @return True if the frequency was set, false if it's not supported.
+     */
+    virtual bool setFrequency_hz(uint32_t frequency_hz) noexcept = 0;
+};
+} // namespace pwm
+} // namespace driver
@@ -0,0 +1,161 @@
+/**
+ * @brief Software PWM engine for GPIO outputs.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/port_map.h"
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief Software PWM engine for GPIO outputs, driven by a timer interrupt.
+ *
+ *        A PWM period consists of a configurable number of ticks, which is also the resolution
+ *        of the duty cycles; a channel with duty cycle d is high during the first d ticks. 
+ *        The pins are written at the start of each period and cleared at the tick matching 
+ *        their duty cycle.
+ *
+ *        The duty cycles are compiled into a schedule of port masks when updated, so that each 
+ *        tick costs at most one write per I/O port in use, regardless of the number of 
+ *        channels. New schedules take effect at the start of the next period, hence the 
+ *        outputs never glitch.
+ *
+ *        Bind tick() to a timer interrupt, e.g. via timer::Atmega328p::setInterruptHandler().
+ *        The PWM frequency is the tick rate divided by the period. Outputs driving LEDs need
+ *        at least 100 Hz not to flicker, which limits the period to 78 ticks at the 0.128 ms 
+ *        interrupt of the timer driver (about 100 Hz with 79 brightness levels). Full 8-bit
+ *        resolution requires a tick of about 39 us, which the timer driver doesn't provide.
+ *
+ *        The pins aren't registered by the GPIO driver and must not be used by other GPIO
+ *        instances. This class is non-copyable and non-movable.
+ *
+ * @tparam PeriodTicks The number of ticks per PWM period (1 - 255).
+ * @tparam PinIds      The pin numbers of the channels, see gpio::Atmega328p::Port. The first 
+ *                     pin is channel 0. Up to 16 pins are supported.
+ */
+template <uint8_t PeriodTicks, uint8_t... PinIds>
+class Software final
+{
+    static_assert(0U < PeriodTicks, "The PWM period must contain at least one tick!");
+    static_assert(0U < sizeof...(PinIds), "The engine must contain at least one channel!");
+    static_assert(16U >= sizeof...(PinIds), "The engine supports up to 16 channels!");
+
+public:
+    /** The number of channels. */
+    static constexpr uint8_t ChannelCount{static_cast<uint8_t>(sizeof...(PinIds))};
+
+    /** The number of ticks per PWM period, i.e. the duty cycle of a channel always on. */
+    static constexpr uint8_t Period{PeriodTicks};
+
+    /**
+     * @brief Constructor, set the pins to low outputs with a duty cycle of 0.
+     */
+    Software() noexcept;
+
+    /**
+     * @brief Destructor, reset the pins to tri-state inputs.
+     */
+    ~Software() noexcept;
+
+    /**
+     * @brief Get the duty cycle of a channel.
+     *
+     * @param[in] channel The channel.
+     *
+     * @return The duty cycle of the channel (0 - Period), or 0 if the channel is invalid.
+     */
+    uint8_t dutyCycle(uint8_t channel) const noexcept;
+
+    /**
+     * @brief Set the duty cycle of a channel.
+     *
+     *        The new duty cycle takes effect at the start of the next PWM period.
+     *
+     * @param[in] channel The channel.
+     * @param[in] dutyCycle The new duty cycle (0 = always low, Period = always high).
+     *
+     * @return True if the duty cycle was set, false if the channel or duty cycle is invalid.
+     */
+    bool setDutyCycle(uint8_t channel, uint8_t dutyCycle) noexcept;
+
+    /**
+     * @brief Advance the engine one tick, updating the outputs.
+     *
+     *        Call this function from a timer interrupt.
+     */
+    void tick() noexcept;
+
+    Software(const Software&)            = delete; // No copy constructor.
+    Software(Software&&)                 = delete; // No move constructor.
+    Software& operator=(const Software&) = delete; // No copy assignment.
+    Software& operator=(Software&&)      = delete; // No move assignment.
+
+private:
+    /** The number of I/O ports. */
+    static constexpr uint8_t IoPortCount{static_cast<uint8_t>(gpio::Atmega328p::IoPort::Count)};
+
+    /**
+     * @brief Event clearing pins at a given tick.
+     */
+    struct Event
+    {
+        /** The tick at which the pins are cleared. */
+        uint8_t tick;
+
+        /** Masks of the pins to clear on each I/O port. */
+        uint8_t clearMasks[IoPortCount];
+    };
+
+    /**
+     * @brief Schedule of the outputs of a PWM period.
+     */
+    struct Schedule
+    {
+        /** Masks of the pins to set at the start of the period on each I/O port. */
+        uint8_t setMasks[IoPortCount];
+
+        /** Events sorted by tick, terminated by an event at tick Period (never reached). */
+        Event events[ChannelCount + 1U];
+    };
+
+    template <gpio::Atmega328p::IoPort IoPort>
+    static constexpr uint8_t portMask() noexcept;
+    template <gpio::Atmega328p::IoPort IoPort>
+    static void startPeriod(const uint8_t (&masks)[IoPortCount]) noexcept;
+    template <gpio::Atmega328p::IoPort IoPort>
+    static void clearPins(const uint8_t (&masks)[IoPortCount]) noexcept;
+    void build(Schedule& schedule) const noexcept;
+
+    /** I/O port index of each channel. */
+    static constexpr uint8_t PortIndexes[]{
+        static_cast<uint8_t>(gpio::PinMap<PinIds>::IoPort)...};
+
+    /** Port mask of each channel. */
+    static constexpr uint8_t PinMasks[]{gpio::PinMap<PinIds>::Mask...};
+
+    /** Double-buffered schedules, one used by the interrupt and one for updates. */
+    Schedule mySchedules[2U];
+
+    /** Duty cycle of each channel. */
+    uint8_t myDutyCycles[ChannelCount];
+
+    /** Index of the schedule used by the interrupt. */
+    uint8_t myActive;
+
+    /** Indicate whether the other schedule shall be used from the next period. */
+    bool myUpdatePending;
+
+    /** The current tick of the PWM period. */
+    uint8_t myTick;
+
+    /** Index of the next event of the active schedule. */
+    uint8_t myNextEvent;
+};
+} // namespace pwm
+} // namespace driver
+
+#include "impl/software_impl.h"
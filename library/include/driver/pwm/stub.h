@@ -0,0 +1,94 @@
+/**
+ * @brief PWM stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/pwm/interface.h"
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief PWM stub.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Stub() noexcept
+        : myFrequency_hz{1000U}
+        , myDutyCycle{0U}
+        , myInitialized{true}
+        , myEnabled{false}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check whether the PWM output is initialized.
+     */
+    bool isInitialized() const noexcept override { return myInitialized; }
+
+    /**
+     * @brief Check whether the PWM output is enabled.
+     */
+    bool isEnabled() const noexcept override { return myEnabled; }
+
+    /**
+     * @brief Enable/disable the PWM output.
+     */
+    void setEnabled(const bool enable) noexcept override { myEnabled = enable; }
+
+    /**
+     * @brief Get the duty cycle of the PWM output.
+     */
+    uint8_t dutyCycle() const noexcept override { return myDutyCycle; }
+
+    /**
+     * @brief Set the duty cycle of the PWM output.
+     */
+    void setDutyCycle(const uint8_t dutyCycle) noexcept override { myDutyCycle = dutyCycle; }
+
+    /**
+     * @brief Get the frequency of the PWM output.
+     */
+    uint32_t frequency_hz() const noexcept override { return myFrequency_hz; }
+
+    /**
+     * @brief Set the frequency of the PWM output.
+     */
+    bool setFrequency_hz(const uint32_t frequency_hz) noexcept override
+    {
+        if (0U == frequency_hz) { return false; }
+        myFrequency_hz = frequency_hz;
+        return true;
+    }
+
+    /**
+     * @brief Set the initialization state of the PWM output.
+     */
+    void setInitialized(const bool initialized) noexcept { myInitialized = initialized; }
+
+private:
+    /** The frequency in Hz. */
+    uint32_t myFrequency_hz;
+
+    /** The duty cycle. */
+    uint8_t myDutyCycle;
+
+    /** Indicate whether the output is initialized. */
+    bool myInitialized;
+
+    /** Indicate whether the output is enabled. */
+    bool myEnabled;
+};
+} // namespace pwm
+} // namespace driver
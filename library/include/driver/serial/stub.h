@@ -86,6 +86,13 @@ public:
         // Copy contents from the simulated read buffer to given read buffer.
         for (uint16_t i{}; i < bytesToRead; ++i) { buffer[i] = myReadBuffer[i]; }
 
+        // Remove the read bytes, like a real receiver does.
+        for (uint16_t i{bytesToRead}; i < storedBytes; ++i)
+        {
+            myReadBuffer[i - bytesToRead] = myReadBuffer[i];
+        }
+        myReadBuffer.resize(storedBytes - bytesToRead);
+
         // Return the number of bytes read.
         return static_cast<int16_t>(bytesToRead);
     }
@@ -154,8 +161,8 @@ public:
     Stub& operator=(Stub&&)      = delete; // No move assignment.
 
 private:
-    /** Simulated read buffer. */
-    container::Vector<uint8_t> myReadBuffer;
+    /** Simulated read buffer, emptied as the data is read. */
+    mutable container::Vector<uint8_t> myReadBuffer;
 
     /** Baud rate in bps (bits per second). */
     const uint32_t myBaudRate_bps;
@@ -0,0 +1,145 @@
+/**
+ * @brief Caching temperature sensor decorator.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+#include "profiler/clock.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+/**
+ * @brief Caching temperature sensor decorator.
+ *
+ *        Wraps another temperature sensor and returns the last reading, which is refreshed in
+ *        the main loop via update() once it's older than the configured max age. Hence read()
+ *        never blocks on a conversion, except for the very first reading. An expired reading
+ *        is still returned until the next update().
+ *
+ *        The age of the reading is measured by a free-running clock, by default the CPU cycle
+ *        count of profiler::clock, which must be started beforehand. The clock wraps around, 
+ *        hence update() must be called more often than the wrap period (~268 s at 16 MHz).
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Cached final : public Interface
+{
+public:
+    /** Clock measuring the age of the cached temperature, returning the current tick. */
+    using Clock = uint32_t (*)() noexcept;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] sensor The temperature sensor to read from.
+     * @param[in] maxAge The max age of a cached reading in clock ticks.
+     * @param[in] clock The clock measuring the age (default = CPU cycles of profiler::clock).
+     */
+    explicit Cached(Interface& sensor, uint32_t maxAge, 
+                    Clock clock = profiler::clock::cycles) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Cached() noexcept override = default;
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     *
+     * @return True if the temperature sensor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Read the temperature sensor.
+     *
+     *        The cached temperature is returned without blocking, even if it has expired; 
+     *        an expired temperature is refreshed by the next update(). Only the first reading
+     *        is taken from the underlying sensor directly, since nothing is cached yet.
+     *
+     * @return The temperature in degrees Celsius.
+     */
+    int16_t read() const noexcept override;
+
+    /**
+     * @brief Refresh the cached temperature if it has expired.
+     *
+     *        Called from the main loop, so the blocking conversion is kept out of event handlers.
+     *
+     * @return True if the cache was refreshed, false otherwise.
+     */
+    bool update() noexcept override;
+
+    /**
+     * @brief Check whether the cached temperature is younger than the max age.
+     *
+     * @return True if the cached temperature is valid, false otherwise.
+     */
+    bool isValid() const noexcept;
+
+    /**
+     * @brief Expire the cached temperature, forcing a refresh on next update.
+     */
+    void invalidate() noexcept;
+
+    /**
+     * @brief Get the number of reads served with a valid temperature.
+     *
+     * @return The number of cache hits.
+     */
+    uint32_t hitCount() const noexcept;
+
+    /**
+     * @brief Get the number of reads served with an expired or a new temperature.
+     *
+     * @return The number of cache misses.
+     */
+    uint32_t missCount() const noexcept;
+
+    /**
+     * @brief Reset the hit and miss counters.
+     */
+    void resetCounters() noexcept;
+
+    Cached()                         = delete; // No default constructor.
+    Cached(const Cached&)            = delete; // No copy constructor.
+    Cached(Cached&&)                 = delete; // No move constructor.
+    Cached& operator=(const Cached&) = delete; // No copy assignment.
+    Cached& operator=(Cached&&)      = delete; // No move assignment.
+
+private:
+    int16_t refresh() const noexcept;
+
+    /** The temperature sensor to read from. */
+    Interface& mySensor;
+
+    /** The clock measuring the age of the cached temperature. */
+    const Clock myClock;
+
+    /** The max age of a cached reading in clock ticks. */
+    const uint32_t myMaxAge;
+
+    /** The clock tick of the last reading. */
+    mutable uint32_t myTimestamp;
+
+    /** The number of cache hits. */
+    mutable uint32_t myHitCount;
+
+    /** The number of cache misses. */
+    mutable uint32_t myMissCount;
+
+    /** The last temperature read from the sensor. */
+    mutable int16_t myTemperature;
+
+    /** Indicate whether a temperature has been read. */
+    mutable bool myHasReading;
+
+    /** Indicate whether the cached temperature has been expired manually. */
+    mutable bool myInvalidated;
+};
+} // namespace tempsensor
+} // namespace driver
@@ -33,6 +33,15 @@ public:
      * @return The temperature in degrees Celsius.
      */
     virtual int16_t read() const noexcept = 0;
+
+    /**
+     * @brief Perform pending work of the temperature sensor, such as refreshing a cached reading.
+     *
+     *        Called regularly from the main loop. Sensors without pending work do nothing.
+     *
+     * @return True if any work was performed, false otherwise.
+     */
+    virtual bool update() noexcept { return false; }
 };
 } // namespace tempsensor
 } // namespace driver
@@ -6,6 +6,7 @@
 #include <stdint.h>
 
 #include "driver/timer/interface.h"
+#include "utils/delegate.h"
 
 namespace driver 
 {
@@ -25,10 +26,11 @@ public:
      * @brief Constructor.
      *
      * @param[in] timeout_ms The timeout in milliseconds. Must be greater than 0.
-     * @param[in] callback Callback to invoke on timeout (default = none).
+     * @param[in] callback Callback to invoke on timeout (default = none). Member functions
+     *                     can be bound via utils::Delegate::bind().
      * @param[in] startTimer Start the timer immediately (default = false).
      */
-    explicit Atmega328p(uint32_t timeout_ms, void (*callback)() = nullptr, 
+    explicit Atmega328p(uint32_t timeout_ms, const utils::Delegate<void()>& callback = {}, 
                         bool startTimer = false) noexcept;
 
     /**
@@ -94,6 +96,25 @@ public:
      */
     void restart() noexcept override;
 
+    /**
+     * @brief Set the callback to invoke on timeout.
+     * 
+     * @param[in] callback The new callback (none = no callback).
+     */
+    void setCallback(const utils::Delegate<void()>& callback) noexcept;
+
+    /**
+     * @brief Set the handler to invoke on every interrupt of the timer circuit.
+     * 
+     *        While the timer is enabled, the handler is invoked every 0.128 ms, independent of 
+     *        the timeout. This is intended for periodic work with a finer resolution than 
+     *        one millisecond, such as software PWM. The handler runs in interrupt context and 
+     *        must be short.
+     * 
+     * @param[in] handler The new handler (none = no handler).
+     */
+    void setInterruptHandler(const utils::Delegate<void()>& handler) noexcept;
+
     /** 
      * @brief Callback handler. 
      */
@@ -106,8 +127,6 @@ public:
     Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
 
 private:
-    void addCallback(void (*callback)()) const noexcept;
-    void removeCallback() const noexcept;
     bool increment() noexcept;
     void clearTimedOut() noexcept;
 
@@ -120,6 +139,12 @@ private:
     /** Max value to count up to. */
     uint32_t myMaxCount;
 
+    /** Callback to invoke on timeout. */
+    utils::Delegate<void()> myCallback;
+
+    /** Handler to invoke on every interrupt. */
+    utils::Delegate<void()> myInterruptHandler;
+
     /** Indicate whether the timer is enabled. */
     bool myEnabled;
 };
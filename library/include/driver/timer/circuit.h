@@ -0,0 +1,51 @@
+/**
+ * @brief Arbitration of the hardware timer circuits of ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace timer
+{
+/**
+ * @brief Enumeration of hardware timer circuits.
+ */
+enum class Circuit : uint8_t
+{
+    Timer0, // Timer 0 (8-bit).
+    Timer1, // Timer 1 (16-bit).
+    Timer2, // Timer 2 (8-bit).
+    Count,  // The number of timer circuits available.
+};
+
+/**
+ * @brief Reserve a timer circuit.
+ * 
+ *        Each circuit is used by one driver at a time, such as the timer driver or the PWM 
+ *        driver. Reserving and releasing circuits is safe in interrupt context.
+ * 
+ * @param[in] circuit The circuit to reserve.
+ * 
+ * @return True if the circuit was reserved, false if it's invalid or already reserved.
+ */
+bool reserveCircuit(Circuit circuit) noexcept;
+
+/**
+ * @brief Release a reserved timer circuit.
+ * 
+ * @param[in] circuit The circuit to release.
+ */
+void releaseCircuit(Circuit circuit) noexcept;
+
+/**
+ * @brief Check whether a timer circuit is reserved.
+ * 
+ * @param[in] circuit The circuit to check.
+ * 
+ * @return True if the circuit is reserved, false otherwise.
+ */
+bool isCircuitReserved(Circuit circuit) noexcept;
+} // namespace timer
+} // namespace driver
@@ -3,6 +3,8 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 #include "logic/interface.h"
 
 namespace driver
@@ -13,8 +15,12 @@ namespace adc { class Interface; }
 /** EEPROM (Electrically Erasable Programmable ROM) stream interface. */
 namespace eeprom { class Interface; }
 
-/** GPIO interface. */
-namespace gpio { class Interface; }
+/** GPIO interface and button events. */
+namespace gpio 
+{ 
+class Interface; 
+enum class ButtonEvent : uint8_t;
+} // namespace gpio
 
 /** Serial transmission interface. */
 namespace serial { class Interface; }
@@ -30,6 +36,9 @@ namespace watchdog { class Interface; }
 
 } // namespace driver
 
+/** Handler profiler. */
+namespace profiler { namespace handler { class Profile; } }
+
 namespace logic
 {
 /**
@@ -41,6 +50,9 @@ namespace logic
  *            - A blink timer to toggle an LED when enabled.
  *            - A temperature timer to print the temperature on timeout.
  *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
+ *              Alternatively, the buttons can be debounced by a sampling debouncer, which
+ *              passes its events to handleButtonEvent(button, event); no debounce timer is
+ *              used in that case.
  *            - A serial device to print serial data via UART.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
@@ -77,6 +89,32 @@ public:
                    driver::eeprom::Interface& eeprom, 
                    driver::tempsensor::Interface& tempSensor) noexcept;
 
+    /**
+     * @brief Constructor for buttons debounced by a sampling debouncer.
+     * 
+     *        Pin change interrupts aren't used, the button events must be passed to
+     *        handleButtonEvent(button, event), see driver::gpio::Debouncer.
+     *     
+     * @param[in] led The LED to toggle.
+     * @param[in] toggleButton Button to toggle the toggle timer.
+     * @param[in] tempButton Button to read the temperature.
+     * @param[in] toggleTimer Timer to toggle the LED.
+     * @param[in] tempTimer Timer to read the temperature.
+     * @param[in] serial Serial device to print status messages.
+     * @param[in] watchdog Watchdog timer that resets the program if it becomes unresponsive.
+     * @param[in] eeprom EEPROM stream to write the status of the LED to EEPROM.
+     * @param[in] tempSensor Temperature sensor.
+     */
+    explicit Logic(driver::gpio::Interface& led,
+                   driver::gpio::Interface& toggleButton,
+                   driver::gpio::Interface& tempButton, 
+                   driver::timer::Interface& toggleTimer,
+                   driver::timer::Interface& tempTimer,
+                   driver::serial::Interface& serial, 
+                   driver::watchdog::Interface& watchdog, 
+                   driver::eeprom::Interface& eeprom, 
+                   driver::tempsensor::Interface& tempSensor) noexcept;
+
     /**
      * @brief Destructor.
      */
@@ -108,6 +146,17 @@ public:
      */
     void handleButtonEvent() noexcept override;
 
+    /**
+     * @brief Handle debounced button event.
+     * 
+     *        Pressing a button works the same as in handleButtonEvent(). Long-pressing the 
+     *        temperature button prints the memory usage. Other events are ignored.
+     * 
+     * @param[in] button The index of the button, i.e. ToggleButton or TempButton.
+     * @param[in] event The button event.
+     */
+    void handleButtonEvent(uint8_t button, driver::gpio::ButtonEvent event) noexcept;
+
     /**
      * @brief Handle debounce timer timerout.
      * 
@@ -130,6 +179,41 @@ public:
      */
     void handleTempTimerTimeout() noexcept override;
 
+    /**
+     * @brief Enumeration of profiled handlers, see handlerProfile().
+     */
+    enum class Handler : uint8_t
+    {
+        ButtonEvent,      // Button event handlers, pin change and debounced.
+        TempTimerTimeout, // Temperature timer timeout handler.
+        SerialPort,       // Serial port reading and command handling.
+        Count,            // The number of profiled handlers.
+    };
+
+    /**
+     * @brief Get the execution time profile of a handler.
+     * 
+     *        The handlers are profiled if HANDLER_PROFILING is defined and the profiler clock 
+     *        is running, see profiler::clock.
+     * 
+     * @param[in] handler The handler.
+     * 
+     * @return Pointer to the profile, holding the cycle budget of the handler, or nullptr if 
+     *         the handler is invalid.
+     */
+    static const profiler::handler::Profile* handlerProfile(Handler handler) noexcept;
+
+    /**
+     * @brief Clear the execution time profiles of all handlers.
+     */
+    static void resetHandlerProfiles() noexcept;
+
+    /** Index of the toggle button, see handleButtonEvent(button, event). */
+    static constexpr uint8_t ToggleButton{0U};
+
+    /** Index of the temperature button, see handleButtonEvent(button, event). */
+    static constexpr uint8_t TempButton{1U};
+
     Logic()                        = delete; // No default constructor.
     Logic(const Logic&)            = delete; // No copy constructor.
     Logic(Logic&&)                 = delete; // No move constructor.
@@ -147,9 +231,23 @@ protected:
     virtual void printTemperature() noexcept;
 
 private:
+    explicit Logic(driver::gpio::Interface& led,
+                   driver::gpio::Interface& toggleButton,
+                   driver::gpio::Interface& tempButton, 
+                   driver::timer::Interface* debounceTimer, 
+                   driver::timer::Interface& toggleTimer,
+                   driver::timer::Interface& tempTimer,
+                   driver::serial::Interface& serial, 
+                   driver::watchdog::Interface& watchdog, 
+                   driver::eeprom::Interface& eeprom, 
+                   driver::tempsensor::Interface& tempSensor) noexcept;
     void handleToggleButtonPressed() noexcept;
     void handleTempButtonPressed() noexcept;
     void restoreToggleStateFromEeprom() noexcept;
+    void printToggleTimerState() noexcept;
+    void printMemoryUsage() noexcept;
+    void printIsrProfile() noexcept;
+    void printHandlerProfiles() noexcept;
     bool readSerialPort() noexcept; 
 
 
@@ -165,8 +263,8 @@ private:
     /** Button to read the temperature. */
     driver::gpio::Interface& myTempButton;
 
-    /** Debounce timer to mitigate effects of contact bounces. */
-    driver::timer::Interface& myDebounceTimer;
+    /** Debounce timer to mitigate effects of contact bounces (none = sampled buttons). */
+    driver::timer::Interface* myDebounceTimer;
 
     /** Timer to toggle the LED. */
     driver::timer::Interface& myToggleTimer;
@@ -0,0 +1,213 @@
+/**
+ * @brief Allocator layer behind utils::newMemory, utils::reallocMemory and utils::deleteMemory.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace memory
+{
+class Arena;
+class BlockPool;
+
+/**
+ * @brief Allocator layer routing dynamic memory requests to the registered backends.
+ *
+ *        The system runs in two phases:
+ *            - During startup, blocks are taken from the registered arena (if any), which suits
+ *              objects created at init time and kept for the lifetime of the program.
+ *            - After startup, i.e. once endStartup() has been called, blocks are taken from the
+ *              registered block pool with the smallest fitting block size (if any), which makes
+ *              allocation time bounded and avoids fragmentation for objects created at runtime.
+ *
+ *        Requests that can't be served by the backends fall back to the general-purpose heap.
+ *        Define MEMORY_FORBID_HEAP_AFTER_STARTUP to make such requests fail after startup,
+ *        which guarantees that the heap can't grow or fragment while the system is running.
+ *
+ *        Each block carries a small header holding its requested size, which enables
+ *        reallocation from any backend and accurate statistics.
+ */
+namespace allocator
+{
+#ifdef MEMORY_FORBID_HEAP_AFTER_STARTUP
+/** Indicate whether the general-purpose heap is forbidden after startup. */
+constexpr bool ForbidHeapAfterStartup{true};
+#else
+/** Indicate whether the general-purpose heap is forbidden after startup. */
+constexpr bool ForbidHeapAfterStartup{false};
+#endif
+
+/** Maximum number of block pools that can be registered. */
+constexpr size_t MaxPoolCount{4U};
+
+/**
+ * @brief Allocation statistics.
+ */
+struct Stats
+{
+    /** The number of bytes currently allocated, as requested by the users. */
+    size_t usedBytes;
+
+    /** The number of bytes currently reserved, including headers, padding and block rounding. */
+    size_t reservedBytes;
+
+    /** The highest number of bytes reserved at the same time. */
+    size_t highWaterMark;
+
+    /** The number of blocks currently allocated. */
+    size_t blockCount;
+
+    /** The number of failed allocations. */
+    size_t failedCount;
+
+    /** The number of blocks allocated from the general-purpose heap after startup. */
+    size_t lateHeapCount;
+
+    /** The total number of successful allocations, including reallocations. */
+    uint32_t allocationCount;
+
+    /** The total number of deallocations, including reallocations. */
+    uint32_t deallocationCount;
+
+    /**
+     * @brief Get the fragmentation of the reserved memory.
+     *
+     *        The fragmentation is the share of the reserved memory that can't be used by the
+     *        users, i.e. headers, alignment padding and unused parts of pool blocks.
+     *
+     * @return The fragmentation in percent.
+     */
+    uint8_t fragmentation() const noexcept
+    {
+        return 0U == reservedBytes ? 0U : static_cast<uint8_t>(
+            (reservedBytes - usedBytes) * 100U / reservedBytes);
+    }
+};
+
+/**
+ * @brief Set the arena to allocate init-time blocks from.
+ *
+ * @param[in] arena Pointer to the arena, or nullptr to allocate init-time blocks from the heap.
+ *
+ * @return True if the arena was set, false if startup has already ended.
+ */
+bool setArena(Arena* arena) noexcept;
+
+/**
+ * @brief Add a block pool to allocate runtime blocks from.
+ *
+ * @param[in] pool Reference to the pool to add. The pool must outlive all its blocks.
+ *
+ * @return True if the pool was added, false if MaxPoolCount pools have already been added.
+ */
+bool addPool(BlockPool& pool) noexcept;
+
+/**
+ * @brief End the startup phase.
+ *
+ *        Subsequent blocks are allocated from the block pools instead of the arena.
+ *
+ * @param[in] forbidHeap True to make allocations from the general-purpose heap fail from now
+ *                       on (default = ForbidHeapAfterStartup).
+ */
+void endStartup(bool forbidHeap = ForbidHeapAfterStartup) noexcept;
+
+/**
+ * @brief Check whether the system is still in the startup phase.
+ *
+ * @return True if endStartup() hasn't been called yet, false otherwise.
+ */
+bool isStartup() noexcept;
+
+/**
+ * @brief Allocate a block.
+ *
+ * @param[in] size The size of the block in bytes.
+ *
+ * @return Pointer to uninitialized memory, or nullptr if the allocation failed.
+ */
+void* allocate(size_t size) noexcept;
+
+/**
+ * @brief Resize a block via reallocation.
+ *
+ *        The content of the block is preserved up to the lesser of the old and new sizes.
+ *
+ * @param[in] block Pointer to the block to resize, or nullptr to allocate a new block.
+ * @param[in] newSize The new size of the block in bytes.
+ *
+ * @return Pointer to the resized block, or nullptr if the reallocation failed, in which case
+ *         the original block is left untouched.
+ */
+void* reallocate(void* block, size_t newSize) noexcept;
+
+/**
+ * @brief Release a block.
+ *
+ * @param[in] block Pointer to the block to release. Nothing happens if the block is null.
+ */
+void deallocate(void* block) noexcept;
+
+/**
+ * @brief Get the allocation statistics.
+ *
+ * @return The current statistics.
+ */
+Stats stats() noexcept;
+
+/**
+ * @brief Restore the initial state, i.e. remove all backends, restart the startup phase and
+ *        clear the statistics.
+ *
+ * @note All blocks must have been released before reset.
+ */
+void reset() noexcept;
+
+#ifdef TESTSUITE
+/**
+ * @brief Restore previously saved statistics.
+ *
+ * @param[in] stats The statistics to restore.
+ */
+void restoreStats(const Stats& stats) noexcept;
+
+/**
+ * @brief Guard saving the statistics on creation, and resetting the allocator and restoring
+ *        the statistics on deletion.
+ *
+ *        Tests resetting the allocator use this guard, so that the counters of the other tests,
+ *        such as the number of blocks still allocated, survive until the end of the test suite.
+ */
+class StatsGuard final
+{
+public:
+    /**
+     * @brief Save the statistics.
+     */
+    StatsGuard() noexcept
+        : mySavedStats{stats()}
+    {}
+
+    /**
+     * @brief Reset the allocator and restore the saved statistics.
+     */
+    ~StatsGuard() noexcept
+    {
+        reset();
+        restoreStats(mySavedStats);
+    }
+
+    StatsGuard(const StatsGuard&)            = delete; // No copy constructor.
+    StatsGuard(StatsGuard&&)                 = delete; // No move constructor.
+    StatsGuard& operator=(const StatsGuard&) = delete; // No copy assignment.
+    StatsGuard& operator=(StatsGuard&&)      = delete; // No move assignment.
+
+private:
+    /** The statistics saved on creation. */
+    const Stats mySavedStats;
+};
+#endif /** TESTSUITE */
+
+} // namespace allocator
+} // namespace memory
@@ -0,0 +1,185 @@
+/**
+ * @brief Static arena (bump) allocator.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace memory
+{
+/**
+ * @brief Arena (bump) allocator.
+ *
+ *        Memory is handed out from a fixed buffer by advancing a single offset, hence allocation
+ *        is O(1) and causes no fragmentation. Blocks can't be released individually, except for
+ *        the most recently allocated block, which can also be resized in place. All blocks are
+ *        released at once via reset().
+ *
+ *        This suits objects created at startup and kept for the lifetime of the program, such as
+ *        driver hardware structures.
+ *
+ *        Each block is aligned to memory::Arena::Alignment.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Arena
+{
+public:
+    /** Alignment of each allocated block. */
+    static constexpr size_t Alignment{alignof(max_align_t)};
+
+    /**
+     * @brief Create arena handing out memory from the given buffer.
+     *
+     * @param[in] buffer Pointer to the buffer. Must be aligned to Alignment.
+     * @param[in] size The size of the buffer in bytes.
+     */
+    Arena(void* buffer, size_t size) noexcept;
+
+    /**
+     * @brief Delete arena.
+     */
+    ~Arena() noexcept = default;
+
+    /**
+     * @brief Allocate a block from the arena.
+     *
+     * @param[in] size The size of the block in bytes.
+     *
+     * @return Pointer to uninitialized memory, or nullptr if the arena is exhausted.
+     */
+    void* allocate(size_t size) noexcept;
+
+    /**
+     * @brief Resize a block in place.
+     *
+     *        Only the most recently allocated block can be resized.
+     *
+     * @param[in] block Pointer to the block to resize.
+     * @param[in] size The current size of the block in bytes.
+     * @param[in] newSize The new size of the block in bytes.
+     *
+     * @return True if the block was resized, false otherwise.
+     */
+    bool resize(void* block, size_t size, size_t newSize) noexcept;
+
+    /**
+     * @brief Release a block.
+     *
+     *        The memory is only reclaimed if the block is the most recently allocated block,
+     *        otherwise it remains reserved until the arena is reset.
+     *
+     * @param[in] block Pointer to the block to release.
+     * @param[in] size The size of the block in bytes.
+     */
+    void deallocate(void* block, size_t size) noexcept;
+
+    /**
+     * @brief Release all blocks.
+     *
+     * @note No block allocated from the arena may be used after reset.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Check if the given block belongs to the arena.
+     *
+     * @param[in] block Pointer to the block to check.
+     *
+     * @return True if the block belongs to the arena, false otherwise.
+     */
+    bool owns(const void* block) const noexcept;
+
+    /**
+     * @brief Get the capacity of the arena.
+     *
+     * @return The size of the buffer in bytes.
+     */
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Get the number of bytes in use.
+     *
+     * @return The number of bytes reserved by allocated blocks, including alignment padding.
+     */
+    size_t used() const noexcept;
+
+    /**
+     * @brief Get the highest number of bytes in use since the arena was created.
+     *
+     * @return The high-water mark in bytes.
+     */
+    size_t highWaterMark() const noexcept;
+
+    /**
+     * @brief Get the number of failed allocations.
+     *
+     * @return The number of allocations that failed since the arena was created.
+     */
+    size_t failedCount() const noexcept;
+
+    /**
+     * @brief Get the size of a block as reserved in the arena.
+     *
+     * @param[in] size The requested size in bytes.
+     *
+     * @return The requested size rounded up to a multiple of Alignment.
+     */
+    static constexpr size_t alignedSize(const size_t size) noexcept
+    {
+        return (size + Alignment - 1U) / Alignment * Alignment;
+    }
+
+    Arena()                        = delete; // No default constructor.
+    Arena(const Arena&)            = delete; // No copy constructor.
+    Arena(Arena&&)                 = delete; // No move constructor.
+    Arena& operator=(const Arena&) = delete; // No copy assignment.
+    Arena& operator=(Arena&&)      = delete; // No move assignment.
+
+private:
+    bool isLast(const void* block, size_t size) const noexcept;
+
+    /** Buffer holding the blocks. */
+    uint8_t* myBuffer;
+
+    /** The size of the buffer in bytes. */
+    size_t myCapacity;
+
+    /** Offset of the first free byte in the buffer. */
+    size_t myOffset;
+
+    /** The highest offset reached. */
+    size_t myHighWaterMark;
+
+    /** The number of failed allocations. */
+    size_t myFailedCount;
+};
+
+/**
+ * @brief Arena allocator holding its own buffer.
+ *
+ *        Declare the arena as a global or static variable to place the buffer in static memory.
+ *
+ * @tparam Size The size of the buffer in bytes. Must be greater than 0.
+ */
+template <size_t Size>
+class StaticArena final : public Arena
+{
+    // Generate a compiler error if the size is set to 0.
+    static_assert(Size > 0U, "Arena size must be greater than 0!");
+
+public:
+    /**
+     * @brief Create empty arena.
+     */
+    StaticArena() noexcept
+        : Arena{myStorage, Size}
+        , myStorage{}
+    {}
+
+private:
+    /** Buffer holding the blocks. */
+    alignas(Arena::Alignment) uint8_t myStorage[Size];
+};
+} // namespace memory
@@ -0,0 +1,175 @@
+/**
+ * @brief Static fixed-size block pool.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace memory
+{
+/**
+ * @brief Pool of fixed-size blocks carved from a static buffer.
+ *
+ *        Released blocks are kept in a free list, hence allocation and deallocation are O(1)
+ *        and the pool never fragments. Unlike memory::Pool, the pool never allocates memory
+ *        and its blocks are untyped, which makes it suitable as a size class of
+ *        memory::allocator for objects created and deleted at runtime.
+ *
+ *        The block size is rounded up to a multiple of memory::BlockPool::Alignment, and to
+ *        at least the size of a pointer.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class BlockPool
+{
+public:
+    /** Alignment of each block. */
+    static constexpr size_t Alignment{alignof(max_align_t)};
+
+    /**
+     * @brief Create pool holding blocks carved from the given buffer.
+     *
+     * @param[in] buffer Pointer to the buffer. Must be aligned to Alignment.
+     * @param[in] blockSize The size of each block in bytes.
+     * @param[in] blockCount The number of blocks. The buffer must hold
+     *                       blockCount * alignedSize(blockSize) bytes.
+     */
+    BlockPool(void* buffer, size_t blockSize, size_t blockCount) noexcept;
+
+    /**
+     * @brief Delete pool.
+     */
+    ~BlockPool() noexcept = default;
+
+    /**
+     * @brief Allocate a block from the pool.
+     *
+     * @return Pointer to uninitialized memory, or nullptr if no free blocks are left.
+     */
+    void* allocate() noexcept;
+
+    /**
+     * @brief Return a block to the pool.
+     *
+     * @param[in] block Pointer to the block to return. Must belong to the pool.
+     */
+    void deallocate(void* block) noexcept;
+
+    /**
+     * @brief Check if the given block belongs to the pool.
+     *
+     * @param[in] block Pointer to the block to check.
+     *
+     * @return True if the block belongs to the pool, false otherwise.
+     */
+    bool owns(const void* block) const noexcept;
+
+    /**
+     * @brief Get the block size.
+     *
+     * @return The size of each block in bytes, after rounding.
+     */
+    size_t blockSize() const noexcept;
+
+    /**
+     * @brief Get the number of blocks.
+     *
+     * @return The total number of blocks in the pool.
+     */
+    size_t blockCount() const noexcept;
+
+    /**
+     * @brief Get the number of free blocks.
+     *
+     * @return The number of blocks available for allocation.
+     */
+    size_t freeCount() const noexcept;
+
+    /**
+     * @brief Get the highest number of blocks in use since the pool was created.
+     *
+     * @return The high-water mark in number of blocks.
+     */
+    size_t highWaterMark() const noexcept;
+
+    /**
+     * @brief Get the number of failed allocations.
+     *
+     * @return The number of allocations that failed since the pool was created.
+     */
+    size_t failedCount() const noexcept;
+
+    /**
+     * @brief Get the size of a block as held by the pool.
+     *
+     * @param[in] size The requested block size in bytes.
+     *
+     * @return The block size rounded up to a multiple of Alignment, at least the pointer size.
+     */
+    static constexpr size_t alignedSize(const size_t size) noexcept
+    {
+        return ((size < sizeof(void*) ? sizeof(void*) : size) + Alignment - 1U) / Alignment *
+               Alignment;
+    }
+
+    BlockPool()                            = delete; // No default constructor.
+    BlockPool(const BlockPool&)            = delete; // No copy constructor.
+    BlockPool(BlockPool&&)                 = delete; // No move constructor.
+    BlockPool& operator=(const BlockPool&) = delete; // No copy assignment.
+    BlockPool& operator=(BlockPool&&)      = delete; // No move assignment.
+
+private:
+    /** Free block, holding a link to the next free block. */
+    struct FreeBlock { FreeBlock* next; };
+
+    /** Buffer holding the blocks. */
+    uint8_t* myBuffer;
+
+    /** The size of each block in bytes. */
+    size_t myBlockSize;
+
+    /** The total number of blocks. */
+    size_t myBlockCount;
+
+    /** The first free block. */
+    FreeBlock* myFreeList;
+
+    /** The number of free blocks. */
+    size_t myFreeCount;
+
+    /** The lowest number of free blocks reached. */
+    size_t myMinFreeCount;
+
+    /** The number of failed allocations. */
+    size_t myFailedCount;
+};
+
+/**
+ * @brief Block pool holding its own buffer.
+ *
+ *        Declare the pool as a global or static variable to place the buffer in static memory.
+ *
+ * @tparam BlockSize  The size of each block in bytes. Must be greater than 0.
+ * @tparam BlockCount The number of blocks. Must be greater than 0.
+ */
+template <size_t BlockSize, size_t BlockCount>
+class StaticBlockPool final : public BlockPool
+{
+    // Generate a compiler error if the block size or count is set to 0.
+    static_assert(BlockSize > 0U, "Block size must be greater than 0!");
+    static_assert(BlockCount > 0U, "Block count must be greater than 0!");
+
+public:
+    /**
+     * @brief Create pool with all blocks free.
+     */
+    StaticBlockPool() noexcept
+        : BlockPool{myStorage, BlockSize, BlockCount}
+    {}
+
+private:
+    /** Buffer holding the blocks. */
+    alignas(BlockPool::Alignment) uint8_t myStorage[BlockCount * alignedSize(BlockSize)];
+};
+} // namespace memory
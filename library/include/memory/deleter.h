@@ -0,0 +1,155 @@
+/**
+ * @brief Deleters releasing objects owned by memory::UniquePtr.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "memory/block_pool.h"
+#include "memory/pool.h"
+#include "utils/type_traits.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+/**
+ * @brief Deleter for objects allocated via utils::newObject().
+ *
+ * @tparam T The object type.
+ */
+template <typename T>
+struct DefaultDelete
+{
+    /**
+     * @brief Destroy the object and release its memory.
+     *
+     * @param[in] data Pointer to the object to delete.
+     */
+    void operator()(T* data) const noexcept;
+};
+
+/**
+ * @brief Deleter for fields allocated via utils::newMemory().
+ *
+ * @tparam T The element type. Must be trivially destructible, since fields are uninitialized.
+ */
+template <typename T>
+struct DefaultDelete<T[]>
+{
+    static_assert(type_traits::is_trivially_destructible<T>::value,
+                  "Fields only supported for trivially destructible types!");
+
+    /**
+     * @brief Release the memory of the field.
+     *
+     * @param[in] data Pointer to the field to delete.
+     */
+    void operator()(T* data) const noexcept;
+};
+
+/**
+ * @brief Deleter for objects whose memory is managed elsewhere.
+ *
+ *        Suitable for objects placed in a memory::Arena, whose memory is reclaimed when the
+ *        arena is reset, and for objects placed in static storage.
+ *
+ * @tparam T The object type.
+ */
+template <typename T>
+struct DestroyOnly
+{
+    /**
+     * @brief Destroy the object without releasing its memory.
+     *
+     * @param[in] data Pointer to the object to destroy.
+     */
+    void operator()(T* data) const noexcept;
+};
+
+/**
+ * @brief Deleter for objects allocated from a memory::Pool.
+ *
+ * @tparam T        The object type.
+ * @tparam SlabSize The number of blocks per slab of the pool.
+ */
+template <typename T, size_t SlabSize>
+class PoolDelete
+{
+public:
+    /**
+     * @brief Create deleter returning objects to given pool.
+     *
+     * @param[in] pool Reference to the pool. The pool must outlive the deleter.
+     */
+    explicit PoolDelete(Pool<T, SlabSize>& pool) noexcept;
+
+    /**
+     * @brief Destroy the object and return its memory to the pool.
+     *
+     * @param[in] data Pointer to the object to delete.
+     */
+    void operator()(T* data) const noexcept;
+
+private:
+    Pool<T, SlabSize>* myPool; // The pool holding the objects.
+};
+
+/**
+ * @brief Deleter for objects allocated from a memory::BlockPool.
+ *
+ * @tparam T The object type.
+ */
+template <typename T>
+class BlockPoolDelete
+{
+public:
+    /**
+     * @brief Create deleter returning objects to given pool.
+     *
+     * @param[in] pool Reference to the pool. The pool must outlive the deleter.
+     */
+    explicit BlockPoolDelete(BlockPool& pool) noexcept;
+
+    /**
+     * @brief Destroy the object and return its memory to the pool.
+     *
+     * @param[in] data Pointer to the object to delete.
+     */
+    void operator()(T* data) const noexcept;
+
+private:
+    BlockPool* myPool; // The pool holding the objects.
+};
+
+/**
+ * @brief Deleter for buffers allocated from a memory::BlockPool.
+ *
+ * @tparam T The element type. Must be trivially destructible, since buffers are uninitialized.
+ */
+template <typename T>
+class BlockPoolDelete<T[]>
+{
+public:
+    static_assert(type_traits::is_trivially_destructible<T>::value,
+                  "Buffers only supported for trivially destructible types!");
+
+    /**
+     * @brief Create deleter returning buffers to given pool.
+     *
+     * @param[in] pool Reference to the pool. The pool must outlive the deleter.
+     */
+    explicit BlockPoolDelete(BlockPool& pool) noexcept;
+
+    /**
+     * @brief Return the buffer to the pool.
+     *
+     * @param[in] data Pointer to the buffer to delete.
+     */
+    void operator()(T* data) const noexcept;
+
+private:
+    BlockPool* myPool; // The pool holding the buffers.
+};
+} // namespace memory
+
+#include "impl/deleter_impl.h"
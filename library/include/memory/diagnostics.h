@@ -0,0 +1,84 @@
+/**
+ * @brief Memory diagnostics, i.e. stack usage and allocation statistics.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory/allocator.h"
+
+namespace memory
+{
+/**
+ * @brief Memory diagnostics.
+ *
+ *        The stack and the heap share the RAM above the static data: the heap grows up from
+ *        its start, the stack grows down from the end of RAM. To track how close these are to
+ *        colliding, the free memory between them is painted with a known pattern at startup
+ *        via paintStack(). The stack overwrites the pattern as it grows, hence the deepest
+ *        stack usage can later be found by scanning for the first overwritten byte.
+ *
+ *        Allocation statistics are provided by memory::allocator, which serves all requests
+ *        made via utils::newMemory, utils::reallocMemory and utils::deleteMemory.
+ */
+namespace diagnostics
+{
+/** Pattern painted onto the free memory between the heap and the stack. */
+constexpr uint8_t StackPaint{0xC5U};
+
+/**
+ * @brief Stack usage.
+ */
+struct StackUsage
+{
+    /** The number of bytes between the end of the heap and the end of RAM. */
+    size_t capacity;
+
+    /** The number of bytes currently used by the stack. */
+    size_t used;
+
+    /** The highest number of bytes used by the stack since it was painted. */
+    size_t peak;
+
+    /** The number of bytes between the end of the heap and the deepest stack usage. */
+    size_t headroom;
+};
+
+/**
+ * @brief Memory usage report.
+ */
+struct Report
+{
+    /** Allocation statistics. */
+    allocator::Stats heap;
+
+    /** Stack usage. */
+    StackUsage stack;
+};
+
+/**
+ * @brief Paint the free memory between the end of the heap and the stack pointer.
+ *
+ *        Call this function first thing in main() to track the stack usage of the program.
+ */
+void paintStack() noexcept;
+
+/**
+ * @brief Get the stack usage.
+ *
+ *        The peak and headroom are only valid if the stack has been painted.
+ *
+ * @return The stack usage.
+ */
+StackUsage stackUsage() noexcept;
+
+/**
+ * @brief Get a memory usage report.
+ *
+ * @return The current allocation statistics and stack usage.
+ */
+Report report() noexcept;
+
+} // namespace diagnostics
+} // namespace memory
@@ -0,0 +1,48 @@
+/**
+ * @brief Heap allocator implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "utils/utils.h"
+
+namespace memory
+{
+/**
+ * @brief Allocator allocating each block individually on the heap.
+ * 
+ *        Provides the same interface as memory::Pool, so that it can be used as an allocator 
+ *        policy for containers where memory usage is more important than speed.
+ * 
+ * @tparam T The block type.
+ * @tparam N Unused, only present for compatibility with memory::Pool.
+ */
+template <typename T, size_t N = 0U>
+class HeapAllocator final
+{
+public:
+    /**
+     * @brief Allocate a block on the heap.
+     * 
+     * @return Pointer to uninitialized memory for one instance of T, or nullptr if the 
+     *         allocation failed.
+     */
+    T* allocate() noexcept { return utils::newMemory<T>(); }
+
+    /**
+     * @brief Release a block allocated on the heap.
+     * 
+     * @param[in] block Pointer to the block to release. The object it holds must already have 
+     *                  been destroyed.
+     */
+    void deallocate(T* block) noexcept { utils::deleteMemory(block); }
+
+    /**
+     * @brief Reserve blocks in advance (not supported, blocks are allocated on demand).
+     * 
+     * @return True (always).
+     */
+    bool reserve(size_t) noexcept { return true; }
+};
+} // namespace memory
@@ -0,0 +1,63 @@
+/**
+ * @brief Implementation details of the deleters for memory::UniquePtr.
+ *
+ * @note Don't include this header, use <deleter.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+void DefaultDelete<T>::operator()(T* data) const noexcept
+{
+    utils::destroyAt(data);
+    utils::deleteMemory(data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DefaultDelete<T[]>::operator()(T* data) const noexcept { utils::deleteMemory(data); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DestroyOnly<T>::operator()(T* data) const noexcept { utils::destroyAt(data); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+PoolDelete<T, SlabSize>::PoolDelete(Pool<T, SlabSize>& pool) noexcept
+    : myPool{&pool}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+void PoolDelete<T, SlabSize>::operator()(T* data) const noexcept
+{
+    utils::destroyAt(data);
+    myPool->deallocate(data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+BlockPoolDelete<T>::BlockPoolDelete(BlockPool& pool) noexcept
+    : myPool{&pool}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void BlockPoolDelete<T>::operator()(T* data) const noexcept
+{
+    utils::destroyAt(data);
+    myPool->deallocate(data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+BlockPoolDelete<T[]>::BlockPoolDelete(BlockPool& pool) noexcept
+    : myPool{&pool}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void BlockPoolDelete<T[]>::operator()(T* data) const noexcept { myPool->deallocate(data); }
+} // namespace memory
@@ -0,0 +1,144 @@
+/**
+ * @brief Implementation details of class memory::IntrusivePtr and associated classes.
+ *
+ * @note Don't include this header, use <intrusive_ptr.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+size_t RefCounted<T, Policy>::refCount() const noexcept { return Policy::load(myRefCount); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void RefCounted<T, Policy>::destroy(T* object) noexcept
+{
+    utils::destroyAt(object);
+    utils::deleteMemory(object);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+RefCounted<T, Policy>::RefCounted() noexcept
+    : myRefCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+RefCounted<T, Policy>::RefCounted(const RefCounted&) noexcept
+    : myRefCount{0U}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+RefCounted<T, Policy>& RefCounted<T, Policy>::operator=(const RefCounted&) noexcept
+{
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(T* data) noexcept
+    : myData{data}
+{
+    acquire(myData);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr& other) noexcept
+    : myData{other.myData}
+{
+    acquire(myData);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(IntrusivePtr&& other) noexcept
+    : myData{other.myData}
+{
+    other.myData = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>::~IntrusivePtr() noexcept { release(myData); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(const IntrusivePtr& other) noexcept
+{
+    reset(other.myData);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(IntrusivePtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        release(myData);
+        myData       = other.myData;
+        other.myData = nullptr;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusivePtr<T>::operator bool() const noexcept { return myData != nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T& IntrusivePtr<T>::operator*() const noexcept { return *myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusivePtr<T>::operator->() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusivePtr<T>::get() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t IntrusivePtr<T>::useCount() const noexcept
+{
+    return myData ? myData->refCount() : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusivePtr<T>::reset(T* newData) noexcept
+{
+    // Acquire first, since the new object might only be kept alive by the current one.
+    acquire(newData);
+    release(myData);
+    myData = newData;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusivePtr<T>::acquire(T* data) noexcept
+{
+    if (data) { Policy::increment(data->myRefCount); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusivePtr<T>::release(T* data) noexcept
+{
+    if (data && (0U == Policy::decrement(data->myRefCount))) { T::destroy(data); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+IntrusivePtr<T> makeIntrusive(Args&&... args) noexcept
+{
+    return IntrusivePtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
+}
+
+} // namespace memory
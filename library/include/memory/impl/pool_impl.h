@@ -0,0 +1,156 @@
+/**
+ * @brief Implementation details of memory::Pool class.
+ * 
+ * @note Don't include this header, use <pool.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+/**
+ * @brief Block holding either an object or a link to the next free block.
+ * 
+ * @tparam T        The block type.
+ * @tparam SlabSize The number of blocks per slab.
+ */
+template <typename T, size_t SlabSize>
+union Pool<T, SlabSize>::Block
+{
+    Block* next;                         // Pointer to the next free block.
+    alignas(T) uint8_t data[sizeof(T)];  // Storage for one instance of T.
+};
+
+/**
+ * @brief Slab holding a fixed number of blocks.
+ * 
+ * @tparam T        The block type.
+ * @tparam SlabSize The number of blocks per slab.
+ */
+template <typename T, size_t SlabSize>
+struct Pool<T, SlabSize>::Slab
+{
+    Slab* next;              // Pointer to the next slab.
+    Block blocks[SlabSize];  // Blocks held by the slab.
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+Pool<T, SlabSize>::Pool() noexcept
+    : mySlabs{nullptr}
+    , myFreeList{nullptr}
+    , mySlabCount{}
+    , myFreeCount{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+Pool<T, SlabSize>::Pool(Pool&& other) noexcept
+    : mySlabs{other.mySlabs}
+    , myFreeList{other.myFreeList}
+    , mySlabCount{other.mySlabCount}
+    , myFreeCount{other.myFreeCount}
+{
+    other.mySlabs     = nullptr;
+    other.myFreeList  = nullptr;
+    other.mySlabCount = 0U;
+    other.myFreeCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+Pool<T, SlabSize>::~Pool() noexcept { release(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+Pool<T, SlabSize>& Pool<T, SlabSize>::operator=(Pool&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        mySlabs           = other.mySlabs;
+        myFreeList        = other.myFreeList;
+        mySlabCount       = other.mySlabCount;
+        myFreeCount       = other.myFreeCount;
+        other.mySlabs     = nullptr;
+        other.myFreeList  = nullptr;
+        other.mySlabCount = 0U;
+        other.myFreeCount = 0U;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+T* Pool<T, SlabSize>::allocate() noexcept
+{
+    if ((myFreeList == nullptr) && !addSlab()) { return nullptr; }
+    auto block{myFreeList};
+    myFreeList = block->next;
+    myFreeCount--;
+    return reinterpret_cast<T*>(block->data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+void Pool<T, SlabSize>::deallocate(T* block) noexcept
+{
+    if (block == nullptr) { return; }
+    auto freeBlock{reinterpret_cast<Block*>(block)};
+    freeBlock->next = myFreeList;
+    myFreeList      = freeBlock;
+    myFreeCount++;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+bool Pool<T, SlabSize>::reserve(const size_t blockCount) noexcept
+{
+    while (myFreeCount < blockCount)
+    {
+        if (!addSlab()) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+size_t Pool<T, SlabSize>::slabCount() const noexcept { return mySlabCount; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+size_t Pool<T, SlabSize>::freeCount() const noexcept { return myFreeCount; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+bool Pool<T, SlabSize>::addSlab() noexcept
+{
+    auto slab{utils::newMemory<Slab>()};
+    if (slab == nullptr) { return false; }
+    slab->next = mySlabs;
+    mySlabs    = slab;
+
+    // Link the blocks in reverse order, so that they are allocated in address order.
+    for (size_t i{SlabSize}; i > 0U; --i)
+    {
+        slab->blocks[i - 1U].next = myFreeList;
+        myFreeList                = &slab->blocks[i - 1U];
+    }
+    mySlabCount++;
+    myFreeCount += SlabSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize>
+void Pool<T, SlabSize>::release() noexcept
+{
+    while (mySlabs != nullptr)
+    {
+        auto next{mySlabs->next};
+        utils::deleteMemory(mySlabs);
+        mySlabs = next;
+    }
+    myFreeList  = nullptr;
+    mySlabCount = 0U;
+    myFreeCount = 0U;
+}
+} // namespace memory
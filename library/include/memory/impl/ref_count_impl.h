@@ -0,0 +1,87 @@
+/**
+ * @brief Implementation details of the reference counting policies.
+ *
+ * @note Don't include this header, use <ref_count.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+inline SingleContextCount::Type SingleContextCount::load(const Type& count) noexcept
+{
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+inline void SingleContextCount::increment(Type& count) noexcept { count++; }
+
+// -----------------------------------------------------------------------------
+inline bool SingleContextCount::incrementIfNonZero(Type& count) noexcept
+{
+    if (0U == count) { return false; }
+    count++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+inline SingleContextCount::Type SingleContextCount::decrement(Type& count) noexcept
+{
+    return --count;
+}
+
+// -----------------------------------------------------------------------------
+inline AtomicCount::Type AtomicCount::load(const Type& count) noexcept
+{
+    return utils::atomicLoad(count);
+}
+
+// -----------------------------------------------------------------------------
+inline void AtomicCount::increment(Type& count) noexcept
+{
+#ifdef TESTSUITE
+    // New references are always made from existing ones, hence no ordering is required.
+    __atomic_fetch_add(&count, 1U, __ATOMIC_RELAXED);
+#else
+    utils::InterruptGuard guard{};
+    *static_cast<volatile Type*>(&count) = *static_cast<volatile Type*>(&count) + 1U;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+inline bool AtomicCount::incrementIfNonZero(Type& count) noexcept
+{
+#ifdef TESTSUITE
+    Type value{__atomic_load_n(&count, __ATOMIC_RELAXED)};
+    while (0U != value)
+    {
+        if (__atomic_compare_exchange_n(&count, &value, value + 1U, true, __ATOMIC_ACQUIRE,
+                                        __ATOMIC_RELAXED))
+        {
+            return true;
+        }
+    }
+    return false;
+#else
+    utils::InterruptGuard guard{};
+    const Type value{*static_cast<volatile Type*>(&count)};
+    if (0U == value) { return false; }
+    *static_cast<volatile Type*>(&count) = value + 1U;
+    return true;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+inline AtomicCount::Type AtomicCount::decrement(Type& count) noexcept
+{
+#ifdef TESTSUITE
+    // Make preceding accesses to the object visible to the context deleting it.
+    return __atomic_sub_fetch(&count, 1U, __ATOMIC_ACQ_REL);
+#else
+    utils::InterruptGuard guard{};
+    const Type value{static_cast<Type>(*static_cast<volatile Type*>(&count) - 1U)};
+    *static_cast<volatile Type*>(&count) = value;
+    return value;
+#endif
+}
+} // namespace memory
@@ -1,152 +1,300 @@
 /**
  * @brief Implementation details of class memory::SharedPtr and associated
  *        factory functions.
- * 
+ *
  * @note Don't include this header, use <shared_ptr.h> instead!
  */
 #pragma once
 
 namespace memory
 {
+/**
+ * @brief Control block shared by the pointers owning the same data.
+ *
+ *        The weak count holds one reference on behalf of all shared pointers, hence the
+ *        control block is released once both counts have reached 0.
+ *
+ * @tparam T      The pointer type.
+ * @tparam Policy The reference counting policy.
+ */
+template <typename T, typename Policy>
+struct SharedPtr<T, Policy>::Control
+{
+    typename Policy::Type useCount;   // The number of shared pointers owning the data.
+    typename Policy::Type weakCount;  // The number of weak pointers, plus one if owned.
+    Destroyer destroy;                // Destroys the data.
+    Destroyer deallocate;             // Releases the memory of the control block.
+};
+
+/**
+ * @brief Block holding a control block and the object it controls.
+ *
+ * @tparam T      The pointer type.
+ * @tparam Policy The reference counting policy.
+ */
+template <typename T, typename Policy>
+struct SharedPtr<T, Policy>::Block
+{
+    Control control;                     // Control block of the object.
+    void* pool;                          // Pool the block belongs to, if any.
+    alignas(T) uint8_t data[sizeof(T)];  // Storage for the object.
+};
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(T* data) noexcept
-    : myData{data}
-    , myRefCount{newRefCount()} {}
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::SharedPtr(T* data) noexcept
+    : myData{nullptr}
+    , myControl{nullptr}
+{
+    reset(data);
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(const SharedPtr<T>& other) noexcept
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::SharedPtr(const SharedPtr& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount} 
+    , myControl{other.myControl}
 {
-    (*myRefCount)++;
+    if (myControl) { Policy::increment(myControl->useCount); }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::SharedPtr(SharedPtr<T>&& other) noexcept
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::SharedPtr(SharedPtr&& other) noexcept
     : myData{other.myData}
-    , myRefCount{other.myRefCount}
+    , myControl{other.myControl}
 {
-    other.myData     = nullptr;
-    other.myRefCount = nullptr;
+    other.myData    = nullptr;
+    other.myControl = nullptr;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::~SharedPtr() noexcept { reset(); }
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::~SharedPtr() noexcept { release(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr<T>& other) noexcept
+template <typename T, typename Policy>
+SharedPtr<T, Policy>& SharedPtr<T, Policy>::operator=(const SharedPtr& other) noexcept
 {
     if (this != &other)
     {
         release();
-        myData = other.myData;
-        myRefCount = other.myRefCount;
-        (*myRefCount)++;
+        myData    = other.myData;
+        myControl = other.myControl;
+        if (myControl) { Policy::increment(myControl->useCount); }
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr<T>&& other) noexcept
+template <typename T, typename Policy>
+SharedPtr<T, Policy>& SharedPtr<T, Policy>::operator=(SharedPtr&& other) noexcept
 {
     if (this != &other)
     {
         release();
-        myData           = other.myData;
-        myRefCount       = other.myRefCount;
-        other.myData     = nullptr;
-        other.myRefCount = nullptr;
+        myData          = other.myData;
+        myControl       = other.myControl;
+        other.myData    = nullptr;
+        other.myControl = nullptr;
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-SharedPtr<T>::operator bool() const { return myData != nullptr; }
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::operator bool() const noexcept { return myData != nullptr; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& SharedPtr<T>::operator*() noexcept { return *myData; }
+template <typename T, typename Policy>
+T& SharedPtr<T, Policy>::operator*() noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& SharedPtr<T>::operator*() const noexcept { return *myData; }
+template <typename T, typename Policy>
+const T& SharedPtr<T, Policy>::operator*() const noexcept { return *myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::operator->() noexcept { return myData; }
+template <typename T, typename Policy>
+T* SharedPtr<T, Policy>::operator->() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* SharedPtr<T>::operator->() const noexcept { return myData; }
+template <typename T, typename Policy>
+const T* SharedPtr<T, Policy>::operator->() const noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::get() noexcept { return myData; }
+template <typename T, typename Policy>
+T* SharedPtr<T, Policy>::get() noexcept { return myData; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* SharedPtr<T>::get() const noexcept { return myData; }
+template <typename T, typename Policy>
+const T* SharedPtr<T, Policy>::get() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+size_t SharedPtr<T, Policy>::useCount() const noexcept
+{
+    return myControl ? Policy::load(myControl->useCount) : 0U;
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::reset(T* newData) noexcept
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::reset(T* newData) noexcept
 {
     release();
-    myData     = newData;
-    myRefCount = newRefCount();
+    if (nullptr == newData) { return; }
+
+    // Delete the data if no control block could be allocated, since it's owned by now.
+    myControl = newControl(&destroySeparate, &deallocateControl);
+    if (nullptr == myControl)
+    {
+        utils::destroyAt(newData);
+        utils::deleteMemory(newData);
+        return;
+    }
+    myData = newData;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* SharedPtr<T>::release() noexcept
+template <typename T, typename Policy>
+T* SharedPtr<T, Policy>::release() noexcept
 {
-    decrementReferenceCount();
-    myData     = nullptr;
-    myRefCount = nullptr;
+    auto data{myData};
+    auto control{myControl};
+    myData    = nullptr;
+    myControl = nullptr;
+
+    if (nullptr == control) { return nullptr; }
+    if (0U < Policy::decrement(control->useCount)) { return data; }
+
+    // Destroy the data, then drop the weak reference held on behalf of the owners.
+    control->destroy(control, data);
+    releaseWeak(control);
     return nullptr;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t* SharedPtr<T>::newRefCount() noexcept { return new size_t{1U}; }
+template <typename T, typename Policy>
+SharedPtr<T, Policy>::SharedPtr(T* data, Control* control) noexcept
+    : myData{data}
+    , myControl{control}
+{}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::decrementReferenceCount() noexcept
+template <typename T, typename Policy>
+typename SharedPtr<T, Policy>::Control* SharedPtr<T, Policy>::newControl(
+    const Destroyer destroy, const Destroyer deallocate) noexcept
 {
-    if (myRefCount && (--(*myRefCount) == 0U)) { releaseMemory(); }
+    auto control{utils::newMemory<Control>()};
+    if (control) { initControl(*control, destroy, deallocate); }
+    return control;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void SharedPtr<T>::releaseMemory() noexcept
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::initControl(Control& control, const Destroyer destroy,
+                                       const Destroyer deallocate) noexcept
 {
-    utils::deleteMemory(myData);
-    utils::deleteMemory(myRefCount);
-    myData     = nullptr;
-    myRefCount = nullptr;
+    control.useCount   = 1U;
+    control.weakCount  = 1U;
+    control.destroy    = destroy;
+    control.deallocate = deallocate;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T, typename... Args>
-SharedPtr<T> makeShared(Args&&... args) noexcept
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::releaseWeak(Control* control) noexcept
 {
-    return SharedPtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    if (0U == Policy::decrement(control->weakCount)) { control->deallocate(control, nullptr); }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T, size_t Size>
-SharedPtr<T> makeShared() noexcept
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::destroyObject(Control*, T* data) noexcept { utils::destroyAt(data); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::destroySeparate(Control*, T* data) noexcept
 {
-    return SharedPtr<T>{utils::newMemory<T>(Size)};
+    utils::destroyAt(data);
+    utils::deleteMemory(data);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::destroyField(Control*, T* data) noexcept { utils::deleteMemory(data); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::deallocateControl(Control* control, T*) noexcept
+{
+    utils::deleteMemory(control);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void SharedPtr<T, Policy>::deallocateBlock(Control* control, T*) noexcept
+{
+    // The control block is the first member of the block, hence they share address.
+    auto block{reinterpret_cast<Block*>(control)};
+    utils::deleteMemory(block);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+template <size_t SlabSize>
+void SharedPtr<T, Policy>::deallocatePoolBlock(Control* control, T*) noexcept
+{
+    auto block{reinterpret_cast<Block*>(control)};
+    static_cast<Pool<Block, SlabSize>*>(block->pool)->deallocate(block);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy, typename... Args>
+SharedPtr<T, Policy> makeShared(Args&&... args) noexcept
+{
+    using Ptr = SharedPtr<T, Policy>;
+    auto block{utils::newMemory<typename Ptr::Block>()};
+    if (nullptr == block) { return Ptr{}; }
+
+    Ptr::initControl(block->control, &Ptr::destroyObject, &Ptr::deallocateBlock);
+    block->pool = nullptr;
+    auto data{utils::constructAt(reinterpret_cast<T*>(block->data), utils::forward<Args>(args)...)};
+    return Ptr{data, &block->control};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size, typename Policy>
+SharedPtr<T, Policy> makeShared() noexcept
+{
+    static_assert(type_traits::is_trivially_destructible<T>::value,
+                  "Shared fields only supported for trivially destructible types!");
+    using Ptr = SharedPtr<T, Policy>;
+    auto data{utils::newMemory<T>(Size)};
+    if (nullptr == data) { return Ptr{}; }
+
+    auto control{Ptr::newControl(&Ptr::destroyField, &Ptr::deallocateControl)};
+    if (nullptr == control)
+    {
+        utils::deleteMemory(data);
+        return Ptr{};
+    }
+    return Ptr{data, control};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy, size_t SlabSize, typename... Args>
+SharedPtr<T, Policy> allocateShared(SharedPool<T, SlabSize, Policy>& pool,
+                                    Args&&... args) noexcept
+{
+    using Ptr = SharedPtr<T, Policy>;
+    auto block{pool.allocate()};
+    if (nullptr == block) { return Ptr{}; }
+
+    Ptr::initControl(block->control, &Ptr::destroyObject,
+                     &Ptr::template deallocatePoolBlock<SlabSize>);
+    block->pool = &pool;
+    auto data{utils::constructAt(reinterpret_cast<T*>(block->data), utils::forward<Args>(args)...)};
+    return Ptr{data, &block->control};
 }
 
-} // namespace memory
\ No newline at end of file
+} // namespace memory
@@ -9,92 +9,257 @@
 namespace memory 
 {
 
+/**
+ * @brief Storage of the data, with the deleter as empty base.
+ * 
+ * @tparam T       The pointer type.
+ * @tparam Deleter The deleter type.
+ */
+template <typename T, typename Deleter>
+struct UniquePtr<T, Deleter>::Storage : public Deleter
+{
+    /**
+     * @brief Create new storage.
+     * 
+     * @param[in] data    Pointer to the data.
+     * @param[in] deleter The deleter to release the data with.
+     */
+    Storage(T* data, const Deleter& deleter) noexcept
+        : Deleter{deleter}
+        , data{data} {}
+
+    T* data; // Pointer to unique data.
+};
+
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::UniquePtr(T* data) noexcept
-    : myData{data} {}
+template <typename T, typename Deleter>
+UniquePtr<T, Deleter>::UniquePtr(T* data, const Deleter& deleter) noexcept
+    : myStorage{data, deleter} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::UniquePtr(UniquePtr<T>&& other) noexcept
-    : myData{other.myData} 
+template <typename T, typename Deleter>
+UniquePtr<T, Deleter>::UniquePtr(UniquePtr&& other) noexcept
+    : myStorage{other.myStorage.data, other.deleter()} 
 { 
-    other.myData = nullptr; 
+    other.myStorage.data = nullptr; 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::~UniquePtr() noexcept { reset(); }
+template <typename T, typename Deleter>
+UniquePtr<T, Deleter>::~UniquePtr() noexcept { reset(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>& UniquePtr<T>::operator=(UniquePtr<T>&& other) noexcept
+template <typename T, typename Deleter>
+UniquePtr<T, Deleter>& UniquePtr<T, Deleter>::operator=(UniquePtr&& other) noexcept
 {
     if (this != &other)
     {
-        reset(other.myData);
-        other.myData = nullptr;
+        reset(other.release());
+        deleter() = other.deleter();
     }
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-UniquePtr<T>::operator bool() const { return myData != nullptr; }
+template <typename T, typename Deleter>
+UniquePtr<T, Deleter>::operator bool() const noexcept { return myStorage.data != nullptr; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& UniquePtr<T>::operator*() noexcept { return *myData; }
+template <typename T, typename Deleter>
+T& UniquePtr<T, Deleter>::operator*() noexcept { return *myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& UniquePtr<T>::operator*() const noexcept { return *myData; }
+template <typename T, typename Deleter>
+const T& UniquePtr<T, Deleter>::operator*() const noexcept { return *myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::operator->() noexcept { return myData; }
+template <typename T, typename Deleter>
+T* UniquePtr<T, Deleter>::operator->() noexcept { return myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* UniquePtr<T>::operator->() const noexcept { return myData; }
+template <typename T, typename Deleter>
+const T* UniquePtr<T, Deleter>::operator->() const noexcept { return myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::get() noexcept { return myData; }
+template <typename T, typename Deleter>
+T* UniquePtr<T, Deleter>::get() noexcept { return myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T* UniquePtr<T>::get() const noexcept { return myData; }
+template <typename T, typename Deleter>
+const T* UniquePtr<T, Deleter>::get() const noexcept { return myStorage.data; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void UniquePtr<T>::reset(T* newData) noexcept
+template <typename T, typename Deleter>
+Deleter& UniquePtr<T, Deleter>::deleter() noexcept { return myStorage; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+const Deleter& UniquePtr<T, Deleter>::deleter() const noexcept { return myStorage; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+void UniquePtr<T, Deleter>::reset(T* newData) noexcept
 {
-    utils::deleteMemory(myData);
-    myData = newData;
+    T* oldData{myStorage.data};
+    myStorage.data = newData;
+    if (oldData) { deleter()(oldData); }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T* UniquePtr<T>::release() noexcept
+template <typename T, typename Deleter>
+T* UniquePtr<T, Deleter>::release() noexcept
+{
+    T* copy{myStorage.data};
+    myStorage.data = nullptr;
+    return copy;
+}
+
+/**
+ * @brief Storage of the field, with the deleter as empty base.
+ * 
+ * @tparam T       The element type.
+ * @tparam Deleter The deleter type.
+ */
+template <typename T, typename Deleter>
+struct UniquePtr<T[], Deleter>::Storage : public Deleter
+{
+    /**
+     * @brief Create new storage.
+     * 
+     * @param[in] data    Pointer to the field.
+     * @param[in] deleter The deleter to release the field with.
+     */
+    Storage(T* data, const Deleter& deleter) noexcept
+        : Deleter{deleter}
+        , data{data} {}
+
+    T* data; // Pointer to unique field.
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+UniquePtr<T[], Deleter>::UniquePtr(T* data, const Deleter& deleter) noexcept
+    : myStorage{data, deleter} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+UniquePtr<T[], Deleter>::UniquePtr(UniquePtr&& other) noexcept
+    : myStorage{other.myStorage.data, other.deleter()} 
+{ 
+    other.myStorage.data = nullptr; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+UniquePtr<T[], Deleter>::~UniquePtr() noexcept { reset(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+UniquePtr<T[], Deleter>& UniquePtr<T[], Deleter>::operator=(UniquePtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset(other.release());
+        deleter() = other.deleter();
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+UniquePtr<T[], Deleter>::operator bool() const noexcept { return myStorage.data != nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+T& UniquePtr<T[], Deleter>::operator[](const size_t index) noexcept 
+{ 
+    return myStorage.data[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+const T& UniquePtr<T[], Deleter>::operator[](const size_t index) const noexcept 
+{ 
+    return myStorage.data[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+T* UniquePtr<T[], Deleter>::get() noexcept { return myStorage.data; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+const T* UniquePtr<T[], Deleter>::get() const noexcept { return myStorage.data; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+Deleter& UniquePtr<T[], Deleter>::deleter() noexcept { return myStorage; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+const Deleter& UniquePtr<T[], Deleter>::deleter() const noexcept { return myStorage; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+void UniquePtr<T[], Deleter>::reset(T* newData) noexcept
 {
-    T* copy{myData};
-    myData = nullptr;
+    T* oldData{myStorage.data};
+    myStorage.data = newData;
+    if (oldData) { deleter()(oldData); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Deleter>
+T* UniquePtr<T[], Deleter>::release() noexcept
+{
+    T* copy{myStorage.data};
+    myStorage.data = nullptr;
     return copy;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
-UniquePtr<T> makeUnique(Args&&... args)
+UniquePtr<T> makeUnique(Args&&... args) noexcept
 {
-    return UniquePtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return UniquePtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-UniquePtr<T> makeUnique()
+UniquePtr<T[]> makeUnique() noexcept
+{
+    return UniquePtr<T[]>{utils::newMemory<T>(Size)};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t SlabSize, typename... Args>
+UniquePtr<T, PoolDelete<T, SlabSize>> allocateUnique(Pool<T, SlabSize>& pool, 
+                                                     Args&&... args) noexcept
+{
+    using Ptr = UniquePtr<T, PoolDelete<T, SlabSize>>;
+    auto data{pool.allocate()};
+    if (nullptr == data) { return Ptr{nullptr, PoolDelete<T, SlabSize>{pool}}; }
+    return Ptr{utils::constructAt(data, utils::forward<Args>(args)...), 
+               PoolDelete<T, SlabSize>{pool}};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+UniquePtr<T, BlockPoolDelete<T>> allocateUnique(BlockPool& pool, Args&&... args) noexcept
+{
+    using Ptr = UniquePtr<T, BlockPoolDelete<T>>;
+    auto block{sizeof(T) <= pool.blockSize() ? pool.allocate() : nullptr};
+    if (nullptr == block) { return Ptr{nullptr, BlockPoolDelete<T>{pool}}; }
+    return Ptr{utils::constructAt(static_cast<T*>(block), utils::forward<Args>(args)...), 
+               BlockPoolDelete<T>{pool}};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+UniquePtr<T[], BlockPoolDelete<T[]>> allocateBuffer(BlockPool& pool) noexcept
 {
-    return UniquePtr<T>{utils::newMemory<T>(Size)};
+    return UniquePtr<T[], BlockPoolDelete<T[]>>{static_cast<T*>(pool.allocate()), 
+                                                BlockPoolDelete<T[]>{pool}};
 }
 
-} // namespace memory
\ No newline at end of file
+} // namespace memory
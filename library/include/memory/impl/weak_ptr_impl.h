@@ -0,0 +1,131 @@
+/**
+ * @brief Implementation details of class memory::WeakPtr.
+ *
+ * @note Don't include this header, use <weak_ptr.h> instead!
+ */
+#pragma once
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>::WeakPtr() noexcept
+    : myData{nullptr}
+    , myControl{nullptr}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>::WeakPtr(const SharedPtr<T, Policy>& shared) noexcept
+    : myData{nullptr}
+    , myControl{nullptr}
+{
+    acquire(shared.myData, shared.myControl);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>::WeakPtr(const WeakPtr& other) noexcept
+    : myData{nullptr}
+    , myControl{nullptr}
+{
+    acquire(other.myData, other.myControl);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>::WeakPtr(WeakPtr&& other) noexcept
+    : myData{other.myData}
+    , myControl{other.myControl}
+{
+    other.myData    = nullptr;
+    other.myControl = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>::~WeakPtr() noexcept { reset(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>& WeakPtr<T, Policy>::operator=(const SharedPtr<T, Policy>& shared) noexcept
+{
+    // Acquire before releasing in case the shared pointer is only kept alive by this reference.
+    auto control{myControl};
+    myControl = nullptr;
+    acquire(shared.myData, shared.myControl);
+    if (control) { SharedPtr<T, Policy>::releaseWeak(control); }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>& WeakPtr<T, Policy>::operator=(const WeakPtr& other) noexcept
+{
+    if (this != &other)
+    {
+        auto control{myControl};
+        myControl = nullptr;
+        acquire(other.myData, other.myControl);
+        if (control) { SharedPtr<T, Policy>::releaseWeak(control); }
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+WeakPtr<T, Policy>& WeakPtr<T, Policy>::operator=(WeakPtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        myData          = other.myData;
+        myControl       = other.myControl;
+        other.myData    = nullptr;
+        other.myControl = nullptr;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+SharedPtr<T, Policy> WeakPtr<T, Policy>::lock() const noexcept
+{
+    // The object may be destroyed concurrently, hence only take ownership if it's still owned.
+    if (myControl && Policy::incrementIfNonZero(myControl->useCount))
+    {
+        return SharedPtr<T, Policy>{myData, myControl};
+    }
+    return SharedPtr<T, Policy>{};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+bool WeakPtr<T, Policy>::expired() const noexcept { return 0U == useCount(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+size_t WeakPtr<T, Policy>::useCount() const noexcept
+{
+    return myControl ? Policy::load(myControl->useCount) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void WeakPtr<T, Policy>::reset() noexcept
+{
+    auto control{myControl};
+    myData    = nullptr;
+    myControl = nullptr;
+    if (control) { SharedPtr<T, Policy>::releaseWeak(control); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Policy>
+void WeakPtr<T, Policy>::acquire(T* data, Control* control) noexcept
+{
+    myData    = data;
+    myControl = control;
+    if (myControl) { Policy::increment(myControl->weakCount); }
+}
+} // namespace memory
@@ -0,0 +1,207 @@
+/**
+ * @brief Intrusive pointer implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "memory/ref_count.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+template <typename T>
+class IntrusivePtr;
+
+/**
+ * @brief Base class holding the reference count of objects owned by memory::IntrusivePtr.
+ *
+ *        Derive T from RefCounted<T> (CRTP) to place the count inside the object itself. When
+ *        the last pointer is released, T::destroy() is invoked, which deletes the object via
+ *        the utils memory helpers by default. Declare a static destroy() in T to override it,
+ *        e.g. to return the object to a pool.
+ *
+ * @tparam T      The derived type.
+ * @tparam Policy The reference counting policy (default = SingleContextCount). Use
+ *                AtomicCount for objects shared between interrupt service routines and the
+ *                main loop.
+ */
+template <typename T, typename Policy = SingleContextCount>
+class RefCounted
+{
+public:
+    /** Reference counting policy of the object. */
+    using RefCountPolicy = Policy;
+
+    /**
+     * @brief Get the number of pointers sharing ownership of the object.
+     *
+     * @return The reference count.
+     */
+    size_t refCount() const noexcept;
+
+    /**
+     * @brief Delete object after the last pointer to it has been released.
+     *
+     * @param[in] object Pointer to the object to delete. The object must have been allocated
+     *                   via utils::newObject().
+     */
+    static void destroy(T* object) noexcept;
+
+protected:
+    /**
+     * @brief Create object without owners.
+     */
+    RefCounted() noexcept;
+
+    /**
+     * @brief Create copy of an object, which doesn't share the owners of the original.
+     */
+    RefCounted(const RefCounted&) noexcept;
+
+    /**
+     * @brief Delete object. Non-virtual, the object is deleted via T::destroy().
+     */
+    ~RefCounted() noexcept = default;
+
+    /**
+     * @brief Keep the owners when assigning another object.
+     *
+     * @return Reference to this object.
+     */
+    RefCounted& operator=(const RefCounted&) noexcept;
+
+private:
+    friend class IntrusivePtr<T>;
+
+    mutable typename Policy::Type myRefCount; // The number of pointers owning the object.
+};
+
+/**
+ * @brief Intrusive pointer implementation.
+ *
+ *        The reference count is held by the object, see memory::RefCounted, hence the pointer
+ *        is pointer-sized and no control block is allocated. Since the count is found via the
+ *        object, new owners can also be created from raw pointers, e.g. from `this`.
+ *
+ * @tparam T The pointer type. Must derive from RefCounted<T>.
+ */
+template <typename T>
+class IntrusivePtr final
+{
+public:
+    /**
+     * @brief Create new intrusive pointer.
+     *
+     * @param[in] data Pointer to the object for which to share ownership (default = none).
+     */
+    IntrusivePtr(T* data = nullptr) noexcept;
+
+    /**
+     * @brief Create new intrusive pointer, which shares ownership with another pointer.
+     *
+     * @param[in] other Reference to other intrusive pointer to copy from.
+     */
+    IntrusivePtr(const IntrusivePtr& other) noexcept;
+
+    /**
+     * @brief Create new intrusive pointer, which takes ownership from another pointer.
+     *
+     * @param[in] other Reference to other intrusive pointer to move from.
+     */
+    IntrusivePtr(IntrusivePtr&& other) noexcept;
+
+    /**
+     * @brief Release ownership before deletion.
+     *
+     * @note Deletion only occurs if this is the last pointer to the object.
+     */
+    ~IntrusivePtr() noexcept;
+
+    /**
+     * @brief Share ownership with another intrusive pointer.
+     *
+     * @param[in] other Reference to other intrusive pointer to copy from.
+     *
+     * @return Reference to this intrusive pointer.
+     */
+    IntrusivePtr& operator=(const IntrusivePtr& other) noexcept;
+
+    /**
+     * @brief Take ownership from another intrusive pointer.
+     *
+     * @param[in] other Reference to other intrusive pointer to move from.
+     *
+     * @return Reference to this intrusive pointer.
+     */
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept;
+
+    /**
+     * @brief Check if the pointer isn't null.
+     *
+     * @return True if the pointer isn't null, false otherwise.
+     */
+    operator bool() const noexcept;
+
+    /**
+     * @brief Overload of operator * to provide held data.
+     *
+     * @return Reference to held data.
+     */
+    T& operator*() const noexcept;
+
+    /**
+     * @brief Overload of operator -> to provide held data.
+     *
+     * @return Pointer to held data.
+     */
+    T* operator->() const noexcept;
+
+    /**
+     * @brief Get pointer to held data.
+     *
+     * @return Pointer to held data.
+     */
+    T* get() const noexcept;
+
+    /**
+     * @brief Get the number of pointers sharing ownership of held data.
+     *
+     * @return The reference count, or 0 if the pointer is null.
+     */
+    size_t useCount() const noexcept;
+
+    /**
+     * @brief Reset intrusive pointer by releasing currently held data.
+     *
+     * @param[in] newData Pointer to new object to share ownership of (default = none).
+     */
+    void reset(T* newData = nullptr) noexcept;
+
+private:
+    /** Reference counting policy of the object. */
+    using Policy = typename T::RefCountPolicy;
+
+    static void acquire(T* data) noexcept;
+    static void release(T* data) noexcept;
+
+    T* myData; // Pointer to the owned object.
+};
+
+/**
+ * @brief Create intrusive pointer holding a new object.
+ *
+ * @tparam T    The object type. Must derive from RefCounted<T>.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ *
+ * @param[in] args The arguments to pass to the constructor of T.
+ *
+ * @return Intrusive pointer holding ownership over the new object, or a null pointer if the
+ *         allocation failed.
+ */
+template <typename T, typename... Args>
+IntrusivePtr<T> makeIntrusive(Args&&... args) noexcept;
+
+} // namespace memory
+
+#include "impl/intrusive_ptr_impl.h"
@@ -0,0 +1,144 @@
+/**
+ * @brief Fixed-block memory pool implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+namespace memory
+{
+/**
+ * @brief Fixed-block memory pool.
+ * 
+ *        Memory is allocated in slabs holding a fixed number of blocks, each large enough to 
+ *        hold one instance of T. Released blocks are kept in a free list, hence allocation and 
+ *        deallocation are O(1) and only require the heap when a new slab is needed.
+ *        Slabs are kept until the pool is deleted.
+ * 
+ *        The pool only provides memory, objects must be constructed and destroyed by the user.
+ * 
+ *        This class is non-copyable.
+ * 
+ * @tparam T        The block type.
+ * @tparam SlabSize The number of blocks per slab. Must be greater than 0.
+ */
+template <typename T, size_t SlabSize = 8U>
+class Pool final
+{
+    // Generate a compiler error if the slab size is set to 0.
+    static_assert(SlabSize > 0U, "Slab size must be greater than 0!");
+
+public:
+    /**
+     * @brief Create empty pool.
+     */
+    Pool() noexcept;
+
+    /**
+     * @brief Create pool overtaking the slabs of another pool.
+     * 
+     *        The other pool is emptied once the move operation is completed.
+     * 
+     * @param[in] other Reference to the pool to move slabs from.
+     */
+    Pool(Pool&& other) noexcept;
+
+    /**
+     * @brief Delete pool and release all slabs.
+     * 
+     * @note All blocks must have been returned to the pool before deletion.
+     */
+    ~Pool() noexcept;
+
+    /**
+     * @brief Release all slabs and overtake the slabs of another pool.
+     * 
+     *        The other pool is emptied once the move operation is completed.
+     * 
+     * @param[in] other Reference to the pool to move slabs from.
+     * 
+     * @return Reference to this pool.
+     */
+    Pool& operator=(Pool&& other) noexcept;
+
+    /**
+     * @brief Allocate a block from the pool.
+     * 
+     *        A new slab is allocated if no free blocks are left.
+     * 
+     * @return Pointer to uninitialized memory for one instance of T, or nullptr if the 
+     *         allocation failed.
+     */
+    T* allocate() noexcept;
+
+    /**
+     * @brief Return a block to the pool.
+     * 
+     * @param[in] block Pointer to the block to return. The object it holds must already have 
+     *                  been destroyed.
+     */
+    void deallocate(T* block) noexcept;
+
+    /**
+     * @brief Allocate slabs until the given number of blocks are free.
+     * 
+     *        Call this method at startup to make subsequent allocations heap-free.
+     * 
+     * @param[in] blockCount The number of free blocks to reserve.
+     * 
+     * @return True if the blocks were reserved, false otherwise.
+     */
+    bool reserve(size_t blockCount) noexcept;
+
+    /**
+     * @brief Get the number of slabs allocated by the pool.
+     * 
+     * @return The number of slabs.
+     */
+    size_t slabCount() const noexcept;
+
+    /**
+     * @brief Get the number of free blocks in the pool.
+     * 
+     * @return The number of free blocks.
+     */
+    size_t freeCount() const noexcept;
+
+    /**
+     * @brief Get the number of blocks per slab.
+     * 
+     * @return The slab size.
+     */
+    static constexpr size_t slabSize() noexcept { return SlabSize; }
+
+    Pool(const Pool&)            = delete; // No copy constructor.
+    Pool& operator=(const Pool&) = delete; // No copy assignment.
+
+private:
+    /** Block holding either an object or a link to the next free block. */
+    union Block;
+
+    /** Slab holding a fixed number of blocks. */
+    struct Slab;
+
+    bool addSlab() noexcept;
+    void release() noexcept;
+
+    /** Pointer to the most recently allocated slab. */
+    Slab* mySlabs;
+
+    /** Pointer to the first free block. */
+    Block* myFreeList;
+
+    /** The number of slabs allocated by the pool. */
+    size_t mySlabCount;
+
+    /** The number of free blocks in the pool. */
+    size_t myFreeCount;
+};
+} // namespace memory
+
+#include "impl/pool_impl.h"
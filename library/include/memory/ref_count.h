@@ -0,0 +1,107 @@
+/**
+ * @brief Reference counting policies for the reference-counted pointers.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "utils/utils.h"
+
+namespace memory
+{
+/**
+ * @brief Reference counting policy for objects only shared within a single context.
+ *
+ *        The count is updated with plain operations, which is the cheapest option. Use this
+ *        policy unless the pointers are copied or released from both interrupt service
+ *        routines and the main loop, or from several threads on the host.
+ */
+struct SingleContextCount
+{
+    /** Reference count type. */
+    using Type = size_t;
+
+    /**
+     * @brief Get the value of a reference count.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The value of the count.
+     */
+    static inline Type load(const Type& count) noexcept;
+
+    /**
+     * @brief Increment a reference count.
+     *
+     * @param[in] count Reference to the count.
+     */
+    static inline void increment(Type& count) noexcept;
+
+    /**
+     * @brief Increment a reference count unless it has reached 0.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return True if the count was incremented, false if it was 0.
+     */
+    static inline bool incrementIfNonZero(Type& count) noexcept;
+
+    /**
+     * @brief Decrement a reference count.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The value of the count after decrementation.
+     */
+    static inline Type decrement(Type& count) noexcept;
+};
+
+/**
+ * @brief Reference counting policy for objects shared between several contexts.
+ *
+ *        The count is updated atomically: on the target, interrupts are disabled during each
+ *        update via utils::InterruptGuard, on the host real atomic operations are used, since
+ *        the simulator runs each context in a separate thread.
+ */
+struct AtomicCount
+{
+    /** Reference count type. */
+    using Type = size_t;
+
+    /**
+     * @brief Get the value of a reference count atomically.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The value of the count.
+     */
+    static inline Type load(const Type& count) noexcept;
+
+    /**
+     * @brief Increment a reference count atomically.
+     *
+     * @param[in] count Reference to the count.
+     */
+    static inline void increment(Type& count) noexcept;
+
+    /**
+     * @brief Increment a reference count atomically unless it has reached 0.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return True if the count was incremented, false if it was 0.
+     */
+    static inline bool incrementIfNonZero(Type& count) noexcept;
+
+    /**
+     * @brief Decrement a reference count atomically.
+     *
+     * @param[in] count Reference to the count.
+     *
+     * @return The value of the count after decrementation.
+     */
+    static inline Type decrement(Type& count) noexcept;
+};
+} // namespace memory
+
+#include "impl/ref_count_impl.h"
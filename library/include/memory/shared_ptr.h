@@ -3,161 +3,265 @@
  */
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory/pool.h"
+#include "memory/ref_count.h"
 #include "utils/utils.h"
 
 namespace memory
 {
+template <typename T, typename Policy>
+class WeakPtr;
+
 /**
  * @brief Shared pointer implementation.
- * 
- * @tparam T The pointer type.
+ *
+ *        The pointers sharing ownership of an object also share a control block holding the
+ *        reference count.
+ *
+ *        Prefer makeShared() or allocateShared() over taking ownership of a raw pointer: these
+ *        place the object next to its control block, hence only one allocation is needed and
+ *        the reference count shares cache line with the object.
+ *
+ *        Non-owning references can be held via memory::WeakPtr. The object is destroyed when
+ *        the last shared pointer releases its ownership, while the memory of the control block
+ *        is kept until the last weak pointer is released as well.
+ *
+ * @tparam T      The pointer type.
+ * @tparam Policy The reference counting policy (default = SingleContextCount). Use
+ *                AtomicCount for objects shared between interrupt service routines and the
+ *                main loop.
  */
-template <typename T>
+template <typename T, typename Policy = SingleContextCount>
 class SharedPtr final
 {
 public:
+    /** Block holding a control block and the object it controls. */
+    struct Block;
+
     /**
      * @brief Create new shared pointer.
-     * 
-     * @param[in] data Pointer to data for which to take ownership (default = none).
+     *
+     *        A control block is allocated separately if data isn't null.
+     *
+     * @param[in] data Pointer to data for which to take ownership (default = none). The data
+     *                 must have been allocated via utils::newObject().
      */
     SharedPtr(T* data = nullptr) noexcept;
 
     /**
      * @brief Create new shared pointer, which shares ownership with another pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to copy from.
      */
-    SharedPtr(const SharedPtr<T>& other) noexcept;
+    SharedPtr(const SharedPtr& other) noexcept;
 
     /**
      * @brief Create new shared pointer, which takes ownership over memory owned by other pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to move memory from.
      */
-    SharedPtr(SharedPtr<T>&& other) noexcept;
+    SharedPtr(SharedPtr&& other) noexcept;
 
     /**
      * @brief Release allocated resources before deletion.
-     * 
+     *
      * @note Deletion only occurs if this is the last pointer to point at the shared memory.
      */
     ~SharedPtr() noexcept;
 
     /**
      * @brief Copy resources from other shared pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to copy from.
-     * 
+     *
      * @return Reference to this shared pointer.
      */
-    SharedPtr<T>& operator=(const SharedPtr<T>& other) noexcept;
-   
+    SharedPtr& operator=(const SharedPtr& other) noexcept;
+
     /**
      * @brief Move resources from other shared pointer.
-     * 
+     *
      * @param[in] other Reference to other shared pointer to move memory from.
-     * 
+     *
      * @return Reference to this shared pointer.
      */
-    SharedPtr<T>& operator=(SharedPtr<T>&& other) noexcept;
+    SharedPtr& operator=(SharedPtr&& other) noexcept;
 
     /**
      * @brief Check if the pointer isn't null.
-     * 
+     *
      * @return True if the pointer isn't null, false otherwise.
      */
-    operator bool() const;
+    operator bool() const noexcept;
 
     /**
      * @brief Overload of operator * to provide held data.
-     * 
+     *
      * @return Reference to held data.
      */
     T& operator*() noexcept;
-    
+
     /**
      * @brief Overload of operator * to provide held data.
-     * 
+     *
      * @return Reference to held data.
      */
     const T& operator*() const noexcept;
-    
+
     /**
      * @brief Overload of operator -> to provide held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     T* operator->() noexcept;
 
     /**
      * @brief Overload of operator -> to provide held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     const T* operator->() const noexcept;
 
     /**
      * @brief Get pointer to held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     T* get() noexcept;
 
     /**
      * @brief Get pointer to held data.
-     * 
+     *
      * @return Pointer to held data.
      */
     const T* get() const noexcept;
 
+    /**
+     * @brief Get the number of pointers sharing ownership of held data.
+     *
+     * @return The reference count, or 0 if the pointer is null.
+     */
+    size_t useCount() const noexcept;
+
     /**
      * @brief Reset shared pointer by releasing currently held data.
-     * 
+     *
      * @param[in] newData Pointer to new data to take ownership over (default = none).
      */
     void reset(T* newData = nullptr) noexcept;
 
     /**
-     * @brief Release ownership over held data.
-     * 
-     * @return Pointer to currently held data.
+     * @brief Release this pointer's ownership over held data.
+     *
+     *        The data is deleted if no other pointer shares ownership of it.
+     *
+     * @return Pointer to the data if still owned by other pointers, else nullptr.
      */
     T* release() noexcept;
 
 private:
+    template <typename U, typename P, typename... Args>
+    friend SharedPtr<U, P> makeShared(Args&&... args) noexcept;
+
+    template <typename U, size_t Size, typename P>
+    friend SharedPtr<U, P> makeShared() noexcept;
+
+    template <typename U, typename P, size_t SlabSize, typename... Args>
+    friend SharedPtr<U, P> allocateShared(Pool<typename SharedPtr<U, P>::Block, SlabSize>& pool,
+                                          Args&&... args) noexcept;
 
-    static size_t* newRefCount() noexcept;
-    void decrementReferenceCount() noexcept;
-    void releaseMemory() noexcept;
+    friend class WeakPtr<T, Policy>;
+
+    /** Control block shared by the pointers owning the same data. */
+    struct Control;
+
+    /** Function destroying the data or releasing the memory of a control block. */
+    using Destroyer = void (*)(Control*, T*) noexcept;
+
+    SharedPtr(T* data, Control* control) noexcept;
+    static Control* newControl(Destroyer destroy, Destroyer deallocate) noexcept;
+    static void initControl(Control& control, Destroyer destroy, Destroyer deallocate) noexcept;
+    static void releaseWeak(Control* control) noexcept;
+    static void destroyObject(Control* control, T* data) noexcept;
+    static void destroySeparate(Control* control, T* data) noexcept;
+    static void destroyField(Control* control, T* data) noexcept;
+    static void deallocateControl(Control* control, T* data) noexcept;
+    static void deallocateBlock(Control* control, T* data) noexcept;
+    template <size_t SlabSize>
+    static void deallocatePoolBlock(Control* control, T* data) noexcept;
 
     T* myData;          // Pointer to shared data/memory.
-    size_t* myRefCount; // The number of pointers sharing ownership of data.
+    Control* myControl; // Control block holding the reference count.
 };
 
 /**
- * @brief Create shared pointer taking ownership of given data.
- * 
- * @tparam T The pointer type.
- * @tparam Args The types of arguments to pass to the constructor of T.
- * 
+ * @brief Pool of blocks for shared objects, see allocateShared().
+ *
+ * @tparam T        The object type.
+ * @tparam SlabSize The number of blocks per slab (default = 8).
+ * @tparam Policy   The reference counting policy (default = SingleContextCount).
+ */
+template <typename T, size_t SlabSize = 8U, typename Policy = SingleContextCount>
+using SharedPool = Pool<typename SharedPtr<T, Policy>::Block, SlabSize>;
+
+/**
+ * @brief Create shared pointer holding a new object.
+ *
+ *        The object and its control block are placed in a single block, i.e. one allocation.
+ *        After startup, this block is served by a block pool registered in memory::allocator
+ *        if one with large enough blocks is present.
+ *
+ * @tparam T      The object type.
+ * @tparam Policy The reference counting policy (default = SingleContextCount).
+ * @tparam Args   The types of arguments to pass to the constructor of T.
+ *
  * @param[in] args The arguments to pass to the constructor of T.
- * 
- * @return Shared pointer holding ownership over given data.
+ *
+ * @return Shared pointer holding ownership over the new object, or a null pointer if the
+ *         allocation failed.
  */
-template <typename T, typename... Args>
-SharedPtr<T> makeShared(Args&&... args) noexcept;
+template <typename T, typename Policy = SingleContextCount, typename... Args>
+SharedPtr<T, Policy> makeShared(Args&&... args) noexcept;
 
 /**
  * @brief Create shared pointer pointing at new field of given size.
- * 
- * @tparam T    The pointer/field type.
- * @tparam Size The size of new field.
- * 
- * @return Shared pointer holding ownership over the new field.
+ *
+ *        The field is uninitialized, hence only trivially destructible types are supported.
+ *
+ * @tparam T      The pointer/field type.
+ * @tparam Size   The size of new field.
+ * @tparam Policy The reference counting policy (default = SingleContextCount).
+ *
+ * @return Shared pointer holding ownership over the new field, or a null pointer if the
+ *         allocation failed.
+ */
+template <typename T, size_t Size, typename Policy = SingleContextCount>
+SharedPtr<T, Policy> makeShared() noexcept;
+
+/**
+ * @brief Create shared pointer holding a new object allocated from the given pool.
+ *
+ *        The object and its control block are placed in a single pool block, hence creation
+ *        and deletion are O(1) and don't need the heap once the pool has free blocks.
+ *
+ * @tparam T        The object type.
+ * @tparam Policy   The reference counting policy (default = SingleContextCount).
+ * @tparam SlabSize The number of blocks per slab of the pool.
+ * @tparam Args     The types of arguments to pass to the constructor of T.
+ *
+ * @param[in] pool Reference to the pool to allocate from. The pool must outlive the object
+ *                 and all weak pointers to it.
+ * @param[in] args The arguments to pass to the constructor of T.
+ *
+ * @return Shared pointer holding ownership over the new object, or a null pointer if the
+ *         allocation failed.
  */
-template <typename T, size_t Size>
-SharedPtr<T> makeShared() noexcept;
+template <typename T, typename Policy = SingleContextCount, size_t SlabSize, typename... Args>
+SharedPtr<T, Policy> allocateShared(SharedPool<T, SlabSize, Policy>& pool,
+                                    Args&&... args) noexcept;
 
 } // namespace memory
 
@@ -3,6 +3,11 @@
  */
 #pragma once
 
+#include <stddef.h>
+
+#include "memory/block_pool.h"
+#include "memory/deleter.h"
+#include "memory/pool.h"
 #include "utils/utils.h"
 
 namespace memory
@@ -10,11 +15,16 @@ namespace memory
 /**
  * @brief Unique pointer implementation.
  * 
+ *        The held data is released via the deleter, see memory/deleter.h for deleters of 
+ *        objects allocated from pools and arenas. The deleter is stored as an empty base, 
+ *        hence the pointer is pointer-sized if the deleter is stateless.
+ * 
  *        This class is non-copyable.
  * 
- * @tparam T The pointer type.
+ * @tparam T       The pointer type.
+ * @tparam Deleter The deleter type (default = DefaultDelete<T>). Must be a class type.
  */
-template <typename T>
+template <typename T, typename Deleter = DefaultDelete<T>>
 class UniquePtr final
 {
 public:
@@ -22,16 +32,17 @@ public:
     /**
      * @brief Create new unique pointer.
      * 
-     * @param[in] data Pointer to data for which to take ownership (default = none).
+     * @param[in] data    Pointer to data for which to take ownership (default = none).
+     * @param[in] deleter The deleter to release the data with (default = default constructed).
      */
-    explicit UniquePtr(T* data = nullptr) noexcept;
+    explicit UniquePtr(T* data = nullptr, const Deleter& deleter = Deleter{}) noexcept;
 
     /**
      * @brief Create new unique pointer, which takes ownership over memory owned by other pointer.
      * 
      * @param[in] other Reference to other unique pointer to move memory from.
      */
-    UniquePtr(UniquePtr<T>&& other) noexcept;
+    UniquePtr(UniquePtr&& other) noexcept;
 
     /**
      * @brief Release allocated resources before deletion.
@@ -45,14 +56,14 @@ public:
      * 
      * @return Reference to this unique pointer.
      */
-    UniquePtr<T>& operator=(UniquePtr<T>&& other) noexcept;
+    UniquePtr& operator=(UniquePtr&& other) noexcept;
 
     /**
      * @brief Check if the pointer isn't null.
      * 
      * @return True if the pointer isn't null, false otherwise.
      */
-    operator bool() const;
+    operator bool() const noexcept;
 
     /**
      * @brief Overload of operator * to provide held data.
@@ -96,6 +107,20 @@ public:
      */
     const T* get() const noexcept;
 
+    /**
+     * @brief Get the deleter releasing held data.
+     * 
+     * @return Reference to the deleter.
+     */
+    Deleter& deleter() noexcept;
+
+    /**
+     * @brief Get the deleter releasing held data.
+     * 
+     * @return Reference to the deleter.
+     */
+    const Deleter& deleter() const noexcept;
+
     /**
      * @brief Reset unique pointer by releasing currently held data.
      * 
@@ -110,22 +135,148 @@ public:
      */
     T* release() noexcept;
 
-    UniquePtr(const UniquePtr<T>&)               = delete; // No copy constructor.
-    UniquePtr<T>& operator=(const UniquePtr<T>&) = delete; // No copy assignment.
+    UniquePtr(const UniquePtr&)            = delete; // No copy constructor.
+    UniquePtr& operator=(const UniquePtr&) = delete; // No copy assignment.
 
 private:
-    T* myData; // Pointer to unique data.
+    /** Storage of the data, with the deleter as empty base. */
+    struct Storage;
+
+    Storage myStorage; // Pointer to unique data and the deleter.
 };
 
 /**
- * @brief Create unique pointer taking ownership of given data.
+ * @brief Unique pointer implementation for fields and buffers.
+ * 
+ *        The size of the field isn't stored, hence the pointer is pointer-sized if the 
+ *        deleter is stateless.
+ * 
+ *        This class is non-copyable.
+ * 
+ * @tparam T       The element type.
+ * @tparam Deleter The deleter type (default = DefaultDelete<T[]>). Must be a class type.
+ */
+template <typename T, typename Deleter>
+class UniquePtr<T[], Deleter> final
+{
+public:
+
+    /**
+     * @brief Create new unique pointer.
+     * 
+     * @param[in] data    Pointer to field for which to take ownership (default = none).
+     * @param[in] deleter The deleter to release the field with (default = default constructed).
+     */
+    explicit UniquePtr(T* data = nullptr, const Deleter& deleter = Deleter{}) noexcept;
+
+    /**
+     * @brief Create new unique pointer, which takes ownership over memory owned by other pointer.
+     * 
+     * @param[in] other Reference to other unique pointer to move memory from.
+     */
+    UniquePtr(UniquePtr&& other) noexcept;
+
+    /**
+     * @brief Release allocated resources before deletion.
+     */
+    ~UniquePtr() noexcept;
+
+    /**
+     * @brief Move resources from other unique pointer.
+     * 
+     * @param[in] other Reference to other unique pointer to move memory from.
+     * 
+     * @return Reference to this unique pointer.
+     */
+    UniquePtr& operator=(UniquePtr&& other) noexcept;
+
+    /**
+     * @brief Check if the pointer isn't null.
+     * 
+     * @return True if the pointer isn't null, false otherwise.
+     */
+    operator bool() const noexcept;
+
+    /**
+     * @brief Overload of operator [] to provide an element of held field.
+     * 
+     * @param[in] index Index of the element. Must be within the field.
+     * 
+     * @return Reference to the element.
+     */
+    T& operator[](size_t index) noexcept;
+
+    /**
+     * @brief Overload of operator [] to provide an element of held field.
+     * 
+     * @param[in] index Index of the element. Must be within the field.
+     * 
+     * @return Reference to the element.
+     */
+    const T& operator[](size_t index) const noexcept;
+
+    /**
+     * @brief Get pointer to held field.
+     * 
+     * @return Pointer to held field.
+     */
+    T* get() noexcept;
+
+    /**
+     * @brief Get pointer to held field.
+     * 
+     * @return Pointer to held field.
+     */
+    const T* get() const noexcept;
+
+    /**
+     * @brief Get the deleter releasing held field.
+     * 
+     * @return Reference to the deleter.
+     */
+    Deleter& deleter() noexcept;
+
+    /**
+     * @brief Get the deleter releasing held field.
+     * 
+     * @return Reference to the deleter.
+     */
+    const Deleter& deleter() const noexcept;
+
+    /**
+     * @brief Reset unique pointer by releasing currently held field.
+     * 
+     * @param[in] newData Pointer to new field to take ownership over (default = none).
+     */
+    void reset(T* newData = nullptr) noexcept;
+
+    /**
+     * @brief Release ownership over held field.
+     * 
+     * @return Pointer to currently held field.
+     */
+    T* release() noexcept;
+
+    UniquePtr(const UniquePtr&)            = delete; // No copy constructor.
+    UniquePtr& operator=(const UniquePtr&) = delete; // No copy assignment.
+
+private:
+    /** Storage of the field, with the deleter as empty base. */
+    struct Storage;
+
+    Storage myStorage; // Pointer to unique field and the deleter.
+};
+
+/**
+ * @brief Create unique pointer holding a new object.
  * 
  * @tparam T The pointer type.
  * @tparam Args The types of arguments to pass to the constructor of T.
  * 
  * @param[in] args The arguments to pass to the constructor of T.
  * 
- * @return Unique pointer holding ownership over given data.
+ * @return Unique pointer holding ownership over the new object, or a null pointer if the 
+ *         allocation failed.
  */
 template <typename T, typename... Args>
 UniquePtr<T> makeUnique(Args&&... args) noexcept;
@@ -133,13 +284,61 @@ UniquePtr<T> makeUnique(Args&&... args) noexcept;
 /**
  * @brief Create unique pointer pointing at new field of given size.
  * 
- * @tparam T    The pointer/field type.
+ * @tparam T    The field type. Must be trivially destructible, since the field is uninitialized.
  * @tparam Size The size of new field.
  * 
- * @return Unique pointer holding ownership over the new field.
+ * @return Unique pointer holding ownership over the new field, or a null pointer if the 
+ *         allocation failed.
  */
 template <typename T, size_t Size>
-UniquePtr<T> makeUnique() noexcept;
+UniquePtr<T[]> makeUnique() noexcept;
+
+/**
+ * @brief Create unique pointer holding a new object allocated from the given pool.
+ * 
+ * @tparam T        The object type.
+ * @tparam SlabSize The number of blocks per slab of the pool.
+ * @tparam Args     The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] pool Reference to the pool to allocate from. The pool must outlive the object.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return Unique pointer holding ownership over the new object, or a null pointer if the 
+ *         allocation failed.
+ */
+template <typename T, size_t SlabSize, typename... Args>
+UniquePtr<T, PoolDelete<T, SlabSize>> allocateUnique(Pool<T, SlabSize>& pool, 
+                                                     Args&&... args) noexcept;
+
+/**
+ * @brief Create unique pointer holding a new object allocated from the given block pool.
+ * 
+ * @tparam T    The object type.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] pool Reference to the pool to allocate from. The pool must outlive the object.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return Unique pointer holding ownership over the new object, or a null pointer if the 
+ *         allocation failed or the blocks of the pool are too small.
+ */
+template <typename T, typename... Args>
+UniquePtr<T, BlockPoolDelete<T>> allocateUnique(BlockPool& pool, Args&&... args) noexcept;
+
+/**
+ * @brief Create unique pointer holding a buffer spanning a block of the given block pool.
+ * 
+ *        The buffer is uninitialized and holds pool.blockSize() / sizeof(T) elements.
+ * 
+ * @tparam T The element type. Must be trivially destructible.
+ * 
+ * @param[in] pool Reference to the pool to allocate from. The pool must outlive the buffer.
+ * 
+ * @return Unique pointer holding ownership over the buffer, or a null pointer if the 
+ *         allocation failed.
+ */
+template <typename T>
+UniquePtr<T[], BlockPoolDelete<T[]>> allocateBuffer(BlockPool& pool) noexcept;
 
 } // namespace memory
 
@@ -0,0 +1,126 @@
+/**
+ * @brief Weak pointer implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "memory/ref_count.h"
+#include "memory/shared_ptr.h"
+
+namespace memory
+{
+/**
+ * @brief Weak pointer implementation.
+ *
+ *        A weak pointer references an object owned by shared pointers without owning it,
+ *        which is suitable for caches and observers. Use lock() to gain temporary ownership;
+ *        the object may have been destroyed in the meantime.
+ *
+ *        The control block of the object is kept until the last weak pointer is released.
+ *
+ * @tparam T      The pointer type.
+ * @tparam Policy The reference counting policy (default = SingleContextCount). Must match the
+ *                policy of the associated shared pointers.
+ */
+template <typename T, typename Policy = SingleContextCount>
+class WeakPtr final
+{
+public:
+    /**
+     * @brief Create new empty weak pointer.
+     */
+    WeakPtr() noexcept;
+
+    /**
+     * @brief Create new weak pointer referencing the object held by a shared pointer.
+     *
+     * @param[in] shared Reference to the shared pointer.
+     */
+    WeakPtr(const SharedPtr<T, Policy>& shared) noexcept;
+
+    /**
+     * @brief Create new weak pointer referencing the same object as another weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to copy from.
+     */
+    WeakPtr(const WeakPtr& other) noexcept;
+
+    /**
+     * @brief Create new weak pointer, which takes over the reference of another weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to move from.
+     */
+    WeakPtr(WeakPtr&& other) noexcept;
+
+    /**
+     * @brief Release the reference before deletion.
+     */
+    ~WeakPtr() noexcept;
+
+    /**
+     * @brief Reference the object held by a shared pointer.
+     *
+     * @param[in] shared Reference to the shared pointer.
+     *
+     * @return Reference to this weak pointer.
+     */
+    WeakPtr& operator=(const SharedPtr<T, Policy>& shared) noexcept;
+
+    /**
+     * @brief Copy the reference of another weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to copy from.
+     *
+     * @return Reference to this weak pointer.
+     */
+    WeakPtr& operator=(const WeakPtr& other) noexcept;
+
+    /**
+     * @brief Move the reference of another weak pointer.
+     *
+     * @param[in] other Reference to other weak pointer to move from.
+     *
+     * @return Reference to this weak pointer.
+     */
+    WeakPtr& operator=(WeakPtr&& other) noexcept;
+
+    /**
+     * @brief Gain shared ownership of the referenced object.
+     *
+     * @return Shared pointer holding the object, or a null pointer if the object has been
+     *         destroyed.
+     */
+    SharedPtr<T, Policy> lock() const noexcept;
+
+    /**
+     * @brief Check whether the referenced object has been destroyed.
+     *
+     * @return True if the object has been destroyed or no object is referenced, else false.
+     */
+    bool expired() const noexcept;
+
+    /**
+     * @brief Get the number of shared pointers owning the referenced object.
+     *
+     * @return The reference count, or 0 if the object has been destroyed.
+     */
+    size_t useCount() const noexcept;
+
+    /**
+     * @brief Release the reference.
+     */
+    void reset() noexcept;
+
+private:
+    /** Control block shared with the owning pointers. */
+    using Control = typename SharedPtr<T, Policy>::Control;
+
+    void acquire(T* data, Control* control) noexcept;
+
+    T* myData;          // Pointer to the referenced data.
+    Control* myControl; // Control block holding the reference counts.
+};
+} // namespace memory
+
+#include "impl/weak_ptr_impl.h"
@@ -58,6 +58,25 @@ public:
     bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount, 
                double learningRate = 0.01) noexcept;
 
+    /**
+     * @brief Train the model with training data stored in arrays.
+     * 
+     *        Use this overload with statically allocated data, such as a container::StaticVector, 
+     *        to train the model without using the heap.
+     * 
+     * @param[in] trainIn Pointer to the training data input values.
+     * @param[in] trainOut Pointer to the training data output values.
+     * @param[in] setCount The number of training sets, i.e. input/output pairs. 
+     *                     Must be greater than 0.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     * 
+     * @return True on success, false on failure.
+     */
+    bool train(const double* trainIn, const double* trainOut, size_t setCount, 
+               size_t epochCount, double learningRate = 0.01) noexcept;
+
     Fixed(const Fixed&)            = delete; // No copy constructor.
     Fixed(Fixed&&)                 = delete; // No move constructor.
     Fixed& operator=(const Fixed&) = delete; // No copy assignment.
@@ -0,0 +1,60 @@
+/**
+ * @brief Free-running cycle clock for the profilers.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace profiler
+{
+/**
+ * @brief Free-running cycle clock for the profilers.
+ *
+ *        While started, timer 1 runs free at the CPU clock, hence the clock counts CPU cycles.
+ *        The 16-bit timestamp is a single register read, suitable for short measurements such 
+ *        as ISR durations. The 32-bit cycle count is extended by the timer 1 overflow 
+ *        interrupt, suitable for measurements up to ~268 s.
+ *
+ *        On the host, the clock is read from the CPU time of the calling thread and converted
+ *        to CPU cycles, so preemption by the host isn't measured; it's valid even when not 
+ *        started. Hence host measurements must start and stop in the same thread.
+ */
+namespace clock
+{
+/**
+ * @brief Start the clock.
+ *
+ *        Timer 1 is reserved for the clock. Start the clock before creating the timers, since 
+ *        the timer driver may use timer 1 otherwise.
+ *
+ * @return True if the clock is running, false if timer 1 is in use.
+ */
+bool start() noexcept;
+
+/**
+ * @brief Stop the clock and release timer 1.
+ */
+void stop() noexcept;
+
+/**
+ * @brief Check whether the clock is running.
+ *
+ * @return True if the clock is running, false otherwise.
+ */
+bool isRunning() noexcept;
+
+/**
+ * @brief Get the current timestamp.
+ *
+ * @return The timestamp in CPU cycles, wrapping around at 65536.
+ */
+uint16_t timestamp() noexcept;
+
+/**
+ * @brief Get the current cycle count.
+ *
+ * @return The cycle count, wrapping around at 2^32.
+ */
+uint32_t cycles() noexcept;
+} // namespace clock
+} // namespace profiler
@@ -0,0 +1,189 @@
+/**
+ * @brief Cycle-budget profiler for event handlers.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "profiler/clock.h"
+
+namespace profiler
+{
+/**
+ * @brief Cycle-budget profiler for event handlers.
+ *
+ *        Handlers are instrumented with the HANDLER_PROFILE macro, which measures the 
+ *        execution time of the enclosing scope via the profiler clock, see profiler::clock. 
+ *        The call count, total and worst-case execution time are accumulated into a profile 
+ *        per handler, which holds the cycle budget of the handler. The profiles are typically 
+ *        kept in a fixed table owned by the instrumented class.
+ *
+ *        The macro compiles to nothing unless HANDLER_PROFILING is defined.
+ */
+namespace handler
+{
+/** True if the profiler is compiled in, i.e. if HANDLER_PROFILING is defined. */
+#ifdef HANDLER_PROFILING
+constexpr bool Enabled{true};
+#else
+constexpr bool Enabled{false};
+#endif
+
+/**
+ * @brief Execution time profile of a handler, measured in CPU cycles.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Profile final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] name The name of the handler.
+     * @param[in] budget_cycles The maximum execution time allowed for the handler.
+     */
+    constexpr explicit Profile(const char* name, const uint32_t budget_cycles) noexcept
+        : myName{name}
+        , myBudget{budget_cycles}
+        , myCount{}
+        , myWorst{}
+        , myTotal{}
+    {}
+
+    /**
+     * @brief Get the name of the handler.
+     *
+     * @return The name of the handler.
+     */
+    const char* name() const noexcept { return myName; }
+
+    /**
+     * @brief Get the cycle budget of the handler.
+     *
+     * @return The maximum execution time allowed for the handler.
+     */
+    uint32_t budget() const noexcept { return myBudget; }
+
+    /**
+     * @brief Get the number of calls.
+     *
+     * @return The number of calls.
+     */
+    uint32_t count() const noexcept;
+
+    /**
+     * @brief Get the worst-case execution time.
+     *
+     * @return The longest execution time of the handler.
+     */
+    uint32_t worst() const noexcept;
+
+    /**
+     * @brief Get the total execution time.
+     *
+     * @return The sum of the execution times of the handler.
+     */
+    uint64_t total() const noexcept;
+
+    /**
+     * @brief Get the mean execution time.
+     *
+     * @return The mean execution time, 0 if the handler hasn't been called.
+     */
+    uint32_t mean() const noexcept;
+
+    /**
+     * @brief Check whether the handler has stayed within its budget.
+     *
+     * @return True if the worst-case execution time is within the budget, false otherwise.
+     */
+    bool isWithinBudget() const noexcept { return worst() <= myBudget; }
+
+    /**
+     * @brief Record a call of the handler.
+     *
+     * @param[in] duration_cycles The execution time of the call.
+     */
+    void record(uint32_t duration_cycles) noexcept;
+
+    /**
+     * @brief Clear the recorded calls.
+     */
+    void reset() noexcept;
+
+    Profile()                          = delete; // No default constructor.
+    Profile(const Profile&)            = delete; // No copy constructor.
+    Profile(Profile&&)                 = delete; // No move constructor.
+    Profile& operator=(const Profile&) = delete; // No copy assignment.
+    Profile& operator=(Profile&&)      = delete; // No move assignment.
+
+private:
+    /** The name of the handler. */
+    const char* const myName;
+
+    /** The maximum execution time allowed for the handler. */
+    const uint32_t myBudget;
+
+    /** The number of calls. */
+    uint32_t myCount;
+
+    /** The longest execution time. */
+    uint32_t myWorst;
+
+    /** The sum of the execution times. */
+    uint64_t myTotal;
+};
+
+/**
+ * @brief Scoped handler measurement, recording the call when leaving the scope.
+ *
+ *        Calls are only recorded while the profiler clock is running. Use the HANDLER_PROFILE
+ *        macro rather than this class, so the measurement compiles out.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Scope final
+{
+public:
+    /**
+     * @brief Start measuring a call of a handler.
+     *
+     * @param[in] profile The profile of the handler.
+     */
+    explicit Scope(Profile& profile) noexcept
+        : myProfile{profile}
+        , myStart{clock::cycles()}
+    {}
+
+    /**
+     * @brief Record the call.
+     */
+    ~Scope() noexcept
+    {
+        if (clock::isRunning()) { myProfile.record(clock::cycles() - myStart); }
+    }
+
+    Scope()                        = delete; // No default constructor.
+    Scope(const Scope&)            = delete; // No copy constructor.
+    Scope(Scope&&)                 = delete; // No move constructor.
+    Scope& operator=(const Scope&) = delete; // No copy assignment.
+    Scope& operator=(Scope&&)      = delete; // No move assignment.
+
+private:
+    /** The profile of the handler. */
+    Profile& myProfile;
+
+    /** The cycle count at the start of the call. */
+    const uint32_t myStart;
+};
+} // namespace handler
+} // namespace profiler
+
+#ifdef HANDLER_PROFILING
+/** Profile the execution time of the enclosing handler. */
+#define HANDLER_PROFILE(profile) const profiler::handler::Scope handlerProfileScope{profile}
+#else
+/** Profiling compiled out. */
+#define HANDLER_PROFILE(profile)
+#endif
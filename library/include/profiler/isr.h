@@ -0,0 +1,195 @@
+/**
+ * @brief Interrupt latency and ISR duration profiler.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "profiler/clock.h"
+
+namespace profiler
+{
+/**
+ * @brief Interrupt latency and ISR duration profiler.
+ *
+ *        Interrupt service routines are instrumented with the ISR_PROFILE and 
+ *        ISR_PROFILE_LATENCY macros, which timestamp the entry and exit of the routine. The
+ *        durations are accumulated per vector into min, max, mean and a histogram. The 
+ *        latency, i.e. the time from the interrupt request until the routine is entered, is 
+ *        recorded for vectors whose source counter can tell, such as timer overflows.
+ *
+ *        The timestamps are taken from the profiler clock, see profiler::clock, hence 
+ *        durations up to 65535 cycles (~4 ms) are measured exactly. Calls are only recorded 
+ *        while the clock is running.
+ *
+ *        The macros compile to nothing unless ISR_PROFILING is defined. Without it, no 
+ *        statistics are kept.
+ */
+namespace isr
+{
+/**
+ * @brief Enumeration of profiled interrupt vectors.
+ */
+enum class Vector : uint8_t
+{
+    Timer0,     // Timer 0 overflow.
+    Timer1,     // Timer 1 compare match A.
+    Timer2,     // Timer 2 overflow.
+    PinChangeB, // Pin change on I/O port B.
+    PinChangeC, // Pin change on I/O port C.
+    PinChangeD, // Pin change on I/O port D.
+    Count,      // The number of profiled vectors.
+};
+
+/** True if the profiler is compiled in, i.e. if ISR_PROFILING is defined. */
+#ifdef ISR_PROFILING
+constexpr bool Enabled{true};
+#else
+constexpr bool Enabled{false};
+#endif
+
+/** The number of histogram buckets. */
+constexpr uint8_t BucketCount{8U};
+
+/**
+ * @brief Get the upper limit of a histogram bucket.
+ *
+ *        Bucket 0 holds durations below 32 cycles, each following bucket doubles the limit.
+ *        The last bucket holds all durations above the second last limit.
+ *
+ * @param[in] bucket The index of the bucket.
+ *
+ * @return The exclusive upper limit of the bucket in CPU cycles.
+ */
+constexpr uint16_t bucketLimit(const uint8_t bucket) noexcept
+{
+    return (BucketCount - 1U) > bucket ? static_cast<uint16_t>(32U << bucket) : 0xFFFFU;
+}
+
+/**
+ * @brief ISR statistics of an interrupt vector, measured in CPU cycles.
+ */
+struct Stats
+{
+    /** The number of calls. */
+    uint32_t count;
+
+    /** The shortest duration. */
+    uint16_t min;
+
+    /** The longest duration. */
+    uint16_t max;
+
+    /** The longest latency, 0 if unknown. */
+    uint16_t maxLatency;
+
+    /** The sum of the durations behind the mean, halved with sampleCount before overflowing. */
+    uint32_t total;
+
+    /** The number of durations summed in total. */
+    uint32_t sampleCount;
+
+    /** The number of calls per duration bucket, saturated at the max value. */
+    uint16_t buckets[BucketCount];
+
+    /**
+     * @brief Get the mean duration.
+     *
+     * @return The mean duration, 0 if the vector hasn't been called.
+     */
+    uint16_t mean() const noexcept
+    {
+        return 0U < sampleCount ? static_cast<uint16_t>(total / sampleCount) : 0U;
+    }
+};
+
+/**
+ * @brief Clear the statistics of all vectors.
+ */
+void reset() noexcept;
+
+/**
+ * @brief Get the statistics of an interrupt vector.
+ *
+ * @param[in] vector The interrupt vector.
+ *
+ * @return A copy of the statistics, all zeros for invalid vectors.
+ */
+Stats stats(Vector vector) noexcept;
+
+/**
+ * @brief Get the name of an interrupt vector.
+ *
+ * @param[in] vector The interrupt vector.
+ *
+ * @return The name of the vector.
+ */
+const char* name(Vector vector) noexcept;
+
+/**
+ * @brief Record a completed call of an interrupt vector.
+ *
+ *        Ignored unless the profiler clock is running.
+ *
+ * @param[in] vector The interrupt vector.
+ * @param[in] entry The timestamp at the entry of the routine.
+ * @param[in] latency The latency in CPU cycles, 0 if unknown.
+ */
+void record(Vector vector, uint16_t entry, uint16_t latency) noexcept;
+
+/**
+ * @brief Scoped ISR measurement, recording the call when leaving the scope.
+ *
+ *        Use the ISR_PROFILE macros rather than this class, so the measurement compiles out.
+ */
+class Scope final
+{
+public:
+    /**
+     * @brief Start measuring a call of an interrupt vector.
+     *
+     * @param[in] vector The interrupt vector.
+     * @param[in] latency The latency in CPU cycles (default = 0, unknown).
+     */
+    explicit Scope(const Vector vector, const uint16_t latency = 0U) noexcept
+        : myEntry{clock::timestamp()}
+        , myLatency{latency}
+        , myVector{vector}
+    {}
+
+    /**
+     * @brief Record the call.
+     */
+    ~Scope() noexcept { record(myVector, myEntry, myLatency); }
+
+    Scope()                        = delete; // No default constructor.
+    Scope(const Scope&)            = delete; // No copy constructor.
+    Scope(Scope&&)                 = delete; // No move constructor.
+    Scope& operator=(const Scope&) = delete; // No copy assignment.
+    Scope& operator=(Scope&&)      = delete; // No move assignment.
+
+private:
+    /** The timestamp at the entry of the routine. */
+    const uint16_t myEntry;
+
+    /** The latency in CPU cycles, 0 if unknown. */
+    const uint16_t myLatency;
+
+    /** The interrupt vector. */
+    const Vector myVector;
+};
+} // namespace isr
+} // namespace profiler
+
+#ifdef ISR_PROFILING
+/** Profile the duration of the enclosing ISR. */
+#define ISR_PROFILE(vector) const profiler::isr::Scope isrProfileScope{vector}
+
+/** Profile the duration and the latency (in CPU cycles) of the enclosing ISR. */
+#define ISR_PROFILE_LATENCY(vector, latency) \
+    const profiler::isr::Scope isrProfileScope{vector, static_cast<uint16_t>(latency)}
+#else
+/** Profiling compiled out. */
+#define ISR_PROFILE(vector)
+#define ISR_PROFILE_LATENCY(vector, latency)
+#endif
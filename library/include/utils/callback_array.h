@@ -4,20 +4,27 @@
 #pragma once
 
 #include "container/array.h"
+#include "utils/delegate.h"
 
 namespace container
 {
 /**
  * @brief Class for implementation of callback arrays.
  * 
+ *        The callbacks are stored as delegates, hence both plain functions and member functions
+ *        bound to an object can be added, see utils::Delegate.
+ * 
  *        This class is non-copyable and non-movable.
  * 
  * @tparam Size The array size. Must be greater than 0.
  */
 template <size_t Size>
-class CallbackArray : public Array<void (*)(), Size>
+class CallbackArray : public Array<utils::Delegate<void()>, Size>
 {
 public:
+    /** Callback type. */
+    using Callback = utils::Delegate<void()>;
+
     /**
      * @brief Create empty callback array of given size.
      */
@@ -36,7 +43,7 @@ public:
      *
      * @return True if the callback routine was added, false otherwise.
      */
-    bool add(void (*callback)(), size_t index) noexcept;
+    bool add(const Callback& callback, size_t index) noexcept;
 
      /**
      * @brief Remove callback routine at given index of callback array.
@@ -54,7 +61,7 @@ public:
      *
      * @return True if the callback routine was removed, false otherwise.
      */
-    bool remove(void (*callback)(), size_t index) noexcept;
+    bool remove(const Callback& callback, size_t index) noexcept;
 
      /**
      * @brief Invoke callback at given index of callback array.
@@ -0,0 +1,148 @@
+/**
+ * @brief Implementation of delegates, i.e. callbacks carrying a context.
+ */
+#pragma once
+
+namespace utils
+{
+/**
+ * @brief Delegate, see the specialization for function types below.
+ *
+ * @tparam Signature The function type of the delegate, e.g. void().
+ */
+template <typename Signature>
+class Delegate;
+
+/**
+ * @brief Class for implementation of delegates.
+ *
+ *        A delegate holds a stub function and a context pointer, which makes it possible to
+ *        bind member functions and callable objects without any allocation. The target is
+ *        called directly by the stub, hence invoking a bound member function costs one indirect
+ *        call. Plain function pointers are supported as well, at the cost of a second
+ *        indirect call.
+ *
+ *        Bound objects aren't owned by the delegate and must outlive it.
+ *
+ * @tparam R    The return type.
+ * @tparam Args The argument types.
+ */
+template <typename R, typename... Args>
+class Delegate<R(Args...)> final
+{
+public:
+    /** Function pointer type. */
+    using Function = R (*)(Args...);
+
+    /**
+     * @brief Create empty delegate.
+     */
+    constexpr Delegate() noexcept;
+
+    /**
+     * @brief Create delegate calling given function.
+     *
+     * @param[in] function Pointer to the function to call. A null pointer creates an empty
+     *                     delegate.
+     */
+    constexpr Delegate(Function function) noexcept;
+
+    /**
+     * @brief Create delegate calling given member function on given object.
+     *
+     * @tparam Method Pointer to the member function to call, e.g. &Class::method.
+     * @tparam C      The object type.
+     *
+     * @param[in] object Reference to the object. Must outlive the delegate.
+     *
+     * @return The new delegate.
+     */
+    template <auto Method, typename C>
+    static constexpr Delegate bind(C& object) noexcept;
+
+    /**
+     * @brief Create delegate calling given function, which is resolved at compile time.
+     *
+     * @tparam FreeFunction Pointer to the function to call.
+     *
+     * @return The new delegate.
+     */
+    template <Function FreeFunction>
+    static constexpr Delegate bind() noexcept;
+
+    /**
+     * @brief Create delegate calling given callable object, such as a lambda.
+     *
+     * @tparam C The callable type.
+     *
+     * @param[in] callable Reference to the callable object. Must outlive the delegate.
+     *
+     * @return The new delegate.
+     */
+    template <typename C>
+    static constexpr Delegate bind(C& callable) noexcept;
+
+    /**
+     * @brief Check whether the delegate is bound to a target.
+     *
+     * @return True if the delegate is bound, false otherwise.
+     */
+    constexpr explicit operator bool() const noexcept;
+
+    /**
+     * @brief Invoke the target of the delegate, which must be bound.
+     *
+     * @param[in] args The arguments to pass to the target.
+     *
+     * @return The value returned by the target.
+     */
+    R operator()(Args... args) const noexcept;
+
+    /**
+     * @brief Check whether two delegates are bound to the same target.
+     *
+     * @param[in] other Reference to the other delegate.
+     *
+     * @return True if the delegates are bound to the same target, false otherwise.
+     */
+    bool operator==(const Delegate& other) const noexcept;
+
+    /**
+     * @brief Check whether two delegates are bound to different targets.
+     *
+     * @param[in] other Reference to the other delegate.
+     *
+     * @return True if the delegates are bound to different targets, false otherwise.
+     */
+    bool operator!=(const Delegate& other) const noexcept;
+
+private:
+    /** Context of the target, i.e. the object or the function pointer. */
+    union Context
+    {
+        constexpr Context(void* object) noexcept : object{object} {}
+        constexpr Context(Function function) noexcept : function{function} {}
+
+        void* object;      // Pointer to the object, if any.
+        Function function; // Pointer to the function, if any.
+    };
+
+    /** Stub invoking the target. */
+    using Stub = R (*)(Context, Args...) noexcept;
+
+    template <auto Method, typename C>
+    static R invokeMethod(Context context, Args... args) noexcept;
+    template <Function FreeFunction>
+    static R invokeStatic(Context context, Args... args) noexcept;
+    template <typename C>
+    static R invokeCallable(Context context, Args... args) noexcept;
+    static R invokeFunction(Context context, Args... args) noexcept;
+
+    constexpr Delegate(Stub stub, Context context) noexcept;
+
+    Stub myStub;       // Stub invoking the target.
+    Context myContext; // Context of the target.
+};
+} // namespace utils
+
+#include "impl/delegate_impl.h"
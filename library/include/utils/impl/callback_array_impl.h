@@ -17,10 +17,10 @@ CallbackArray<Size>::~CallbackArray() noexcept = default;
 
 // -----------------------------------------------------------------------------
 template <size_t Size>
-bool CallbackArray<Size>::add(void (*callback)(), const size_t index) noexcept
+bool CallbackArray<Size>::add(const Callback& callback, const size_t index) noexcept
 {
-    if (!isIndexValid(index) || (callback == nullptr)) { return false; }
-    Array<void (*)(), Size>::myData[index] = callback;
+    if (!isIndexValid(index) || !callback) { return false; }
+    Array<Callback, Size>::myData[index] = callback;
     return true;
 }
 
@@ -29,19 +29,19 @@ template <size_t Size>
 bool CallbackArray<Size>::remove(const size_t index) noexcept
 {
     if (!isIndexValid(index)) { return false; }
-    Array<void (*)(), Size>::myData[index] = nullptr;
+    Array<Callback, Size>::myData[index] = Callback{};
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <size_t Size>
-bool CallbackArray<Size>::remove(void (*callback)(), const size_t index) noexcept
+bool CallbackArray<Size>::remove(const Callback& callback, const size_t index) noexcept
 {
     for (auto& myCallback : *this)
     {
         if (myCallback == callback) 
         { 
-            myCallback = nullptr; 
+            myCallback = Callback{}; 
             return true;
         }
     }
@@ -53,7 +53,7 @@ template <size_t Size>
 bool CallbackArray<Size>::invoke(const size_t index) noexcept
 {
     if (!isIndexValid(index) || !isCallbackDefined(index)) { return false; }
-    Array<void (*)(), Size>::myData[index]();
+    Array<Callback, Size>::myData[index]();
     return true;
 }
 
@@ -65,7 +65,7 @@ bool CallbackArray<Size>::isIndexValid(const size_t index) const noexcept { retu
 template <size_t Size>
 bool CallbackArray<Size>::isCallbackDefined(const size_t index) const noexcept
 {
-    return this->myData[index] != nullptr;
+    return static_cast<bool>(this->myData[index]);
 }
 
 } // namespace container
\ No newline at end of file
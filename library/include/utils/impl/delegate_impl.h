@@ -0,0 +1,114 @@
+/**
+ * @brief Implementation details of utils::Delegate class.
+ *
+ * @note Don't include this header, use <delegate.h> instead!
+ */
+#pragma once
+
+namespace utils
+{
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+constexpr Delegate<R(Args...)>::Delegate() noexcept
+    : myStub{nullptr}
+    , myContext{static_cast<void*>(nullptr)}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+constexpr Delegate<R(Args...)>::Delegate(const Function function) noexcept
+    : myStub{nullptr != function ? &invokeFunction : nullptr}
+    , myContext{function}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <auto Method, typename C>
+constexpr Delegate<R(Args...)> Delegate<R(Args...)>::bind(C& object) noexcept
+{
+    return Delegate{&invokeMethod<Method, C>,
+                    Context{const_cast<void*>(static_cast<const void*>(&object))}};
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <typename Delegate<R(Args...)>::Function FreeFunction>
+constexpr Delegate<R(Args...)> Delegate<R(Args...)>::bind() noexcept
+{
+    return Delegate{&invokeStatic<FreeFunction>, Context{static_cast<void*>(nullptr)}};
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <typename C>
+constexpr Delegate<R(Args...)> Delegate<R(Args...)>::bind(C& callable) noexcept
+{
+    return Delegate{&invokeCallable<C>,
+                    Context{const_cast<void*>(static_cast<const void*>(&callable))}};
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+constexpr Delegate<R(Args...)>::operator bool() const noexcept { return nullptr != myStub; }
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+R Delegate<R(Args...)>::operator()(Args... args) const noexcept
+{
+    return myStub(myContext, args...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+bool Delegate<R(Args...)>::operator==(const Delegate& other) const noexcept
+{
+    if (myStub != other.myStub) { return false; }
+    if (&invokeFunction == myStub) { return myContext.function == other.myContext.function; }
+    return myContext.object == other.myContext.object;
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+bool Delegate<R(Args...)>::operator!=(const Delegate& other) const noexcept
+{
+    return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <auto Method, typename C>
+R Delegate<R(Args...)>::invokeMethod(const Context context, Args... args) noexcept
+{
+    return (static_cast<C*>(context.object)->*Method)(args...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <typename Delegate<R(Args...)>::Function FreeFunction>
+R Delegate<R(Args...)>::invokeStatic(const Context, Args... args) noexcept
+{
+    return FreeFunction(args...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+template <typename C>
+R Delegate<R(Args...)>::invokeCallable(const Context context, Args... args) noexcept
+{
+    return (*static_cast<C*>(context.object))(args...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+R Delegate<R(Args...)>::invokeFunction(const Context context, Args... args) noexcept
+{
+    return context.function(args...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename R, typename... Args>
+constexpr Delegate<R(Args...)>::Delegate(const Stub stub, const Context context) noexcept
+    : myStub{stub}
+    , myContext{context}
+{}
+} // namespace utils
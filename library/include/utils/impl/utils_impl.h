@@ -23,49 +23,110 @@ constexpr T&& forward(typename RemoveReference<T>::type&& object) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-constexpr void set(volatile T& reg, const uint8_t bit) noexcept
+inline T atomicLoad(const T& source) noexcept
+{
+    static_assert(type_traits::is_integral<T>::value, 
+                  "Atomic load only supported for integral types!");
+#ifdef TESTSUITE
+    // The host runs producers and consumers in separate threads, use real atomics.
+    return __atomic_load_n(&source, __ATOMIC_ACQUIRE);
+#else
+    T value{};
+    if constexpr (sizeof(T) == 1U) 
+    { 
+        value = *static_cast<const volatile T*>(&source); 
+    }
+    else
+    {
+        InterruptGuard guard{};
+        value = *static_cast<const volatile T*>(&source);
+    }
+    // Prevent the compiler from moving subsequent memory accesses in front of the load.
+    __atomic_signal_fence(__ATOMIC_ACQUIRE);
+    return value;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void atomicStore(T& destination, const T value) noexcept
+{
+    static_assert(type_traits::is_integral<T>::value, 
+                  "Atomic store only supported for integral types!");
+#ifdef TESTSUITE
+    // The host runs producers and consumers in separate threads, use real atomics.
+    __atomic_store_n(&destination, value, __ATOMIC_RELEASE);
+#else
+    // Prevent the compiler from moving preceding memory accesses past the store.
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+
+    if constexpr (sizeof(T) == 1U) 
+    { 
+        *static_cast<volatile T*>(&destination) = value; 
+    }
+    else
+    {
+        InterruptGuard guard{};
+        *static_cast<volatile T*>(&destination) = value;
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr void set(T& reg, const uint8_t bit) noexcept
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
-    reg |= (1ULL << bit);
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
+    reg |= static_cast<Type>(static_cast<Type>(1U) << bit);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Bits>
-constexpr void set(volatile T& reg, const uint8_t bit, Bits&&... bits) noexcept
+constexpr void set(T& reg, const uint8_t bit, Bits&&... bits) noexcept
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
     set(reg, bit);
     set(reg, forward<const Bits>(bits)...);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-constexpr void clear(volatile T& reg, const uint8_t bit) noexcept  
+constexpr void clear(T& reg, const uint8_t bit) noexcept  
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
-    reg &= ~(1ULL << bit);
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
+    reg &= static_cast<Type>(~(static_cast<Type>(1U) << bit));
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Bits>
-constexpr void clear(volatile T& reg, const uint8_t bit, Bits&&... bits) noexcept  
+constexpr void clear(T& reg, const uint8_t bit, Bits&&... bits) noexcept  
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
     clear(reg, bit);
     clear(reg, forward<const Bits>(bits)...);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-constexpr void toggle(volatile T& reg, const uint8_t bit) noexcept
+constexpr void toggle(T& reg, const uint8_t bit) noexcept
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
-    reg ^= (1ULL << bit);
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
+    reg ^= static_cast<Type>(static_cast<Type>(1U) << bit);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Bits>
-constexpr void toggle(volatile T& reg, const uint8_t bit, Bits&&... bits) noexcept  
+constexpr void toggle(T& reg, const uint8_t bit, Bits&&... bits) noexcept  
 {
     toggle(reg, bit);
     toggle(reg, forward<const Bits>(bits)...);
@@ -73,17 +134,21 @@ constexpr void toggle(volatile T& reg, const uint8_t bit, Bits&&... bits) noexce
 
 // -----------------------------------------------------------------------------
 template <typename T>
-constexpr bool read(const volatile T& reg, const uint8_t bit) noexcept  
+constexpr bool read(const T& reg, const uint8_t bit) noexcept  
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
-    return reg & (1ULL << bit);
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
+    return reg & (static_cast<Type>(1U) << bit);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Bits>
-constexpr bool read(const volatile T& reg, const uint8_t bit, Bits&&... bits) noexcept 
+constexpr bool read(const T& reg, const uint8_t bit, Bits&&... bits) noexcept 
 {
-    static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
+    using Type = typename type_traits::remove_volatile<T>::type;
+    static_assert(type_traits::is_unsigned<Type>::value, 
+                  "Invalid data type used for bit operation!");
     return read(reg, bit) | read(reg, forward<const Bits>(bits)...);
 }
 
@@ -125,29 +190,40 @@ template <typename T, typename... Args>
 inline T* newObject(Args&&... args) noexcept
 {
     auto block{newMemory<T>()};
-    if (block) { *block = T{forward<Args>(args)...}; }
+    if (block) { constructAt(block, forward<Args>(args)...); }
     return block;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+inline T* constructAt(T* address, Args&&... args) noexcept
+{
+    return new (address) T{forward<Args>(args)...};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void destroyAt(T* address) noexcept { address->~T(); }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 inline T* newMemory(const size_t size) noexcept
 {
-    return static_cast<T*>(malloc(sizeof(T) * size));
+    return static_cast<T*>(memory::allocator::allocate(sizeof(T) * size));
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline T* reallocMemory(T* block, const size_t newSize) noexcept
 {
-    return static_cast<T*>(realloc(block, sizeof(T) * newSize));
+    return static_cast<T*>(memory::allocator::reallocate(block, sizeof(T) * newSize));
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline void deleteMemory(T* &block) noexcept
 {
-    free(block);
+    memory::allocator::deallocate(block);
     block = nullptr;
 }
 
@@ -242,4 +242,77 @@ struct is_reference<T&>
 {
     static const bool value{true};
 };
+
+/**
+ * @brief Check if given type is trivially copyable, i.e. can be copied as raw memory.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_copyable
+{
+    // True for types that can be copied via memcpy only.
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+/**
+ * @brief Check if given type is trivially destructible, i.e. its destructor does nothing.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_destructible
+{
+    // True for types whose destructor does nothing only.
+    static const bool value{__has_trivial_destructor(T)};
+};
+
+/**
+ * @brief Remove the volatile qualifier of given type.
+ * 
+ * @tparam T The type to remove the volatile qualifier from.
+ */
+template <typename T>
+struct remove_volatile
+{
+    // T without volatile qualifier.
+    typedef T type;
+};
+
+/**
+ * @brief Specialization for volatile types.
+ * 
+ * @tparam T The type without volatile qualifier.
+ */
+template <typename T>
+struct remove_volatile<volatile T>
+{
+    typedef T type;
+};
+
+/**
+ * @brief Select one of two types at compile time.
+ * 
+ * @tparam Condition The condition to evaluate.
+ * @tparam T1 The type selected if the condition is true.
+ * @tparam T2 The type selected if the condition is false.
+ */
+template <bool Condition, typename T1, typename T2>
+struct conditional
+{
+    // T1 if the condition is true.
+    typedef T1 type;
+};
+
+/**
+ * @brief Specialization selecting the second type if the condition is false.
+ * 
+ * @tparam T1 The type selected if the condition is true.
+ * @tparam T2 The type selected if the condition is false.
+ */
+template <typename T1, typename T2>
+struct conditional<false, T1, T2>
+{
+    typedef T2 type;
+};
 } // namespace type_traits
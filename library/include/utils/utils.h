@@ -8,8 +8,22 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "memory/allocator.h"
 #include "utils/type_traits.h"
 
+#if __has_include(<new>)
+#include <new>
+#else
+/**
+ * @brief Placement new operator, which isn't provided by the AVR toolchain.
+ *
+ * @param[in] address The address to construct the object at.
+ *
+ * @return The given address.
+ */
+inline void* operator new(size_t, void* address) noexcept { return address; }
+#endif
+
 namespace utils 
 {
 /**
@@ -45,6 +59,28 @@ struct RemoveReference
     typedef T type;
 };
 
+/**
+ * @brief Specialization for lvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&>
+{
+    typedef T type;
+};
+
+/**
+ * @brief Specialization for rvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&&>
+{
+    typedef T type;
+};
+
 /**
  * @brief Maintain the value category of given object.
  *
@@ -75,21 +111,83 @@ void globalInterruptEnable() noexcept;
  */
 void globalInterruptDisable() noexcept;
 
+/**
+ * @brief Guard disabling interrupts globally for its lifetime.
+ * 
+ *        The previous interrupt state is restored when the guard is deleted, hence guards 
+ *        can be nested and used in both interrupt and non-interrupt context.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class InterruptGuard final
+{
+public:
+    /**
+     * @brief Save the interrupt state and disable interrupts globally.
+     */
+    InterruptGuard() noexcept;
+
+    /**
+     * @brief Restore the saved interrupt state.
+     */
+    ~InterruptGuard() noexcept;
+
+    InterruptGuard(const InterruptGuard&)            = delete; // No copy constructor.
+    InterruptGuard(InterruptGuard&&)                 = delete; // No move constructor.
+    InterruptGuard& operator=(const InterruptGuard&) = delete; // No copy assignment.
+    InterruptGuard& operator=(InterruptGuard&&)      = delete; // No move assignment.
+
+private:
+    /** The saved status register. */
+    uint8_t myStatus;
+};
+
+/**
+ * @brief Load a value shared between interrupt and non-interrupt context.
+ * 
+ *        The load has acquire semantics, i.e. memory accesses placed after the load are never
+ *        performed before it. Values wider than one byte are read with interrupts disabled
+ *        on the target, since the AVR can't read them in a single instruction.
+ * 
+ * @tparam T The value type. Must be of integral type.
+ * 
+ * @param[in] source Reference to the value to load.
+ * 
+ * @return The loaded value.
+ */
+template <typename T>
+inline T atomicLoad(const T& source) noexcept;
+
+/**
+ * @brief Store a value shared between interrupt and non-interrupt context.
+ * 
+ *        The store has release semantics, i.e. memory accesses placed before the store are 
+ *        completed before it. Values wider than one byte are written with interrupts disabled
+ *        on the target, since the AVR can't write them in a single instruction.
+ * 
+ * @tparam T The value type. Must be of integral type.
+ * 
+ * @param[in] destination Reference to the value to store to.
+ * @param[in] value The value to store.
+ */
+template <typename T>
+inline void atomicStore(T& destination, T value) noexcept;
+
 /**
  * @brief Set a bit of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * 
  * @param[in, out] reg Reference to the register to write to.
  * @param[in] bit The bit to set.
  */
 template <typename T = uint8_t>
-constexpr void set(volatile T& reg, uint8_t bit) noexcept;
+constexpr void set(T& reg, uint8_t bit) noexcept;
 
 /**
  * @brief Set bits of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * @tparam Bits Type for additional bits to set.
  *
  * @param[in, out] reg Reference to the register to write to.
@@ -97,23 +195,23 @@ constexpr void set(volatile T& reg, uint8_t bit) noexcept;
  * @param[in] bits The other bits to set.
  */
 template <typename T = uint8_t, typename... Bits>
-constexpr void set(volatile T& reg, uint8_t bit, Bits&&... bits) noexcept;
+constexpr void set(T& reg, uint8_t bit, Bits&&... bits) noexcept;
 
 /**
  * @brief Clear a bit of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * 
  * @param[in, out] reg Reference to the register to write to.
  * @param[in] bit The bit to clear.
  */
 template <typename T = uint8_t>
-constexpr void clear(volatile T& reg, uint8_t bit) noexcept;
+constexpr void clear(T& reg, uint8_t bit) noexcept;
 
 /**
  * @brief Clear bits of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * @tparam Bits Type for additional bits to set.
  * 
  * @param[in, out] reg Reference to the register to write to.
@@ -121,23 +219,23 @@ constexpr void clear(volatile T& reg, uint8_t bit) noexcept;
  * @param[in] bits The other bits to clear.
  */
 template <typename T = uint8_t, typename... Bits>
-constexpr void clear(volatile T& reg, uint8_t bit, Bits&&... bits) noexcept;
+constexpr void clear(T& reg, uint8_t bit, Bits&&... bits) noexcept;
 
 /**
  * @brief Toggle a bit of the given register.
  * 
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * 
  * @param[in, out] reg Reference to the register to write to.
  * @param[in] bit The bit to toggle.
  */
 template <typename T = uint8_t>
-constexpr void toggle(volatile T& reg, uint8_t bit) noexcept;
+constexpr void toggle(T& reg, uint8_t bit) noexcept;
 
 /**
  * @brief Toggle bits of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * @tparam Bits Type for additional bits to set.
  * 
  * @param[in, out] reg Reference to the register to write to.
@@ -145,12 +243,12 @@ constexpr void toggle(volatile T& reg, uint8_t bit) noexcept;
  * @param[in] bits The other bits to toggle.
  */
 template <typename T = uint8_t, typename... Bits>
-constexpr void toggle(volatile T& reg, uint8_t bit, Bits&&... bits) noexcept;
+constexpr void toggle(T& reg, uint8_t bit, Bits&&... bits) noexcept;
 
 /**
  * @brief Read a bit of the given register.
  * 
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  *
  * @param[in, out] reg Reference to the register to read from.
  * @param[in] bit The given bit to read.
@@ -158,12 +256,12 @@ constexpr void toggle(volatile T& reg, uint8_t bit, Bits&&... bits) noexcept;
  * @return True if the bit is set, false otherwise.
  */
 template <typename T = uint8_t>
-constexpr bool read(const volatile T& reg, uint8_t bit) noexcept;
+constexpr bool read(const T& reg, uint8_t bit) noexcept;
 
 /**
  * @brief Read bits of the given register.
  *
- * @tparam T The register type. Must be of unsigned type.
+ * @tparam T The register type. Must be of unsigned type, volatile or not.
  * @tparam Bits Type for additional bits to set.
  * 
  * @param[in, out] reg Reference to the register to read from.
@@ -173,7 +271,7 @@ constexpr bool read(const volatile T& reg, uint8_t bit) noexcept;
  * @return True if at least one of bits is set, false otherwise.
  */
 template <typename T = uint8_t, typename... Bits>
-constexpr bool read(const volatile T& reg, uint8_t bit, Bits&&... bits) noexcept;
+constexpr bool read(const T& reg, uint8_t bit, Bits&&... bits) noexcept;
 
 /**
  * @brief Calculate the power out of given base and exponent, where power = base ^ exponent.
@@ -218,7 +316,7 @@ template <typename T>
 constexpr bool inRange(T number, T min, T max) noexcept;
 
 /**
- * @brief Allocate a new object on the heap.
+ * @brief Allocate a new object via memory::allocator.
  *
  * @tparam T The field type.
  * @tparam Args The types of arguments to pass to the constructor of T.
@@ -233,7 +331,31 @@ template <typename T, typename... Args>
 inline T* newObject(Args&&... args) noexcept;
 
 /**
- * @brief Allocate a new field on the heap.
+ * @brief Construct a new object at given address.
+ *
+ * @tparam T The object type.
+ * @tparam Args The types of arguments to pass to the constructor of T.
+ * 
+ * @param[in] address Pointer to uninitialized memory to construct the object at.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return A pointer to the new object.
+ */
+template <typename T, typename... Args>
+inline T* constructAt(T* address, Args&&... args) noexcept;
+
+/**
+ * @brief Destroy the object at given address without releasing its memory.
+ *
+ * @tparam T The object type.
+ * 
+ * @param[in] address Pointer to the object to destroy.
+ */
+template <typename T>
+inline void destroyAt(T* address) noexcept;
+
+/**
+ * @brief Allocate a new field via memory::allocator.
  *
  * @tparam T The field type.
  * 
@@ -247,7 +369,7 @@ template <typename T>
 inline T* newMemory(size_t size = 1U) noexcept;
 
 /**
- * @brief Resize referenced heap allocated block via reallocation.
+ * @brief Resize referenced block allocated via memory::allocator.
  *
  * @tparam T The block type.
  * 
@@ -261,7 +383,7 @@ template <typename T>
 inline T* reallocMemory(T* block, size_t newSize) noexcept;
 
 /**
- * @brief Delete heap allocated block via deallocation. 
+ * @brief Delete block allocated via memory::allocator. 
  * 
  *        The pointer to the block is set to null after deallocation.
  * 
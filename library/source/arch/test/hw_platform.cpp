@@ -3,10 +3,9 @@
  */
 #ifdef TESTSUITE
 
-#include <chrono>
 #include <cstdint>
+#include <ctime>
 #include <string>
-#include <thread>
 
 #include "arch/test/hw_platform.h"
 
@@ -24,6 +23,72 @@ namespace test
 /** Array representing registers. */
 RegisterMemory<Memory::Size> Memory::data{};
 
+/** Number of reads made via register proxies, per 8-bit register. */
+std::uint32_t Memory::readCount[Memory::Size]{};
+
+/** Number of writes made via register proxies, per 8-bit register. */
+std::uint32_t Memory::writeCount[Memory::Size]{};
+
+/** Array representing the RAM region shared by the heap and the stack. */
+std::uint8_t Stack::data[Stack::Size]{};
+
+/** Simulated stack pointer, the stack is initially empty. */
+std::uint8_t* Stack::pointer{Stack::data + Stack::Size};
+
+// -----------------------------------------------------------------------------
+std::uint32_t Memory::reads(const std::uint8_t& reg) noexcept
+{
+    return readCount[&reg - data.reg8];
+}
+
+// -----------------------------------------------------------------------------
+std::uint32_t Memory::writes(const std::uint8_t& reg) noexcept
+{
+    return writeCount[&reg - data.reg8];
+}
+
+// -----------------------------------------------------------------------------
+void Memory::resetAccessCounts() noexcept
+{
+    for (std::size_t i{}; i < Size; ++i) 
+    { 
+        readCount[i]  = 0U;
+        writeCount[i] = 0U;
+    }
+}
+
+// -----------------------------------------------------------------------------
+Register::Register(std::uint8_t& reg) noexcept
+    : myIndex{static_cast<std::size_t>(&reg - Memory::data.reg8)}
+{}
+
+// -----------------------------------------------------------------------------
+Register::operator std::uint8_t() const noexcept
+{
+    ++Memory::readCount[myIndex];
+    return Memory::data.reg8[myIndex];
+}
+
+// -----------------------------------------------------------------------------
+Register& Register::operator=(const std::uint8_t value) noexcept
+{
+    ++Memory::writeCount[myIndex];
+    Memory::data.reg8[myIndex] = value;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+Register& Register::operator|=(const std::uint8_t mask) noexcept
+{
+    return *this = static_cast<std::uint8_t>(*this | mask);
+}
+
+// -----------------------------------------------------------------------------
+Register& Register::operator&=(const std::uint8_t mask) noexcept
+{
+    return *this = static_cast<std::uint8_t>(*this & mask);
+}
+
 // -----------------------------------------------------------------------------
 void executeAssemblyCmd(const std::string& cmd) noexcept
 {
@@ -33,16 +98,26 @@ void executeAssemblyCmd(const std::string& cmd) noexcept
     else if ("WDR" == cmd) {}
 }
 
+// -----------------------------------------------------------------------------
+std::uint64_t cpuTime_ns() noexcept
+{
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<std::uint64_t>(time.tv_sec) * 1000000000ULL + time.tv_nsec;
+}
+
 // -----------------------------------------------------------------------------
 void delay_ms(const std::uint16_t ms) noexcept
 {
-    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    const auto end{cpuTime_ns() + ms * 1000000ULL};
+    while (cpuTime_ns() < end) {}
 }
 
 // -----------------------------------------------------------------------------
 void delay_us(const std::uint16_t us) noexcept
 {
-     std::this_thread::sleep_for(std::chrono::microseconds(us));
+    const auto end{cpuTime_ns() + us * 1000ULL};
+    while (cpuTime_ns() < end) {}
 }
 } // namespace test
 
@@ -2,8 +2,9 @@
  * @brief GPIO driver implementation details for ATmega328P.
  */
 #include "arch/avr/hw_platform.h"
+#include "container/intrusive_list.h"
 #include "driver/gpio/atmega328p.h"
-#include "utils/callback_array.h"
+#include "profiler/isr.h"
 #include "utils/utils.h"
 
 namespace driver 
@@ -13,17 +14,17 @@ namespace gpio
 namespace
 {
 /**
- * @brief Structure of indexes for callbacks associated with the I/O ports.
+ * @brief Structure of indexes for the subscribers associated with the I/O ports.
  */
 struct CbIndex
 {
-    /** Index for callback associated with I/O port B. */
+    /** Index for subscribers associated with I/O port B. */
     static constexpr uint8_t PortB{0U};
 
-    /** Index for callback associated with I/O port C. */
+    /** Index for subscribers associated with I/O port C. */
     static constexpr uint8_t PortC{1U};
 
-    /** Index for callback associated with I/O port D. */
+    /** Index for subscribers associated with I/O port D. */
     static constexpr uint8_t PortD{2U};
 };
 
@@ -49,8 +50,11 @@ constexpr uint8_t IoPortCount{3U};
 /** The number of available GPIO pins. */
 constexpr uint8_t PinCount{20U};
 
-/** Pointers to callbacks. */
-container::CallbackArray<IoPortCount> myCallbacks{};
+/** Subscribers to the pin change interrupts of each I/O port. */
+container::IntrusiveList<PinChangeSubscriber> mySubscribers[IoPortCount]{};
+
+/** Pin states of each I/O port at the last pin change interrupt. */
+uint8_t myPinSnapshots[IoPortCount]{};
 
 /** Pin registry (1 = reserved, 0 = free). */
 uint32_t myPinRegistry{};
@@ -58,6 +62,8 @@ uint32_t myPinRegistry{};
 constexpr bool isPinFree(const uint8_t id) noexcept;
 constexpr bool isDirectionValid(const Direction direction) noexcept;
 Hardware* findHw(const Atmega328p::IoPort ioPort) noexcept;
+void refreshPinSnapshot(uint8_t portIndex, const Hardware& hw, uint8_t pinMask) noexcept;
+void dispatchPinChange(uint8_t portIndex, const Hardware& hw) noexcept;
 
 } // namespace
 
@@ -113,24 +119,21 @@ struct Hardware myHwPortD
 };
 
 // -----------------------------------------------------------------------------
-Atmega328p::Atmega328p(const uint8_t pin, const Direction direction, void (*callback)()) noexcept
+Atmega328p::Atmega328p(const uint8_t pin, const Direction direction, 
+                       const utils::Delegate<void()>& callback) noexcept
     : myHw{nullptr}
     , myDirection{direction}
     , myIoPort{getIoPort(pin)}
     , myId{pin}
     , myPin{getPhysicalPin()}
+    , mySubscriber{}
 { 
     // Reserve hardware if the pin is free and the data direction is valid.
     // Put the GPIO in safe sstate on failure.
     if (isPinFree(myId) && isDirectionValid(myDirection))
     {
-        // Register the given callback for the associated I/O port if specified.
-        if (initHw() && (nullptr != callback))
-        {
-            if (PORTB == myHw->portx) { myCallbacks.add(callback, CbIndex::PortB); }
-            else if (PORTC == myHw->portx) { myCallbacks.add(callback, CbIndex::PortC); } 
-            else if (PORTD == myHw->portx) { myCallbacks.add(callback, CbIndex::PortD); }
-        }
+        // Subscribe to the pin change interrupts of the associated I/O port if specified.
+        if (initHw() && callback) { setCallback(callback); }
     }
 }
 
@@ -139,6 +142,7 @@ Atmega328p::~Atmega328p() noexcept
 {   
     // Free resources used for the GPIO before deletion.
     enableInterrupt(false);
+    setCallback(nullptr);
     utils::clear(myHw->ddrx, myPin);
     utils::clear(myHw->portx, myPin);
     utils::clear(myPinRegistry, myId);
@@ -199,6 +203,8 @@ void Atmega328p::enableInterrupt(const bool enable) noexcept
     // Enable/disable interrupts on the associated pin as specified.
     if (enable)
     {
+        refreshPinSnapshot(static_cast<uint8_t>(myIoPort), *myHw, 
+                           static_cast<uint8_t>(1U << myPin));
         utils::globalInterruptEnable();
         utils::set(PCICR, myHw->pcix);
         utils::set(myHw->pcmskx, myPin);
@@ -213,6 +219,27 @@ void Atmega328p::blink(const uint16_t& blinkSpeed_ms) noexcept
     utils::delay_ms(blinkSpeed_ms);
 }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::setCallback(const utils::Delegate<void()>& callback) noexcept
+{
+    // Only register callbacks if the GPIO is initialized.
+    if (!isInitialized()) { return; }
+
+    // The subscribers are traversed by the pin change interrupt, hence they must be updated
+    // with interrupts disabled.
+    utils::InterruptGuard guard{};
+    const auto index{static_cast<uint8_t>(myIoPort)};
+    mySubscriber.callback = callback;
+    mySubscriber.pinMask  = static_cast<uint8_t>(1U << myPin);
+
+    if (!callback) { mySubscriber.unlink(); }
+    else if (!mySubscriber.isLinked())
+    {
+        refreshPinSnapshot(index, *myHw, mySubscriber.pinMask);
+        mySubscribers[index].pushBack(mySubscriber);
+    }
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::IoPort Atmega328p::getIoPort(const uint8_t id) const noexcept
 {
@@ -269,13 +296,25 @@ bool Atmega328p::initHw() noexcept
 }
 
 // -----------------------------------------------------------------------------
-ISR(PCINT0_vect) { myCallbacks.invoke(CbIndex::PortB); }
+ISR(PCINT0_vect) 
+{ 
+    ISR_PROFILE(profiler::isr::Vector::PinChangeB);
+    dispatchPinChange(CbIndex::PortB, myHwPortB); 
+}
 
 // -----------------------------------------------------------------------------
-ISR(PCINT1_vect) { myCallbacks.invoke(CbIndex::PortC); }
+ISR(PCINT1_vect) 
+{ 
+    ISR_PROFILE(profiler::isr::Vector::PinChangeC);
+    dispatchPinChange(CbIndex::PortC, myHwPortC); 
+}
 
 // -----------------------------------------------------------------------------
-ISR(PCINT2_vect) { myCallbacks.invoke(CbIndex::PortD); }
+ISR(PCINT2_vect) 
+{ 
+    ISR_PROFILE(profiler::isr::Vector::PinChangeD);
+    dispatchPinChange(CbIndex::PortD, myHwPortD); 
+}
 
 namespace
 {
@@ -309,6 +348,34 @@ Hardware* findHw(const Atmega328p::IoPort ioPort) noexcept
             return nullptr;
     }
 }
+
+// -----------------------------------------------------------------------------
+void refreshPinSnapshot(const uint8_t portIndex, const Hardware& hw, 
+                        const uint8_t pinMask) noexcept
+{
+    // Take the current state of the given pins as reference, so only subsequent changes are
+    // reported to the subscribers. The snapshot is updated by the pin change interrupt too,
+    // hence the read-modify-write must be made with interrupts disabled.
+    utils::InterruptGuard guard{};
+    auto& snapshot{myPinSnapshots[portIndex]};
+    snapshot = static_cast<uint8_t>((snapshot & ~pinMask) | (hw.pinx & pinMask));
+}
+
+// -----------------------------------------------------------------------------
+void dispatchPinChange(const uint8_t portIndex, const Hardware& hw) noexcept
+{
+    // Compute the changed pins once, ignore pins whose interrupt is disabled.
+    const uint8_t pins{hw.pinx};
+    const uint8_t changed{static_cast<uint8_t>((pins ^ myPinSnapshots[portIndex]) & hw.pcmskx)};
+    myPinSnapshots[portIndex] = pins;
+    if (0U == changed) { return; }
+
+    // Only notify the subscribers of the changed pins.
+    for (auto& subscriber : mySubscribers[portIndex])
+    {
+        if (0U != (changed & subscriber.pinMask)) { subscriber.callback(); }
+    }
+}
 } // namespace
 } // namespace gpio
 } // namespace driver
@@ -0,0 +1,458 @@
+/**
+ * @brief Implementation details of the hardware PWM driver for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/pwm/atmega328p.h"
+#include "driver/timer/circuit.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace pwm
+{
+/**
+ * @brief PWM hardware structure, i.e. an output compare unit and its pin.
+ */
+struct Hardware
+{
+    /** The pin number of the output. */
+    const uint8_t pin;
+
+    /** The timer circuit of the output compare unit. */
+    const timer::Circuit circuit;
+
+    /** Indicate whether the output is output B of the timer (output A otherwise). */
+    const bool isOutputB;
+
+    /** Reference to the data direction register (DDRx) of the pin. */
+    volatile uint8_t& ddrx;
+
+    /** Reference to the port register (PORTx) of the pin. */
+    volatile uint8_t& portx;
+
+    /** The physical pin. */
+    const uint8_t pinBit;
+
+    /** The compare output mode bit (COMnx1) in control register A of the timer. */
+    const uint8_t comBit;
+};
+
+namespace
+{
+/**
+ * @brief Structure holding the state of a timer circuit used for PWM.
+ */
+struct TimerState
+{
+    /** The number of outputs using the timer. */
+    uint8_t outputCount;
+
+    /** The PWM mode of the timer. */
+    Atmega328p::Mode mode;
+
+    /** The prescaler of the timer. */
+    uint16_t prescaler;
+
+    /** The clock select bits of the timer. */
+    uint8_t clockBits;
+
+    /** The top value of the timer, i.e. the value at which a PWM period ends. */
+    uint16_t top;
+};
+
+/**
+ * @brief Structure of a prescaler and its clock select bits.
+ */
+struct Prescaler
+{
+    /** The prescaler. */
+    uint16_t value;
+
+    /** The clock select bits. */
+    uint8_t clockBits;
+};
+
+/** The number of available PWM channels. */
+constexpr uint8_t ChannelCount{6U};
+
+/** The number of timer circuits. */
+constexpr uint8_t CircuitCount{static_cast<uint8_t>(timer::Circuit::Count)};
+
+/** Top value of the 8-bit timers. */
+constexpr uint16_t Top8Bit{255U};
+
+/** Minimum top value of Timer 1, which keeps 8-bit resolution. */
+constexpr uint16_t MinTop16Bit{255U};
+
+/** Maximum top value of Timer 1. */
+constexpr uint32_t MaxTop16Bit{65535U};
+
+/** Prescalers of Timer 0 and Timer 1. */
+constexpr Prescaler Prescalers[]{{1U, 1U}, {8U, 2U}, {64U, 3U}, {256U, 4U}, {1024U, 5U}};
+
+/** Prescalers of Timer 2. */
+constexpr Prescaler PrescalersTimer2[]{
+    {1U, 1U}, {8U, 2U}, {32U, 3U}, {64U, 4U}, {128U, 5U}, {256U, 6U}, {1024U, 7U}};
+
+/** Hardware structures of the PWM channels, i.e. the output compare units and their pins. */
+const Hardware myHardware[ChannelCount]
+{
+    {6U,  timer::Circuit::Timer0, false, DDRD, PORTD, 6U, COM0A1},
+    {5U,  timer::Circuit::Timer0, true,  DDRD, PORTD, 5U, COM0B1},
+    {9U,  timer::Circuit::Timer1, false, DDRB, PORTB, 1U, COM1A1},
+    {10U, timer::Circuit::Timer1, true,  DDRB, PORTB, 2U, COM1B1},
+    {11U, timer::Circuit::Timer2, false, DDRB, PORTB, 3U, COM2A1},
+    {3U,  timer::Circuit::Timer2, true,  DDRD, PORTD, 3U, COM2B1},
+};
+
+/** State of the timer circuits used for PWM. */
+TimerState myTimers[CircuitCount]{};
+
+/** Channel registry (1 = reserved, 0 = free). */
+uint8_t myChannelRegistry{};
+
+// -----------------------------------------------------------------------------
+constexpr bool isModeValid(const Atmega328p::Mode mode) noexcept
+{
+    return Atmega328p::Mode::Count > mode;
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t timerIndex(const Hardware& channel) noexcept
+{
+    return static_cast<uint8_t>(channel.circuit);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t channelIndex(const Hardware& channel) noexcept
+{
+    return 2U * timerIndex(channel) + (channel.isOutputB ? 1U : 0U);
+}
+
+// -----------------------------------------------------------------------------
+const Hardware* findHw(const uint8_t pin) noexcept
+{
+    for (const auto& channel : myHardware)
+    {
+        if (pin == channel.pin) { return &channel; }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+volatile uint8_t& controlRegA(const timer::Circuit circuit) noexcept
+{
+    switch (circuit)
+    {
+        case timer::Circuit::Timer0:
+            return TCCR0A;
+        case timer::Circuit::Timer1:
+            return TCCR1A;
+        default:
+            return TCCR2A;
+    }
+}
+
+// -----------------------------------------------------------------------------
+volatile uint8_t& controlRegB(const timer::Circuit circuit) noexcept
+{
+    switch (circuit)
+    {
+        case timer::Circuit::Timer0:
+            return TCCR0B;
+        case timer::Circuit::Timer1:
+            return TCCR1B;
+        default:
+            return TCCR2B;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint16_t readCompare(const Hardware& channel) noexcept
+{
+    switch (channel.circuit)
+    {
+        case timer::Circuit::Timer0:
+            return channel.isOutputB ? OCR0B : OCR0A;
+        case timer::Circuit::Timer1:
+            return channel.isOutputB ? OCR1B : OCR1A;
+        default:
+            return channel.isOutputB ? OCR2B : OCR2A;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void writeCompare(const Hardware& channel, const uint16_t value) noexcept
+{
+    switch (channel.circuit)
+    {
+        case timer::Circuit::Timer0:
+            if (channel.isOutputB) { OCR0B = static_cast<uint8_t>(value); }
+            else { OCR0A = static_cast<uint8_t>(value); }
+            break;
+        case timer::Circuit::Timer1:
+        {
+            // The 16-bit registers are written via a temporary register shared with interrupts.
+            utils::InterruptGuard guard{};
+            if (channel.isOutputB) { OCR1B = value; }
+            else { OCR1A = value; }
+            break;
+        }
+        default:
+            if (channel.isOutputB) { OCR2B = static_cast<uint8_t>(value); }
+            else { OCR2A = static_cast<uint8_t>(value); }
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint16_t compareValue(const uint8_t dutyCycle, const uint16_t top) noexcept
+{
+    return static_cast<uint16_t>(static_cast<uint32_t>(dutyCycle) * top / Top8Bit);
+}
+
+// -----------------------------------------------------------------------------
+uint32_t periodTicks(const Atmega328p::Mode mode, const uint16_t top) noexcept
+{
+    // Fast PWM counts from 0 to top, phase correct PWM counts up to top and back down.
+    return Atmega328p::Mode::Fast == mode ? static_cast<uint32_t>(top) + 1U : 2UL * top;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t distance(const uint32_t x, const uint32_t y) noexcept { return x > y ? x - y : y - x; }
+
+// -----------------------------------------------------------------------------
+bool calcTimerSettings(const timer::Circuit circuit, const Atmega328p::Mode mode, 
+                       const uint32_t frequency_hz, TimerState& state) noexcept
+{
+    if (0U == frequency_hz) { return false; }
+
+    // Timer 1: use the smallest prescaler for which the top value fits, for best resolution.
+    if (timer::Circuit::Timer1 == circuit)
+    {
+        for (const auto& prescaler : Prescalers)
+        {
+            const uint32_t ticks{utils::round<uint32_t>(static_cast<double>(F_CPU) / 
+                (static_cast<uint32_t>(prescaler.value) * frequency_hz))};
+            if (0U == ticks) { return false; }
+            const uint32_t top{Atmega328p::Mode::Fast == mode ? ticks - 1U : ticks / 2U};
+
+            if (MinTop16Bit > top) { return false; }
+            if (MaxTop16Bit < top) { continue; }
+            state.prescaler = prescaler.value;
+            state.clockBits = prescaler.clockBits;
+            state.top       = static_cast<uint16_t>(top);
+            return true;
+        }
+        return false;
+    }
+
+    // Timer 0 and Timer 2: use the prescaler yielding the nearest frequency.
+    const Prescaler* first{timer::Circuit::Timer2 == circuit ? PrescalersTimer2 : Prescalers};
+    const uint8_t count{timer::Circuit::Timer2 == circuit ? 
+        static_cast<uint8_t>(sizeof(PrescalersTimer2) / sizeof(Prescaler)) : 
+        static_cast<uint8_t>(sizeof(Prescalers) / sizeof(Prescaler))};
+    const Prescaler* best{first};
+    uint32_t bestDistance{static_cast<uint32_t>(-1)};
+
+    for (const Prescaler* prescaler{first}; prescaler < first + count; ++prescaler)
+    {
+        const uint32_t actual{static_cast<uint32_t>(
+            F_CPU / (static_cast<uint32_t>(prescaler->value) * periodTicks(mode, Top8Bit)))};
+        if (distance(actual, frequency_hz) < bestDistance)
+        {
+            best         = prescaler;
+            bestDistance = distance(actual, frequency_hz);
+        }
+    }
+    state.prescaler = best->value;
+    state.clockBits = best->clockBits;
+    state.top       = Top8Bit;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void configureTimer(const timer::Circuit circuit, const TimerState& state) noexcept
+{
+    volatile uint8_t& tccrxa{controlRegA(circuit)};
+    volatile uint8_t& tccrxb{controlRegB(circuit)};
+    const bool fast{Atmega328p::Mode::Fast == state.mode};
+
+    // Keep the compare output mode bits of control register A, set the waveform generation mode.
+    constexpr uint8_t comMask{(1U << COM0A1) | (1U << COM0B1)};
+    uint8_t controlA{static_cast<uint8_t>(tccrxa & comMask)};
+    uint8_t controlB{state.clockBits};
+
+    switch (circuit)
+    {
+        case timer::Circuit::Timer0:
+            controlA |= fast ? (1U << WGM01) | (1U << WGM00) : (1U << WGM00);
+            break;
+        case timer::Circuit::Timer1:
+        {
+            // Use ICR1 as top: mode 14 (fast PWM) or mode 10 (phase correct PWM).
+            controlA |= (1U << WGM11);
+            controlB |= fast ? (1U << WGM13) | (1U << WGM12) : (1U << WGM13);
+            utils::InterruptGuard guard{};
+            ICR1 = state.top;
+            break;
+        }
+        default:
+            controlA |= fast ? (1U << WGM21) | (1U << WGM20) : (1U << WGM20);
+            break;
+    }
+    tccrxa = controlA;
+    tccrxb = controlB;
+}
+
+// -----------------------------------------------------------------------------
+void resetTimer(const timer::Circuit circuit) noexcept
+{
+    controlRegA(circuit) = 0U;
+    controlRegB(circuit) = 0U;
+
+    if (timer::Circuit::Timer1 == circuit) 
+    { 
+        utils::InterruptGuard guard{};
+        ICR1 = 0U; 
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p(const uint8_t pin, const uint32_t frequency_hz, const Mode mode) noexcept
+    : myHw{findHw(pin)}
+    , myMode{mode}
+    , myDutyCycle{0U}
+    , myEnabled{false}
+{
+    // Reserve the hardware if the pin supports PWM and the mode is valid.
+    if ((nullptr == myHw) || !isModeValid(mode) || !initHw(frequency_hz)) 
+    { 
+        myHw = nullptr; 
+    }
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::~Atmega328p() noexcept
+{
+    if (!isInitialized()) { return; }
+    const uint8_t timer{timerIndex(*myHw)};
+
+    // Disconnect the pin from the timer and reset it.
+    utils::clear(controlRegA(myHw->circuit), myHw->comBit);
+    writeCompare(*myHw, 0U);
+    utils::clear(myHw->ddrx, myHw->pinBit);
+    utils::clear(myHw->portx, myHw->pinBit);
+    utils::clear(myChannelRegistry, channelIndex(*myHw));
+
+    // Release the timer circuit once its last output is deleted.
+    if (0U == --myTimers[timer].outputCount)
+    {
+        resetTimer(myHw->circuit);
+        timer::releaseCircuit(myHw->circuit);
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return nullptr != myHw; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setEnabled(const bool enable) noexcept
+{
+    if (!isInitialized()) { return; }
+    myEnabled = enable;
+    updateOutput();
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Atmega328p::dutyCycle() const noexcept { return myDutyCycle; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setDutyCycle(const uint8_t dutyCycle) noexcept
+{
+    if (!isInitialized()) { return; }
+    myDutyCycle = dutyCycle;
+    updateOutput();
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::frequency_hz() const noexcept
+{
+    if (!isInitialized()) { return 0U; }
+    const TimerState& state{myTimers[timerIndex(*myHw)]};
+    return utils::round<uint32_t>(static_cast<double>(F_CPU) / 
+        (static_cast<uint32_t>(state.prescaler) * periodTicks(myMode, state.top)));
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setFrequency_hz(const uint32_t frequency_hz) noexcept
+{
+    if (!isInitialized()) { return false; }
+    TimerState& state{myTimers[timerIndex(*myHw)]};
+    const uint16_t previousTop{state.top};
+    if (!calcTimerSettings(myHw->circuit, myMode, frequency_hz, state)) { return false; }
+
+    // Rescale the compare values of both outputs of the timer to the new top value.
+    if (previousTop != state.top)
+    {
+        const Hardware& other{myHardware[channelIndex(*myHw) ^ 1U]};
+        writeCompare(other, static_cast<uint16_t>(
+            static_cast<uint32_t>(readCompare(other)) * state.top / previousTop));
+        writeCompare(*myHw, compareValue(myDutyCycle, state.top));
+    }
+    configureTimer(myHw->circuit, state);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Mode Atmega328p::mode() const noexcept { return myMode; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::initHw(const uint32_t frequency_hz) noexcept
+{
+    const uint8_t channel{channelIndex(*myHw)};
+    TimerState& state{myTimers[timerIndex(*myHw)]};
+
+    // Check that the channel is free and the timer is either unused or used in the same mode.
+    if (utils::read(myChannelRegistry, channel)) { return false; }
+
+    if (0U == state.outputCount)
+    {
+        TimerState newState{0U, myMode, 0U, 0U, 0U};
+        if (!calcTimerSettings(myHw->circuit, myMode, frequency_hz, newState) ||
+            !timer::reserveCircuit(myHw->circuit)) { return false; }
+        state = newState;
+        configureTimer(myHw->circuit, state);
+    }
+    else if ((state.mode != myMode) || !setFrequency_hz(frequency_hz)) { return false; }
+
+    // Reserve the channel and set the pin to a low output, connected once enabled.
+    utils::set(myChannelRegistry, channel);
+    state.outputCount++;
+    utils::clear(myHw->portx, myHw->pinBit);
+    utils::set(myHw->ddrx, myHw->pinBit);
+    writeCompare(*myHw, 0U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::updateOutput() noexcept
+{
+    volatile uint8_t& tccrxa{controlRegA(myHw->circuit)};
+
+    // Disconnect the pin, held low, if disabled. Fast PWM can't output a duty cycle of 0, since
+    // the pin is set at the start of each period, hence the pin is disconnected in that case too.
+    if (!myEnabled || ((Mode::Fast == myMode) && (0U == myDutyCycle)))
+    {
+        utils::clear(tccrxa, myHw->comBit);
+        return;
+    }
+    writeCompare(*myHw, compareValue(myDutyCycle, myTimers[timerIndex(*myHw)].top));
+    utils::set(tccrxa, myHw->comBit);
+}
+} // namespace pwm
+} // namespace driver
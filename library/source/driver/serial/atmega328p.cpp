@@ -14,6 +14,10 @@ namespace
 /** Baud rate in bps. */
 constexpr uint32_t BaudRate_bps{9600U};
 
+/** Baud rate register value, calculated at compile time (103 for 9600 bps at 16 MHz). */
+constexpr uint16_t BaudRateValue{utils::round<uint16_t>(F_CPU / (16.0 * BaudRate_bps) - 1.0)};
+static_assert(utils::inRange<uint16_t>(BaudRateValue, 0U, 4095U), "Baud rate not supported!");
+
 /** New line character. */
 constexpr char NewLine{'\n'};
 
@@ -98,9 +102,6 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
 Atmega328p::Atmega328p() noexcept 
     : myEnabled{true}
 { 
-    // Baud rate value corresponding to 9600 kbps.
-    constexpr uint16_t baudRateValue{103U};
-
     // Enable UART transmission.
     utils::set(UCSR0B, TXEN0, RXEN0);
 
@@ -108,7 +109,7 @@ Atmega328p::Atmega328p() noexcept
     utils::set(UCSR0C, UCSZ00, UCSZ01);
 
     // Set the baud rate to 9600 kbps.
-    UBRR0 = baudRateValue;
+    UBRR0 = BaudRateValue;
 
     // Send carriage return to align the first message left.
     UDR0 = CarriageReturn;
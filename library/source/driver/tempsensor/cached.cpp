@@ -0,0 +1,96 @@
+/**
+ * @brief Caching temperature sensor decorator implementation details.
+ */
+#include <stdint.h>
+
+#include "driver/tempsensor/cached.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+// -----------------------------------------------------------------------------
+Cached::Cached(Interface& sensor, const uint32_t maxAge, const Clock clock) noexcept
+    : mySensor{sensor}
+    , myClock{clock}
+    , myMaxAge{maxAge}
+    , myTimestamp{}
+    , myHitCount{}
+    , myMissCount{}
+    , myTemperature{}
+    , myHasReading{false}
+    , myInvalidated{false}
+{}
+
+// -----------------------------------------------------------------------------
+bool Cached::isInitialized() const noexcept
+{
+    // Return true if the sensor is initialized and a clock is present.
+    return mySensor.isInitialized() && (nullptr != myClock);
+}
+
+// -----------------------------------------------------------------------------
+int16_t Cached::read() const noexcept
+{
+    // Return 0 if initialization failed.
+    if (!isInitialized()) { return 0; }
+
+    // Take the first reading from the sensor, since there's nothing to return otherwise.
+    if (!myHasReading)
+    {
+        myMissCount++;
+        return refresh();
+    }
+
+    // Return the cached temperature, an expired one is refreshed by the next update.
+    if (isValid()) { myHitCount++; }
+    else { myMissCount++; }
+    return myTemperature;
+}
+
+// -----------------------------------------------------------------------------
+bool Cached::update() noexcept
+{
+    // Only refresh the cache if it has expired.
+    if (!isInitialized() || isValid()) { return false; }
+    refresh();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Cached::isValid() const noexcept
+{
+    // The cache is valid as long as the reading is younger than the max age, the unsigned
+    // subtraction handles wrap-around of the clock.
+    return myHasReading && !myInvalidated && (nullptr != myClock) 
+        && (static_cast<uint32_t>(myClock() - myTimestamp) < myMaxAge);
+}
+
+// -----------------------------------------------------------------------------
+void Cached::invalidate() noexcept { myInvalidated = true; }
+
+// -----------------------------------------------------------------------------
+uint32_t Cached::hitCount() const noexcept { return myHitCount; }
+
+// -----------------------------------------------------------------------------
+uint32_t Cached::missCount() const noexcept { return myMissCount; }
+
+// -----------------------------------------------------------------------------
+void Cached::resetCounters() noexcept
+{
+    myHitCount  = 0U;
+    myMissCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Cached::refresh() const noexcept
+{
+    // Read the sensor and timestamp the reading.
+    myTemperature = mySensor.read();
+    myTimestamp   = myClock();
+    myHasReading  = true;
+    myInvalidated = false;
+    return myTemperature;
+}
+} // namespace tempsensor
+} // namespace driver
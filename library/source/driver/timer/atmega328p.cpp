@@ -4,6 +4,8 @@
 #include "arch/avr/hw_platform.h"
 #include "container/array.h"
 #include "driver/timer/atmega328p.h" 
+#include "driver/timer/circuit.h"
+#include "profiler/isr.h"
 #include "utils/callback_array.h"
 #include "utils/utils.h"
 
@@ -57,14 +59,14 @@ struct Index
 /** The number of available timer circuits. */
 constexpr uint8_t CircuitCount{3U};
 
+/** The prescaler of the timer circuits, i.e. the number of CPU cycles per counter tick. */
+constexpr uint16_t Prescaler{8U};
+
 /** Time between each timer interrupt in ms. */
 constexpr double InterruptIntervalMs{0.128};
 
-/** Array holding pointers to timers. */
-Atmega328p* myTimers[CircuitCount]{};  
-
-/** Array holding pointers to callbacks. */
-CallbackArray<CircuitCount> myCallbacks{};
+/** Interrupt handlers of the reserved timer circuits, bound to Atmega328p::handleCallback(). */
+CallbackArray<CircuitCount> myHandlers{};
 
 // -----------------------------------------------------------------------------
 constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
@@ -72,32 +74,25 @@ constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
 	return 0U < timeout_ms ? 
         utils::round<uint32_t>(timeout_ms / InterruptIntervalMs) : 0U;
 }
-
-// -----------------------------------------------------------------------------
-void invokeCallback(const uint8_t timerIndex) noexcept
-{
-	// Check the timer index, terminate the function if invalid.
-	if (CircuitCount <= timerIndex) { return; }
-    
-	// Invoke callback.
-	Atmega328p* timer{myTimers[timerIndex]};
-    if (nullptr != timer) { timer->handleCallback(); }
-}
 } // namespace
 
 // -----------------------------------------------------------------------------
-Atmega328p::Atmega328p(const uint32_t timeout_ms, void (*callback)(), 
+Atmega328p::Atmega328p(const uint32_t timeout_ms, const utils::Delegate<void()>& callback, 
                        const bool startTimer) noexcept
 	// Is the timeout greater than 0?
 	// If so, try to reserve a timer circuit, else set the timer to uninitialized.
     : myHw{(0U < timeout_ms) ? Hardware::reserve() : nullptr}
 	, myMaxCount{maxCount(timeout_ms)}
+	, myCallback{callback}
+	, myInterruptHandler{}
 	, myEnabled{false}
 
 {
     if (nullptr == myHw) { return; }
-	myTimers[myHw->index] = this;
-	addCallback(callback);
+
+	// Dispatch the interrupts of the reserved circuit directly to this timer.
+	myHandlers.add(utils::Delegate<void()>::bind<&Atmega328p::handleCallback>(*this), 
+	               myHw->index);
 	if (startTimer) { start(); }
 }
 
@@ -106,8 +101,7 @@ Atmega328p::~Atmega328p() noexcept
 { 
 	// Skip cleanup if there is nothing to cleanup, i.e. myHw is null.
 	if (!isInitialized()) { return; }
-	removeCallback();
-	myTimers[myHw->index] = nullptr;
+	myHandlers.remove(myHw->index);
 	Hardware::release(myHw); 
 }
 
@@ -166,28 +160,36 @@ void Atmega328p::restart() noexcept
     start();
 }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::setCallback(const utils::Delegate<void()>& callback) noexcept
+{
+	// The callback is read by the timer interrupt, hence it must be replaced atomically.
+	utils::InterruptGuard guard{};
+	myCallback = callback;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::setInterruptHandler(const utils::Delegate<void()>& handler) noexcept
+{
+	// The handler is read by the timer interrupt, hence it must be replaced atomically.
+	utils::InterruptGuard guard{};
+	myInterruptHandler = handler;
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::handleCallback() noexcept
 {
-	// Increment the timer, invoke callback on timeout.
-	increment();
+	// Increment the timer, invoke the interrupt handler and the callback on timeout.
+	if (!increment()) { return; }
+	if (myInterruptHandler) { myInterruptHandler(); }
 
 	if (hasTimedOut()) 
 	{ 
-		myCallbacks.invoke(myHw->index); 
+		if (myCallback) { myCallback(); }
 		clearTimedOut();
 	}
 }
 
-// -----------------------------------------------------------------------------
-void Atmega328p::addCallback(void (*callback)()) const noexcept
-{ 
-    myCallbacks.add(callback, myHw->index);
-}
-
-// -----------------------------------------------------------------------------
-void Atmega328p::removeCallback() const noexcept { myCallbacks.remove(myHw->index); }
-
 // -----------------------------------------------------------------------------
 bool Atmega328p::increment() noexcept
 {
@@ -203,9 +205,15 @@ void Atmega328p::clearTimedOut() noexcept { myHw->counter = 0U; }
 Atmega328p::Hardware* Atmega328p::Hardware::reserve() noexcept
 {
 	// Reserve a timer circuit if any is available, otherwise return a nullptr.
+	// Circuits may also be reserved by other drivers, such as the PWM driver.
     for (uint8_t i{}; i < CircuitCount; ++i)
 	{
-        if (nullptr == myTimers[i]) { return init(i); }
+        if (reserveCircuit(static_cast<Circuit>(i))) 
+		{ 
+			Hardware* hw{init(i)};
+			if (nullptr == hw) { releaseCircuit(static_cast<Circuit>(i)); }
+			return hw;
+		}
 	}
 	return nullptr;
 }
@@ -232,6 +240,7 @@ void Atmega328p::Hardware::release(Atmega328p::Hardware* hw) noexcept
 		    break;
 	}
 	// Release allocated resources.
+	releaseCircuit(static_cast<Circuit>(hw->index));
 	utils::deleteMemory(hw);
 }
 
@@ -277,13 +286,28 @@ Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexc
 }
 
 // -----------------------------------------------------------------------------
-ISR (TIMER0_OVF_vect) { invokeCallback(Index::Timer0); }
+ISR (TIMER0_OVF_vect) 
+{ 
+	// The counter restarted from 0 on overflow, hence its value is the latency.
+	ISR_PROFILE_LATENCY(profiler::isr::Vector::Timer0, TCNT0 * Prescaler);
+	myHandlers.invoke(Index::Timer0); 
+}
 
 // -----------------------------------------------------------------------------
-ISR (TIMER1_COMPA_vect) { invokeCallback(Index::Timer1); }
+ISR (TIMER1_COMPA_vect) 
+{ 
+	// The counter restarted from 0 on compare match, hence its value is the latency.
+	ISR_PROFILE_LATENCY(profiler::isr::Vector::Timer1, TCNT1 * Prescaler);
+	myHandlers.invoke(Index::Timer1); 
+}
 
 // -----------------------------------------------------------------------------
-ISR (TIMER2_OVF_vect) { invokeCallback(Index::Timer2); }
+ISR (TIMER2_OVF_vect) 
+{ 
+	// The counter restarted from 0 on overflow, hence its value is the latency.
+	ISR_PROFILE_LATENCY(profiler::isr::Vector::Timer2, TCNT2 * Prescaler);
+	myHandlers.invoke(Index::Timer2); 
+}
 
 } // namespace timer
 } // namespace driver
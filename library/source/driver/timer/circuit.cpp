@@ -0,0 +1,51 @@
+/**
+ * @brief Implementation details of the timer circuit arbitration.
+ */
+#include "driver/timer/circuit.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace timer
+{
+namespace
+{
+/** Circuit registry (1 = reserved, 0 = free). */
+uint8_t myCircuitRegistry{};
+
+// -----------------------------------------------------------------------------
+constexpr bool isCircuitValid(const Circuit circuit) noexcept 
+{ 
+    return Circuit::Count > circuit; 
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool reserveCircuit(const Circuit circuit) noexcept
+{
+    if (!isCircuitValid(circuit)) { return false; }
+    const uint8_t bit{static_cast<uint8_t>(circuit)};
+
+    // Check and reserve the circuit atomically, since circuits may be reserved in interrupts.
+    utils::InterruptGuard guard{};
+    if (utils::read(myCircuitRegistry, bit)) { return false; }
+    utils::set(myCircuitRegistry, bit);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void releaseCircuit(const Circuit circuit) noexcept
+{
+    if (!isCircuitValid(circuit)) { return; }
+    utils::InterruptGuard guard{};
+    utils::clear(myCircuitRegistry, static_cast<uint8_t>(circuit));
+}
+
+// -----------------------------------------------------------------------------
+bool isCircuitReserved(const Circuit circuit) noexcept
+{
+    return isCircuitValid(circuit) && 
+        utils::read(utils::atomicLoad(myCircuitRegistry), static_cast<uint8_t>(circuit));
+}
+} // namespace timer
+} // namespace driver
@@ -37,7 +37,7 @@ constexpr bool isTimeoutValid(const Atmega328p::Timeout timeout) noexcept
 }
     
 // -----------------------------------------------------------------------------
-uint8_t mapTimeout(const Atmega328p::Timeout timeout) noexcept
+constexpr uint8_t mapTimeout(const Atmega328p::Timeout timeout) noexcept
 {
     // Map timeout to WDTCSR register value.
     switch (timeout)
@@ -66,6 +66,12 @@ uint8_t mapTimeout(const Atmega328p::Timeout timeout) noexcept
             return 0xFFU;
     }
 }
+
+// Verify the register map at compile time, the prescaler bits WDP3:0 form a binary index.
+static_assert(0U == mapTimeout(Atmega328p::Timeout::Duration16ms), "Invalid register map!");
+static_assert((1U << WDP3) == mapTimeout(Atmega328p::Timeout::Duration4096ms), 
+              "Invalid register map!");
+static_assert(0xFFU == mapTimeout(static_cast<Atmega328p::Timeout>(100U)), "Invalid register map!");
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -3,17 +3,61 @@
  */
 #include <stdint.h>
 
+#include "container/flat_map.h"
 #include "driver/adc/interface.h"
 #include "driver/eeprom/interface.h"
+#include "driver/gpio/debouncer.h"
 #include "driver/gpio/interface.h"
 #include "driver/serial/interface.h"
 #include "driver/tempsensor/interface.h"
 #include "driver/timer/interface.h"
 #include "driver/watchdog/interface.h"
 #include "logic/logic.h"
+#include "memory/diagnostics.h"
+#include "profiler/handler.h"
+#include "profiler/isr.h"
 
 namespace logic
 {
+namespace
+{
+/** The number of profiled handlers. */
+constexpr uint8_t HandlerCount{static_cast<uint8_t>(Logic::Handler::Count)};
+
+/** 
+ * @brief Execution time profiles of the handlers, indexed by Logic::Handler.
+ * 
+ *        On the target, the budgets are given in CPU cycles at 16 MHz and dominated by 
+ *        blocking serial output, which takes ~16700 cycles per character at 9600 bps. The 
+ *        serial port handler includes the 100 ms read timeout and the printouts of the 
+ *        received command.
+ *
+ *        In the host model, serial output costs nothing: the handlers take < 250 cycles, the
+ *        serial port handler < 2000 cycles, measured as CPU time of the host. The budgets
+ *        leave a margin above that, so that a blocking wait in a handler or a driver is 
+ *        caught by the tests.
+ */
+#ifdef TESTSUITE
+profiler::handler::Profile myHandlerProfiles[HandlerCount]{
+    profiler::handler::Profile{"handleButtonEvent", 1600UL},
+    profiler::handler::Profile{"handleTempTimerTimeout", 1600UL},
+    profiler::handler::Profile{"readSerialPort", 16000UL},
+};
+#else
+profiler::handler::Profile myHandlerProfiles[HandlerCount]{
+    profiler::handler::Profile{"handleButtonEvent", 800000UL},
+    profiler::handler::Profile{"handleTempTimerTimeout", 800000UL},
+    profiler::handler::Profile{"readSerialPort", 8000000UL},
+};
+#endif
+
+// -----------------------------------------------------------------------------
+profiler::handler::Profile& profile(const Logic::Handler handler) noexcept
+{
+    return myHandlerProfiles[static_cast<uint8_t>(handler)];
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 Logic::Logic(driver::gpio::Interface& led,
              driver::gpio::Interface& toggleButton,
@@ -25,6 +69,35 @@ Logic::Logic(driver::gpio::Interface& led,
              driver::watchdog::Interface& watchdog, 
              driver::eeprom::Interface& eeprom, 
              driver::tempsensor::Interface& tempSensor) noexcept
+    : Logic{led, toggleButton, tempButton, &debounceTimer, toggleTimer, tempTimer, serial, 
+            watchdog, eeprom, tempSensor}
+{}
+
+// -----------------------------------------------------------------------------
+Logic::Logic(driver::gpio::Interface& led,
+             driver::gpio::Interface& toggleButton,
+             driver::gpio::Interface& tempButton, 
+             driver::timer::Interface& toggleTimer,
+             driver::timer::Interface& tempTimer,
+             driver::serial::Interface& serial, 
+             driver::watchdog::Interface& watchdog, 
+             driver::eeprom::Interface& eeprom, 
+             driver::tempsensor::Interface& tempSensor) noexcept
+    : Logic{led, toggleButton, tempButton, nullptr, toggleTimer, tempTimer, serial, 
+            watchdog, eeprom, tempSensor}
+{}
+
+// -----------------------------------------------------------------------------
+Logic::Logic(driver::gpio::Interface& led,
+             driver::gpio::Interface& toggleButton,
+             driver::gpio::Interface& tempButton, 
+             driver::timer::Interface* debounceTimer, 
+             driver::timer::Interface& toggleTimer,
+             driver::timer::Interface& tempTimer,
+             driver::serial::Interface& serial, 
+             driver::watchdog::Interface& watchdog, 
+             driver::eeprom::Interface& eeprom, 
+             driver::tempsensor::Interface& tempSensor) noexcept
     : myLed{led}
     , myToggleButton{toggleButton}
     , myTempButton{tempButton}
@@ -39,8 +112,12 @@ Logic::Logic(driver::gpio::Interface& led,
     // Enable system if all hardware drivers were initialized correctly.
     if (isInitialized())
     {
-        myToggleButton.enableInterrupt(true);
-        myTempButton.enableInterrupt(true);
+        // Sampled buttons are debounced without pin change interrupts.
+        if (nullptr != myDebounceTimer)
+        {
+            myToggleButton.enableInterrupt(true);
+            myTempButton.enableInterrupt(true);
+        }
         myTempTimer.start();
         mySerial.setEnabled(true);
         myWatchdog.setEnabled(true);
@@ -58,7 +135,7 @@ Logic::~Logic() noexcept
     myLed.write(false);
     myToggleButton.enableInterrupt(false);
     myTempButton.enableInterrupt(false);
-    myDebounceTimer.stop();
+    if (nullptr != myDebounceTimer) { myDebounceTimer->stop(); }
     myToggleTimer.stop();
     myTempTimer.stop();
     mySerial.setEnabled(false);
@@ -72,7 +149,8 @@ bool Logic::isInitialized() const noexcept
 {
     // Return true if all hardware drivers are initialized.
     return myLed.isInitialized() && myToggleButton.isInitialized() && myTempButton.isInitialized()
-        && myDebounceTimer.isInitialized() && myToggleTimer.isInitialized() 
+        && ((nullptr == myDebounceTimer) || myDebounceTimer->isInitialized()) 
+        && myToggleTimer.isInitialized() 
         && myTempTimer.isInitialized() && mySerial.isInitialized() && myWatchdog.isInitialized()
         && myEeprom.isInitialized() && myTempSensor.isInitialized();
 }
@@ -102,6 +180,9 @@ void Logic::run(const bool& stop) noexcept
     mySerial.printf("'t' - toggle the toggle timer\n");
     mySerial.printf("'r' - read the temperature\n");
     mySerial.printf("'s' - to check the state of the toggle timer\n");
+    mySerial.printf("'m' - print the memory usage\n");
+    mySerial.printf("'i' - print the interrupt profile\n");
+    mySerial.printf("'b' - print the handler cycle budgets\n");
 
     while (!stop) 
     { 
@@ -110,19 +191,24 @@ void Logic::run(const bool& stop) noexcept
         
         // read serial port, execute received commands
         readSerialPort();
+
+        // Refresh the temperature outside the event handlers, if the sensor caches it.
+        myTempSensor.update();
     }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleButtonEvent() noexcept
 {
-    // Ignore if this call was done manually.
-    if (myDebounceTimer.isEnabled()) { return; }
+    HANDLER_PROFILE(profile(Handler::ButtonEvent));
+
+    // Ignore if this call was done manually or if the buttons are sampled.
+    if ((nullptr == myDebounceTimer) || myDebounceTimer->isEnabled()) { return; }
     
     // Disable interrupts on the I/O ports to mitigate effects of debouncing.
     myToggleButton.enableInterruptOnPort(false);
     myTempButton.enableInterruptOnPort(false);
-    myDebounceTimer.start();
+    myDebounceTimer->start();
 
     // Handle specific button event when pressed.
     if (myToggleButton.read()) { handleToggleButtonPressed(); }
@@ -133,14 +219,43 @@ void Logic::handleButtonEvent() noexcept
 void Logic::handleDebounceTimerTimeout() noexcept
 {
     // Re-enable interrupts on the ports after debounce timer timeout.
-    if (myDebounceTimer.hasTimedOut())
+    if ((nullptr != myDebounceTimer) && myDebounceTimer->hasTimedOut())
     {
-        myDebounceTimer.stop();
+        myDebounceTimer->stop();
         myToggleButton.enableInterruptOnPort(true);
         myTempButton.enableInterruptOnPort(true);
     }
 }
 
+// -----------------------------------------------------------------------------
+void Logic::handleButtonEvent(const uint8_t button, const driver::gpio::ButtonEvent event) noexcept
+{
+    using driver::gpio::ButtonEvent;
+    HANDLER_PROFILE(profile(Handler::ButtonEvent));
+
+    if (ButtonEvent::Pressed == event)
+    {
+        if (ToggleButton == button) { handleToggleButtonPressed(); }
+        else if (TempButton == button) { handleTempButtonPressed(); }
+    }
+    else if ((ButtonEvent::LongPressed == event) && (TempButton == button)) 
+    { 
+        printMemoryUsage(); 
+    }
+}
+
+// -----------------------------------------------------------------------------
+const profiler::handler::Profile* Logic::handlerProfile(const Handler handler) noexcept
+{
+    return Handler::Count > handler ? &profile(handler) : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+void Logic::resetHandlerProfiles() noexcept
+{
+    for (auto& profile : myHandlerProfiles) { profile.reset(); }
+}
+
 // -----------------------------------------------------------------------------
 void Logic::handleToggleTimerTimeout() noexcept 
 {
@@ -152,6 +267,7 @@ void Logic::handleToggleTimerTimeout() noexcept
 void Logic::handleTempTimerTimeout() noexcept 
 { 
     // Read and print the temperature on temperature timer timeout.
+    HANDLER_PROFILE(profile(Handler::TempTimerTimeout));
     if (myTempTimer.hasTimedOut()) { printTemperature(); }
 }
 
@@ -212,9 +328,97 @@ void Logic::restoreToggleStateFromEeprom() noexcept
         mySerial.printf("Toggle timer enabled!\n");
     }
 }
+
+// -----------------------------------------------------------------------------
+void Logic::printToggleTimerState() noexcept
+{
+    const char* state{myToggleTimer.isEnabled() ? "enabled" : "disabled"};
+    mySerial.printf("Toggle timer is %s.\n", state);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printMemoryUsage() noexcept
+{
+    const auto report{memory::diagnostics::report()};
+
+    mySerial.printf("Heap: %u bytes used, %u bytes reserved, %u bytes peak, %u%% fragmented\n",
+                    static_cast<unsigned>(report.heap.usedBytes),
+                    static_cast<unsigned>(report.heap.reservedBytes),
+                    static_cast<unsigned>(report.heap.highWaterMark),
+                    static_cast<unsigned>(report.heap.fragmentation()));
+    mySerial.printf("Heap: %u blocks, %lu allocations, %lu deallocations, %u failed\n",
+                    static_cast<unsigned>(report.heap.blockCount),
+                    static_cast<unsigned long>(report.heap.allocationCount),
+                    static_cast<unsigned long>(report.heap.deallocationCount),
+                    static_cast<unsigned>(report.heap.failedCount));
+    mySerial.printf("Stack: %u bytes used, %u bytes peak, %u bytes headroom\n",
+                    static_cast<unsigned>(report.stack.used),
+                    static_cast<unsigned>(report.stack.peak),
+                    static_cast<unsigned>(report.stack.headroom));
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printIsrProfile() noexcept
+{
+    namespace isr = profiler::isr;
+
+    if (!isr::Enabled)
+    {
+        mySerial.printf("ISR profiling is disabled, define ISR_PROFILING to enable it\n");
+        return;
+    }
+    mySerial.printf("ISR profile (CPU cycles), profiler clock %s:\n", 
+                    profiler::clock::isRunning() ? "running" : "stopped");
+
+    for (uint8_t i{}; i < static_cast<uint8_t>(isr::Vector::Count); ++i)
+    {
+        const auto vector{static_cast<isr::Vector>(i)};
+        const auto stats{isr::stats(vector)};
+        if (0U == stats.count) { continue; }
+
+        mySerial.printf("%s: %lu calls, min %u, mean %u, max %u, max latency %u\n", 
+                        isr::name(vector), static_cast<unsigned long>(stats.count), 
+                        static_cast<unsigned>(stats.min), static_cast<unsigned>(stats.mean()), 
+                        static_cast<unsigned>(stats.max), static_cast<unsigned>(stats.maxLatency));
+
+        for (uint8_t bucket{}; bucket < isr::BucketCount; ++bucket)
+        {
+            if (0U == stats.buckets[bucket]) { continue; }
+            const bool last{(isr::BucketCount - 1U) == bucket};
+            mySerial.printf("  %s %u: %u\n", last ? ">=" : "<", 
+                            static_cast<unsigned>(isr::bucketLimit(last ? bucket - 1U : bucket)),
+                            static_cast<unsigned>(stats.buckets[bucket]));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printHandlerProfiles() noexcept
+{
+    if (!profiler::handler::Enabled)
+    {
+        mySerial.printf("Handler profiling is disabled, define HANDLER_PROFILING to enable it\n");
+        return;
+    }
+    mySerial.printf("Handler profile (CPU cycles), profiler clock %s:\n", 
+                    profiler::clock::isRunning() ? "running" : "stopped");
+
+    for (const auto& profile : myHandlerProfiles)
+    {
+        mySerial.printf("%s: %lu calls, mean %lu, worst %lu, budget %lu%s\n", profile.name(), 
+                        static_cast<unsigned long>(profile.count()), 
+                        static_cast<unsigned long>(profile.mean()),
+                        static_cast<unsigned long>(profile.worst()), 
+                        static_cast<unsigned long>(profile.budget()),
+                        profile.isWithinBudget() ? "" : " EXCEEDED");
+    }
+}
+
 // -----------------------------------------------------------------------------
 bool Logic::readSerialPort() noexcept
 {
+    HANDLER_PROFILE(profile(Handler::SerialPort));
+
     // Buffer size (bytes)
     constexpr uint16_t bufferSize{5U};
 
@@ -245,41 +449,33 @@ bool Logic::readSerialPort() noexcept
         const char cmd{static_cast<char>(buffer[0U])}; 
         
         mySerial.printf("Received command: %c\n", cmd); 
-        
-        // handle received command
-        switch (cmd)
+
+        // Command table generated at compile time, lookups use binary search.
+        // 't' works the same as pressing the toggle button.
+        // 'r' works the same as pressing the temperature button.
+        // 's' prints the state of the toggle timer.
+        // 'm' prints the memory usage.
+        // 'i' prints the interrupt profile.
+        // 'b' prints the handler cycle budgets.
+        using Command = void (Logic::*)() noexcept;
+        static constexpr container::StaticFlatMap<char, Command, 6U> commands{{
+            {'t', &Logic::handleToggleButtonPressed},
+            {'r', &Logic::handleTempButtonPressed},
+            {'s', &Logic::printToggleTimerState},
+            {'m', &Logic::printMemoryUsage},
+            {'i', &Logic::printIsrProfile},
+            {'b', &Logic::printHandlerProfiles},
+        }};
+
+        // handle received command, print error message if an unknown command was received.
+        const Command* command{commands.find(cmd)};
+
+        if (nullptr == command)
         {
-            // if we received 't', toggle button pressed
-            case 't':
-            {
-                // command 't' works the same as prressing the toggle button.
-                handleToggleButtonPressed();
-                break;
-            } 
-
-            case 'r':
-            {
-                // command 'r' works the same as prressing the temperature button.
-                handleTempButtonPressed();
-                break;
-            }
-
-            case 's':
-            {
-                const char* state{myToggleTimer.isEnabled() ? "enabled" : "disabled"};
-                mySerial.printf("Toggle timer is %s.\n", state);
-                break;
-            
-            }
-
-            // print error message if an unknown command was received. 
-            default:
-            {
-                mySerial.printf("Unknown command received: %c\n", cmd);
-                return false;
-            }
-            
+            mySerial.printf("Unknown command received: %c\n", cmd);
+            return false;
         }
+        (this->**command)();
     }
     // Return true to indicate success.
     return true; 
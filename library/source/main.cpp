@@ -6,62 +6,41 @@
  *            - A button to read the surrounding temperature.
  *            - A blink timer to toggle an LED when enabled.
  *            - A temperature timer to print the temperature on timeout.
- *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
+ *            - A sampling debouncer, ticked by the temperature timer, to reduce the effect of
+ *              contact bounces after pushing the buttons.
  *            - A serial device to print serial data via UART.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
- *            - A temperature sensor to read the surrounding temperature.
+ *            - A temperature sensor to read the surrounding temperature, cached and refreshed
+ *              in the main loop so that event handlers never wait for a conversion.
  */
+#include "container/static_vector.h"
 #include "driver/adc/atmega328p.h"
 #include "driver/eeprom/atmega328p.h"
+#include "driver/gpio/debouncer.h"
 #include "driver/gpio/atmega328p.h"
+#include "driver/gpio/pin.h"
 #include "driver/serial/atmega328p.h"
+#include "driver/tempsensor/cached.h"
 #include "driver/tempsensor/smart.h"
 #include "driver/timer/atmega328p.h"
 #include "driver/watchdog/atmega328p.h"
 #include "logic/logic.h"
+#include "memory/allocator.h"
+#include "memory/arena.h"
+#include "memory/diagnostics.h"
 #include "ml/lin_reg/fixed.h"
 #include "ml/types.h"
+#include "profiler/clock.h"
+#include "utils/delegate.h"
 
 using namespace driver;
 
 namespace
 {
-/** Pointer to the logic implementation. */
-logic::Interface* myLogic{nullptr};
-
-namespace callback
-{
-/**
- * @brief Callback for the buttons.
- * 
- *        This callback is invoked when a button event occurs.
- */
-void button() noexcept { myLogic->handleButtonEvent(); }
-
-/**
- * @brief Callback for the debounce timer.
- * 
- *        This callback is invoked when the debounce timer times out.
- */
-void debounceTimer() noexcept { myLogic->handleDebounceTimerTimeout(); }
-
-/**
- * @brief Callback for the toggle timer.
- * 
- *        This callback is invoked when the toggle timer times out.
- */
-void toggleTimer() noexcept { myLogic->handleToggleTimerTimeout(); }
-
-/**
- * @brief Callback for the temperature timer.
- * 
- *        This callback is invoked when the temperature timer times out.
- */
-void tempTimer() noexcept { myLogic->handleTempTimerTimeout(); }
-
-} // namespace callback
+/** Arena holding the objects allocated at startup, i.e. the timer hardware structures. */
+memory::StaticArena<32U> myInitArena{};
 
 /**
  * @brief Train fixed linear regression model to predict temperature based on the input voltage.
@@ -77,15 +56,17 @@ bool trainModel(ml::lin_reg::Fixed& model) noexcept
     constexpr double learningRate{0.01};
 
     // Training data to teach the model to predict T = 100 * Uin - 50.
-    const ml::Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 
-                               0.5, 0.6, 0.7, 0.8, 0.9, 
-                               1.0, 1.1, 1.2, 1.3, 1.4};
-    const ml::Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 
-                                0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 
-                                60.0, 70.0, 80.0, 90.0, 100.0};
+    // The data is generated at compile time, hence no memory is allocated for the training sets.
+    constexpr size_t maxSetCount{16U};
+    static constexpr container::StaticVector<double, maxSetCount> trainIn{
+        0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5};
+    static constexpr container::StaticVector<double, maxSetCount> trainOut{
+        -50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+        30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
+    static_assert(trainIn.size() == trainOut.size(), "Training set size mismatch!");
 
     // Train the model, return the result.
-    return model.train(trainIn, trainOut, epochCount, learningRate);
+    return model.train(trainIn.data(), trainOut.data(), trainIn.size(), epochCount, learningRate);
 }
 } // namespace
 
@@ -96,6 +77,12 @@ bool trainModel(ml::lin_reg::Fixed& model) noexcept
  */
 int main()
 {
+    // Paint the free memory to track the stack usage, see the 'm' command.
+    memory::diagnostics::paintStack();
+
+    // Allocate init-time objects from the static arena rather than the heap.
+    memory::allocator::setArena(&myInitArena);
+
     // Set pin numbers.
     constexpr uint8_t tempSensorPin{2U};
     constexpr uint8_t ledPin{9U};			// ska vara pin 9 fr min P1
@@ -103,22 +90,32 @@ int main()
     constexpr uint8_t tempButtonPin{13U};
 
     // Set timeouts.
-    constexpr uint32_t debounceTimerTimeout{300U};
     constexpr uint32_t toggleTimerTimeout{100U};
     constexpr uint32_t tempTimerTimeout{60000U};
 
+    // Refresh the cached temperature every 5 s, measured in CPU cycles of the profiler clock.
+    constexpr uint32_t tempMaxAge_cycles{5U * F_CPU};
+
+    // Sample the buttons every 40 timer interrupts (~5 ms), i.e. a state change is confirmed
+    // after ~20 ms. Report a long press after holding a button for ~1 s.
+    constexpr uint16_t buttonSamplePeriod_ticks{40U};
+    constexpr uint16_t longPress_samples{195U};
+
     constexpr auto input{gpio::Direction::InputPullup};
     constexpr auto output{gpio::Direction::Output};
 
-    // Initialize the GPIO devices.
-    gpio::Atmega328p led{ledPin, output};
-    gpio::Atmega328p toggleButton{toggleButtonPin, input, callback::button};
-    gpio::Atmega328p tempButton{tempButtonPin, input, callback::button};
+    // Initialize the GPIO devices, the LED is resolved at compile time since it has no callback.
+    gpio::PinAdapter<ledPin, output> led{};
+    gpio::Atmega328p toggleButton{toggleButtonPin, input};
+    gpio::Atmega328p tempButton{tempButtonPin, input};
+
+    // Start the cycle clock first, since it needs timer 1. The clock ages the cached
+    // temperature and times the profilers, if compiled in (see the 'i' and 'b' commands).
+    profiler::clock::start();
 
-    // Initialize the timers.
-    timer::Atmega328p debounceTimer{debounceTimerTimeout, callback::debounceTimer};
-    timer::Atmega328p toggleTimer{toggleTimerTimeout, callback::toggleTimer};
-    timer::Atmega328p tempTimer{tempTimerTimeout, callback::tempTimer};
+    // Initialize the timers, the callbacks are bound to the logic implementation below.
+    timer::Atmega328p toggleTimer{toggleTimerTimeout};
+    timer::Atmega328p tempTimer{tempTimerTimeout};
 
     // Obtain a reference to the singleton serial device instance.
     auto& serial{serial::Atmega328p::getInstance()};
@@ -145,22 +142,38 @@ int main()
 
     // Initialize the smart temperature sensor.
     tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
+    tempsensor::Cached cachedTempSensor{tempSensor, tempMaxAge_cycles};
 
     // Initialize the logic implementation with the given hardware.
     logic::Logic logic{led, 
                        toggleButton, 
                        tempButton, 
-                       debounceTimer, 
                        toggleTimer, 
                        tempTimer,
                        serial, 
                        watchdog, 
                        eeprom, 
-                       tempSensor};
-    myLogic = &logic;
+                       cachedTempSensor};
+
+    // Dispatch the device events directly to the logic implementation.
+    using Callback = utils::Delegate<void()>;
+    toggleTimer.setCallback(Callback::bind<&logic::Logic::handleToggleTimerTimeout>(logic));
+    tempTimer.setCallback(Callback::bind<&logic::Logic::handleTempTimerTimeout>(logic));
+
+    // Debounce the buttons by sampling them on the interrupts of the always running temperature
+    // timer, no timer or pin change interrupt is dedicated to debouncing.
+    using Buttons = gpio::Debouncer<toggleButtonPin, tempButtonPin>;
+    constexpr void (logic::Logic::*handleButtonEvent)(uint8_t, gpio::ButtonEvent) noexcept{
+        &logic::Logic::handleButtonEvent};
+    Buttons buttons{Buttons::Handler::bind<handleButtonEvent>(logic), buttonSamplePeriod_ticks, 
+                    longPress_samples};
+    tempTimer.setInterruptHandler(Callback::bind<&Buttons::tick>(buttons));
+
+    // End the startup phase, subsequent allocations are runtime allocations.
+    memory::allocator::endStartup();
 
     // Run the application on the target MCU.
     const bool stop{false};
-    myLogic->run(stop);
+    logic.run(stop);
     return 0;
 }
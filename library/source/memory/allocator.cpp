@@ -0,0 +1,285 @@
+/**
+ * @brief Allocator layer implementation details.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory/allocator.h"
+#include "memory/arena.h"
+#include "memory/block_pool.h"
+#include "utils/utils.h"
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+/**
+ * @brief Header preceding each block, holding the requested size.
+ *
+ *        The header is aligned like the blocks themselves, so that the user data stays aligned.
+ */
+struct alignas(max_align_t) Header
+{
+    /** The requested size of the block in bytes. */
+    size_t size;
+};
+
+/** The size of the block header in bytes. */
+constexpr size_t HeaderSize{sizeof(Header)};
+
+/** Arena to allocate init-time blocks from. */
+Arena* myArena{nullptr};
+
+/** Block pools to allocate runtime blocks from, sorted by block size. */
+BlockPool* myPools[MaxPoolCount]{};
+
+/** The number of registered block pools. */
+size_t myPoolCount{};
+
+/** Indicate whether the system is still in the startup phase. */
+bool myStartup{true};
+
+/** Indicate whether allocations from the general-purpose heap are forbidden. */
+bool myHeapForbidden{false};
+
+/** Allocation statistics. */
+Stats myStats{};
+
+// -----------------------------------------------------------------------------
+Header* headerOf(void* block) noexcept { return static_cast<Header*>(block) - 1U; }
+
+// -----------------------------------------------------------------------------
+bool heapAllowed() noexcept { return myStartup || !myHeapForbidden; }
+
+// -----------------------------------------------------------------------------
+BlockPool* poolOwning(const void* raw) noexcept
+{
+    for (size_t i{}; i < myPoolCount; ++i)
+    {
+        if (myPools[i]->owns(raw)) { return myPools[i]; }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+size_t reservedSize(const void* raw, const size_t size) noexcept
+{
+    if ((nullptr != myArena) && myArena->owns(raw)) { return Arena::alignedSize(HeaderSize + size); }
+    const auto pool{poolOwning(raw)};
+    return nullptr != pool ? pool->blockSize() : HeaderSize + size;
+}
+
+// -----------------------------------------------------------------------------
+void addStats(const size_t size, const size_t reserved) noexcept
+{
+    myStats.usedBytes += size;
+    myStats.reservedBytes += reserved;
+    myStats.blockCount++;
+    myStats.allocationCount++;
+    if (myStats.reservedBytes > myStats.highWaterMark)
+    {
+        myStats.highWaterMark = myStats.reservedBytes;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void removeStats(const size_t size, const size_t reserved) noexcept
+{
+    myStats.usedBytes -= size;
+    myStats.reservedBytes -= reserved;
+    myStats.blockCount--;
+    myStats.deallocationCount++;
+}
+
+// -----------------------------------------------------------------------------
+void* allocateRaw(const size_t totalSize) noexcept
+{
+    // Allocate init-time blocks from the arena.
+    if (myStartup && (nullptr != myArena))
+    {
+        auto raw{myArena->allocate(totalSize)};
+        if (nullptr != raw) { return raw; }
+    }
+
+    // Allocate runtime blocks from the smallest fitting pool with free blocks left.
+    if (!myStartup)
+    {
+        for (size_t i{}; i < myPoolCount; ++i)
+        {
+            if (myPools[i]->blockSize() < totalSize) { continue; }
+            auto raw{myPools[i]->allocate()};
+            if (nullptr != raw) { return raw; }
+        }
+    }
+
+    // Fall back to the general-purpose heap, unless forbidden.
+    if (!heapAllowed()) { return nullptr; }
+    auto raw{malloc(totalSize)};
+    if ((nullptr != raw) && !myStartup) { myStats.lateHeapCount++; }
+    return raw;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool setArena(Arena* arena) noexcept
+{
+    if (!myStartup) { return false; }
+    myArena = arena;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool addPool(BlockPool& pool) noexcept
+{
+    if (MaxPoolCount == myPoolCount) { return false; }
+    for (size_t i{}; i < myPoolCount; ++i)
+    {
+        if (myPools[i] == &pool) { return false; }
+    }
+
+    // Keep the pools sorted by block size, so that the smallest fitting pool is found first.
+    size_t index{myPoolCount};
+    while ((index > 0U) && (myPools[index - 1U]->blockSize() > pool.blockSize()))
+    {
+        myPools[index] = myPools[index - 1U];
+        index--;
+    }
+    myPools[index] = &pool;
+    myPoolCount++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void endStartup(const bool forbidHeap) noexcept
+{
+    utils::InterruptGuard guard{};
+    myStartup       = false;
+    myHeapForbidden = forbidHeap;
+}
+
+// -----------------------------------------------------------------------------
+bool isStartup() noexcept { return myStartup; }
+
+// -----------------------------------------------------------------------------
+void* allocate(const size_t size) noexcept
+{
+    if ((0U == size) || (size > SIZE_MAX - HeaderSize)) { return nullptr; }
+    utils::InterruptGuard guard{};
+    auto raw{allocateRaw(HeaderSize + size)};
+
+    if (nullptr == raw)
+    {
+        myStats.failedCount++;
+        return nullptr;
+    }
+    auto header{static_cast<Header*>(raw)};
+    header->size = size;
+    addStats(size, reservedSize(raw, size));
+    return header + 1U;
+}
+
+// -----------------------------------------------------------------------------
+void* reallocate(void* block, const size_t newSize) noexcept
+{
+    if (nullptr == block) { return allocate(newSize); }
+    if (0U == newSize)
+    {
+        deallocate(block);
+        return nullptr;
+    }
+    if (newSize > SIZE_MAX - HeaderSize) { return nullptr; }
+
+    utils::InterruptGuard guard{};
+    auto header{headerOf(block)};
+    const size_t size{header->size};
+    const size_t reserved{reservedSize(header, size)};
+    const auto pool{poolOwning(header)};
+
+    // Resize the block in place if the backend allows it.
+    bool resized{false};
+    if ((nullptr != myArena) && myArena->owns(header))
+    {
+        resized = myArena->resize(header, HeaderSize + size, HeaderSize + newSize);
+    }
+    else if (nullptr != pool) { resized = pool->blockSize() >= HeaderSize + newSize; }
+    else if (heapAllowed())
+    {
+        auto raw{realloc(header, HeaderSize + newSize)};
+        if (nullptr == raw)
+        {
+            myStats.failedCount++;
+            return nullptr;
+        }
+        if (!myStartup) { myStats.lateHeapCount++; }
+        header  = static_cast<Header*>(raw);
+        resized = true;
+    }
+
+    if (resized)
+    {
+        removeStats(size, reserved);
+        header->size = newSize;
+        addStats(newSize, reservedSize(header, newSize));
+        return header + 1U;
+    }
+
+    // Move the content to a new block otherwise.
+    auto newBlock{allocate(newSize)};
+    if (nullptr == newBlock) { return nullptr; }
+    memcpy(newBlock, block, size < newSize ? size : newSize);
+    deallocate(block);
+    return newBlock;
+}
+
+// -----------------------------------------------------------------------------
+void deallocate(void* block) noexcept
+{
+    if (nullptr == block) { return; }
+    utils::InterruptGuard guard{};
+    auto header{headerOf(block)};
+    const size_t size{header->size};
+    removeStats(size, reservedSize(header, size));
+
+    // Return the block to the backend it was allocated from.
+    if ((nullptr != myArena) && myArena->owns(header))
+    {
+        myArena->deallocate(header, HeaderSize + size);
+        return;
+    }
+    const auto pool{poolOwning(header)};
+    if (nullptr != pool) { pool->deallocate(header); }
+    else { free(header); }
+}
+
+// -----------------------------------------------------------------------------
+Stats stats() noexcept
+{
+    utils::InterruptGuard guard{};
+    return myStats;
+}
+
+// -----------------------------------------------------------------------------
+void reset() noexcept
+{
+    utils::InterruptGuard guard{};
+    myArena         = nullptr;
+    myPoolCount     = 0U;
+    myStartup       = true;
+    myHeapForbidden = false;
+    myStats         = {};
+}
+
+#ifdef TESTSUITE
+// -----------------------------------------------------------------------------
+void restoreStats(const Stats& stats) noexcept
+{
+    utils::InterruptGuard guard{};
+    myStats = stats;
+}
+#endif /** TESTSUITE */
+} // namespace allocator
+} // namespace memory
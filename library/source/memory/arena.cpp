@@ -0,0 +1,92 @@
+/**
+ * @brief Static arena (bump) allocator implementation details.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory/arena.h"
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+Arena::Arena(void* buffer, const size_t size) noexcept
+    : myBuffer{static_cast<uint8_t*>(buffer)}
+    , myCapacity{nullptr == buffer ? 0U : size}
+    , myOffset{}
+    , myHighWaterMark{}
+    , myFailedCount{}
+{}
+
+// -----------------------------------------------------------------------------
+void* Arena::allocate(const size_t size) noexcept
+{
+    const size_t blockSize{alignedSize(size)};
+
+    // Fail if the block doesn't fit in the remaining buffer.
+    if ((0U == size) || (blockSize > myCapacity - myOffset))
+    {
+        myFailedCount++;
+        return nullptr;
+    }
+
+    // Bump the offset past the new block.
+    auto block{myBuffer + myOffset};
+    myOffset += blockSize;
+    if (myOffset > myHighWaterMark) { myHighWaterMark = myOffset; }
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+bool Arena::resize(void* block, const size_t size, const size_t newSize) noexcept
+{
+    // Only the last block can be resized, since it's followed by free memory.
+    if ((0U == newSize) || !isLast(block, size)) { return false; }
+
+    const size_t blockOffset{static_cast<size_t>(static_cast<uint8_t*>(block) - myBuffer)};
+    const size_t newBlockSize{alignedSize(newSize)};
+    if (newBlockSize > myCapacity - blockOffset) { return false; }
+
+    myOffset = blockOffset + newBlockSize;
+    if (myOffset > myHighWaterMark) { myHighWaterMark = myOffset; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Arena::deallocate(void* block, const size_t size) noexcept
+{
+    // Roll back the offset if the block is the last one, otherwise keep it reserved.
+    if (isLast(block, size))
+    {
+        myOffset = static_cast<size_t>(static_cast<uint8_t*>(block) - myBuffer);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Arena::reset() noexcept { myOffset = 0U; }
+
+// -----------------------------------------------------------------------------
+bool Arena::owns(const void* block) const noexcept
+{
+    const auto address{static_cast<const uint8_t*>(block)};
+    return (address >= myBuffer) && (address < myBuffer + myCapacity);
+}
+
+// -----------------------------------------------------------------------------
+size_t Arena::capacity() const noexcept { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::used() const noexcept { return myOffset; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::highWaterMark() const noexcept { return myHighWaterMark; }
+
+// -----------------------------------------------------------------------------
+size_t Arena::failedCount() const noexcept { return myFailedCount; }
+
+// -----------------------------------------------------------------------------
+bool Arena::isLast(const void* block, const size_t size) const noexcept
+{
+    return owns(block) &&
+           (static_cast<const uint8_t*>(block) + alignedSize(size) == myBuffer + myOffset);
+}
+} // namespace memory
@@ -0,0 +1,76 @@
+/**
+ * @brief Static fixed-size block pool implementation details.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory/block_pool.h"
+
+namespace memory
+{
+// -----------------------------------------------------------------------------
+BlockPool::BlockPool(void* buffer, const size_t blockSize, const size_t blockCount) noexcept
+    : myBuffer{static_cast<uint8_t*>(buffer)}
+    , myBlockSize{alignedSize(blockSize)}
+    , myBlockCount{nullptr == buffer ? 0U : blockCount}
+    , myFreeList{nullptr}
+    , myFreeCount{myBlockCount}
+    , myMinFreeCount{myBlockCount}
+    , myFailedCount{}
+{
+    // Link the blocks in reverse order, so that they are allocated in address order.
+    for (size_t i{myBlockCount}; i > 0U; --i)
+    {
+        auto block{reinterpret_cast<FreeBlock*>(myBuffer + (i - 1U) * myBlockSize)};
+        block->next = myFreeList;
+        myFreeList  = block;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void* BlockPool::allocate() noexcept
+{
+    if (nullptr == myFreeList)
+    {
+        myFailedCount++;
+        return nullptr;
+    }
+    auto block{myFreeList};
+    myFreeList = block->next;
+    myFreeCount--;
+    if (myFreeCount < myMinFreeCount) { myMinFreeCount = myFreeCount; }
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+void BlockPool::deallocate(void* block) noexcept
+{
+    if (!owns(block)) { return; }
+    auto freeBlock{static_cast<FreeBlock*>(block)};
+    freeBlock->next = myFreeList;
+    myFreeList      = freeBlock;
+    myFreeCount++;
+}
+
+// -----------------------------------------------------------------------------
+bool BlockPool::owns(const void* block) const noexcept
+{
+    const auto address{static_cast<const uint8_t*>(block)};
+    return (address >= myBuffer) && (address < myBuffer + myBlockCount * myBlockSize);
+}
+
+// -----------------------------------------------------------------------------
+size_t BlockPool::blockSize() const noexcept { return myBlockSize; }
+
+// -----------------------------------------------------------------------------
+size_t BlockPool::blockCount() const noexcept { return myBlockCount; }
+
+// -----------------------------------------------------------------------------
+size_t BlockPool::freeCount() const noexcept { return myFreeCount; }
+
+// -----------------------------------------------------------------------------
+size_t BlockPool::highWaterMark() const noexcept { return myBlockCount - myMinFreeCount; }
+
+// -----------------------------------------------------------------------------
+size_t BlockPool::failedCount() const noexcept { return myFailedCount; }
+} // namespace memory
@@ -0,0 +1,85 @@
+/**
+ * @brief Memory diagnostics implementation details.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+#include "memory/allocator.h"
+#include "memory/diagnostics.h"
+#include "utils/utils.h"
+
+#ifndef TESTSUITE
+/** Start of the heap, provided by the linker. */
+extern "C" uint8_t __heap_start;
+
+/** End of the heap, provided by avr-libc (null until the heap has been used). */
+extern "C" char* __brkval;
+#endif
+
+namespace memory
+{
+namespace diagnostics
+{
+namespace
+{
+#ifndef TESTSUITE
+// -----------------------------------------------------------------------------
+uint8_t* heapEnd() noexcept
+{
+    return nullptr != __brkval ? reinterpret_cast<uint8_t*>(__brkval) : &__heap_start;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t* stackPointer() noexcept
+{
+    // The stack pointer points at the first free byte below the stack.
+    return reinterpret_cast<uint8_t*>(SP) + 1U;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t* ramEnd() noexcept { return reinterpret_cast<uint8_t*>(RAMEND) + 1U; }
+
+#else
+// -----------------------------------------------------------------------------
+uint8_t* heapEnd() noexcept { return test::Stack::data; }
+
+// -----------------------------------------------------------------------------
+uint8_t* stackPointer() noexcept { return test::Stack::pointer; }
+
+// -----------------------------------------------------------------------------
+uint8_t* ramEnd() noexcept { return test::Stack::data + test::Stack::Size; }
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+void paintStack() noexcept
+{
+    utils::InterruptGuard guard{};
+    const auto end{stackPointer()};
+    for (auto address{heapEnd()}; address < end; ++address) { *address = StackPaint; }
+}
+
+// -----------------------------------------------------------------------------
+StackUsage stackUsage() noexcept
+{
+    utils::InterruptGuard guard{};
+    const auto heap{heapEnd()};
+    const auto stack{stackPointer()};
+    const auto end{ramEnd()};
+
+    // Count the bytes above the heap the stack has never reached.
+    auto address{heap};
+    while ((address < stack) && (StackPaint == *address)) { ++address; }
+
+    return StackUsage{static_cast<size_t>(end - heap),
+                      static_cast<size_t>(end - stack),
+                      static_cast<size_t>(end - address),
+                      static_cast<size_t>(address - heap)};
+}
+
+// -----------------------------------------------------------------------------
+Report report() noexcept { return Report{allocator::stats(), stackUsage()}; }
+
+} // namespace diagnostics
+} // namespace memory
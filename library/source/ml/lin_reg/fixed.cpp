@@ -39,13 +39,21 @@ double Fixed::predict(const double input) const noexcept { return myWeight * inp
 // -----------------------------------------------------------------------------
 bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_t epochCount, 
                    const double learningRate) noexcept
+{
+    // Train on the training sets present in both vectors.
+    const size_t setCount{min(trainIn.size(), trainOut.size())};
+    return train(trainIn.data(), trainOut.data(), setCount, epochCount, learningRate);
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::train(const double* trainIn, const double* trainOut, const size_t setCount, 
+                  const size_t epochCount, const double learningRate) noexcept
 {
     // Check the epoch count and learning rate, return false if invalid.
     if ((0U == epochCount) || !isLearningRateValid(learningRate)) { return false; }
 
-    // Check the training set count, return false if invalid.
-    const size_t setCount{min(trainIn.size(), trainOut.size())};
-    if (0U == setCount) { return false; }
+    // Check the training data, return false if invalid.
+    if ((nullptr == trainIn) || (nullptr == trainOut) || (0U == setCount)) { return false; }
 
     // Clear the trainable parameters before starting training.
     myWeight = 0.0;
@@ -0,0 +1,95 @@
+/**
+ * @brief Free-running cycle clock implementation details.
+ */
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/circuit.h"
+#include "profiler/clock.h"
+#include "utils/utils.h"
+
+namespace profiler
+{
+namespace clock
+{
+namespace
+{
+/** Indicate whether the clock is running. */
+bool myRunning{false};
+
+/** The number of timer 1 overflows, i.e. the high word of the cycle count. */
+uint16_t myOverflowCount{};
+
+#ifdef TESTSUITE
+// -----------------------------------------------------------------------------
+uint32_t hostCycles() noexcept
+{
+    // Convert the CPU time of the calling thread to CPU cycles of the target, so that
+    // preemption by the host isn't measured.
+    return static_cast<uint32_t>(test::cpuTime_ns() * (F_CPU / 1000000UL) / 1000U);
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool start() noexcept
+{
+    if (myRunning) { return true; }
+    if (!driver::timer::reserveCircuit(driver::timer::Circuit::Timer1)) { return false; }
+
+    // Run timer 1 free in normal mode without prescaler, count the overflows.
+    utils::InterruptGuard guard{};
+    TCCR1A          = 0U;
+    TCNT1           = 0U;
+    myOverflowCount = 0U;
+    TIFR1           = (1U << TOV1);
+    TIMSK1          = (1U << TOIE1);
+    TCCR1B          = (1U << CS10);
+    utils::atomicStore(myRunning, true);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void stop() noexcept
+{
+    if (!utils::atomicLoad(myRunning)) { return; }
+    utils::atomicStore(myRunning, false);
+    TCCR1B = 0U;
+    TIMSK1 = 0U;
+    driver::timer::releaseCircuit(driver::timer::Circuit::Timer1);
+}
+
+// -----------------------------------------------------------------------------
+bool isRunning() noexcept { return utils::atomicLoad(myRunning); }
+
+// -----------------------------------------------------------------------------
+uint16_t timestamp() noexcept
+{
+#ifdef TESTSUITE
+    return static_cast<uint16_t>(hostCycles());
+#else
+    return TCNT1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+uint32_t cycles() noexcept
+{
+#ifdef TESTSUITE
+    return hostCycles();
+#else
+    utils::InterruptGuard guard{};
+    uint16_t high{myOverflowCount};
+    const uint16_t low{TCNT1};
+
+    // Account for an overflow that occurred after interrupts were disabled. 
+    if (utils::read(TIFR1, TOV1) && (0x8000U > low)) { ++high; }
+    return (static_cast<uint32_t>(high) << 16U) | low;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+ISR (TIMER1_OVF_vect) { ++myOverflowCount; }
+
+} // namespace clock
+} // namespace profiler
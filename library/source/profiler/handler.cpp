@@ -0,0 +1,52 @@
+/**
+ * @brief Cycle-budget profiler implementation details.
+ */
+#include <stdint.h>
+
+#include "profiler/handler.h"
+#include "utils/utils.h"
+
+namespace profiler
+{
+namespace handler
+{
+// -----------------------------------------------------------------------------
+uint32_t Profile::count() const noexcept { return utils::atomicLoad(myCount); }
+
+// -----------------------------------------------------------------------------
+uint32_t Profile::worst() const noexcept { return utils::atomicLoad(myWorst); }
+
+// -----------------------------------------------------------------------------
+uint64_t Profile::total() const noexcept
+{
+    utils::InterruptGuard guard{};
+    return myTotal;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Profile::mean() const noexcept
+{
+    // Handlers may be called in interrupt context, read the count and total together.
+    utils::InterruptGuard guard{};
+    return 0U < myCount ? static_cast<uint32_t>(myTotal / myCount) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+void Profile::record(const uint32_t duration_cycles) noexcept
+{
+    utils::InterruptGuard guard{};
+    if (myWorst < duration_cycles) { myWorst = duration_cycles; }
+    myTotal += duration_cycles;
+    ++myCount;
+}
+
+// -----------------------------------------------------------------------------
+void Profile::reset() noexcept
+{
+    utils::InterruptGuard guard{};
+    myCount = 0U;
+    myWorst = 0U;
+    myTotal = 0U;
+}
+} // namespace handler
+} // namespace profiler
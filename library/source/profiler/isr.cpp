@@ -0,0 +1,100 @@
+/**
+ * @brief Interrupt latency and ISR duration profiler implementation details.
+ */
+#include <stdint.h>
+
+#include "profiler/clock.h"
+#include "profiler/isr.h"
+#include "utils/utils.h"
+
+namespace profiler
+{
+namespace isr
+{
+namespace
+{
+/** The number of profiled vectors. */
+constexpr uint8_t VectorCount{static_cast<uint8_t>(Vector::Count)};
+
+/** The names of the profiled vectors. */
+constexpr const char* VectorNames[VectorCount]{
+    "TIMER0_OVF", "TIMER1_COMPA", "TIMER2_OVF", "PCINT0", "PCINT1", "PCINT2"};
+
+#ifdef ISR_PROFILING
+/** Statistics per vector. */
+Stats myStats[VectorCount]{};
+
+// -----------------------------------------------------------------------------
+uint8_t bucket(const uint16_t duration) noexcept
+{
+    uint8_t bucket{};
+    while (((BucketCount - 1U) > bucket) && (bucketLimit(bucket) <= duration)) { ++bucket; }
+    return bucket;
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+void reset() noexcept
+{
+#ifdef ISR_PROFILING
+    utils::InterruptGuard guard{};
+    for (auto& stats : myStats) { stats = Stats{}; }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+Stats stats(const Vector vector) noexcept
+{
+#ifdef ISR_PROFILING
+    if (Vector::Count <= vector) { return Stats{}; }
+    utils::InterruptGuard guard{};
+    return myStats[static_cast<uint8_t>(vector)];
+#else
+    (void) vector;
+    return Stats{};
+#endif
+}
+
+// -----------------------------------------------------------------------------
+const char* name(const Vector vector) noexcept
+{
+    return Vector::Count > vector ? VectorNames[static_cast<uint8_t>(vector)] : "unknown";
+}
+
+// -----------------------------------------------------------------------------
+void record(const Vector vector, const uint16_t entry, const uint16_t latency) noexcept
+{
+#ifdef ISR_PROFILING
+    // Take the timestamp first so the bookkeeping isn't part of the duration.
+    const uint16_t duration{static_cast<uint16_t>(clock::timestamp() - entry)};
+    if (!clock::isRunning() || (Vector::Count <= vector)) { return; }
+
+    // Interrupts are disabled in ISRs, but the profiler may be used in nested contexts too.
+    utils::InterruptGuard guard{};
+    auto& stats{myStats[static_cast<uint8_t>(vector)]};
+
+    if ((0U == stats.count) || (stats.min > duration)) { stats.min = duration; }
+    if (stats.max < duration) { stats.max = duration; }
+    if (stats.maxLatency < latency) { stats.maxLatency = latency; }
+    ++stats.count;
+
+    // Halve the sum behind the mean rather than letting it overflow; the mean is preserved.
+    if ((0xFFFFFFFFUL - stats.total) < duration)
+    {
+        stats.total >>= 1U;
+        stats.sampleCount >>= 1U;
+    }
+    stats.total += duration;
+    ++stats.sampleCount;
+
+    auto& bucketCount{stats.buckets[bucket(duration)]};
+    if (0xFFFFU > bucketCount) { ++bucketCount; }
+#else
+    (void) vector;
+    (void) entry;
+    (void) latency;
+#endif
+}
+} // namespace isr
+} // namespace profiler
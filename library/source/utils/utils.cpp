@@ -39,6 +39,16 @@ void globalInterruptEnable() noexcept { asm("SEI"); }
 // -----------------------------------------------------------------------------
 void globalInterruptDisable() noexcept { asm("CLI"); }
 
+// -----------------------------------------------------------------------------
+InterruptGuard::InterruptGuard() noexcept
+    : myStatus{SREG}
+{
+    globalInterruptDisable();
+}
+
+// -----------------------------------------------------------------------------
+InterruptGuard::~InterruptGuard() noexcept { SREG = myStatus; }
+
 } // namespace utils
 
 /**
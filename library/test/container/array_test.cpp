@@ -0,0 +1,128 @@
+/**
+ * @brief Unit tests for the static array.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/array.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Generate a lookup table of squares at compile time.
+ *
+ * @tparam Size The table size.
+ *
+ * @return Array holding the square of each index.
+ */
+template <std::size_t Size>
+constexpr Array<std::uint16_t, Size> squareTable() noexcept
+{
+    Array<std::uint16_t, Size> table{};
+    for (std::size_t i{}; i < table.size(); ++i)
+    {
+        table[i] = static_cast<std::uint16_t>(i * i);
+    }
+    return table;
+}
+
+/**
+ * @brief Sum the values of the given array via iterators.
+ *
+ * @tparam Size The array size.
+ *
+ * @param[in] array The array to sum.
+ *
+ * @return The sum of the values.
+ */
+template <std::size_t Size>
+constexpr int sum(const Array<int, Size>& array) noexcept
+{
+    int result{};
+    for (const auto& value : array) { result += value; }
+    return result;
+}
+
+/**
+ * @brief Copy, assign and move arrays at compile time.
+ *
+ * @return Array holding {4, 5, 6, 0}.
+ */
+constexpr Array<int, 4U> assignArray() noexcept
+{
+    constexpr int values[4U]{1, 2, 3, 4};
+    Array<int, 4U> array{values};
+    Array<int, 4U> copy{array};
+    const int newValues[3U]{4, 5, 6};
+
+    copy = newValues;
+    Array<int, 4U> moved{static_cast<Array<int, 4U>&&>(copy)};
+    moved[3U] = copy[0U];
+    array = moved;
+    return array;
+}
+
+// Verify that arrays can be created, modified and iterated at compile time.
+constexpr auto squares{squareTable<16U>()};
+static_assert(squares[0U] == 0U && squares[15U] == 225U, "Unexpected lookup table values!");
+static_assert(sum(Array<int, 5U>{1, 2, 3}) == 6, "Unexpected sum of array!");
+static_assert(Array<int, 5U>{}.size() == 5U, "Unexpected array size!");
+static_assert(Array<int, 2U>{7, 8}.data()[1U] == 8, "Unexpected array data!");
+static_assert(assignArray()[0U] == 4 && assignArray()[2U] == 6, "Unexpected assigned values!");
+static_assert(assignArray()[3U] == 0, "Moved array not cleared!");
+
+/**
+ * @brief Array copy and move test.
+ *
+ *        Verify that arrays are copied by value and that moved arrays are cleared.
+ */
+TEST(Container_Array, CopyAndMove)
+{
+    Array<int, 3U> array{1, 2, 3};
+
+    // Case 1 - Verify that the copy holds its own values.
+    {
+        Array<int, 3U> copy{array};
+        copy[0U] = 10;
+        EXPECT_EQ(array[0U], 1);
+        EXPECT_EQ(copy[0U], 10);
+        EXPECT_NE(copy.data(), array.data());
+
+        copy = array;
+        EXPECT_EQ(copy[0U], 1);
+    }
+
+    // Case 2 - Verify that the values are moved and the other array is cleared.
+    {
+        Array<int, 3U> moved{static_cast<Array<int, 3U>&&>(array)};
+        EXPECT_EQ(sum(moved), 6);
+        EXPECT_EQ(sum(array), 0);
+
+        array = static_cast<Array<int, 3U>&&>(moved);
+        EXPECT_EQ(sum(array), 6);
+        EXPECT_EQ(sum(moved), 0);
+    }
+
+    // Case 3 - Verify that values can be copied from arrays of other sizes.
+    {
+        const Array<int, 2U> small{7, 8};
+        array = small;
+        EXPECT_EQ(array[0U], 7);
+        EXPECT_EQ(array[1U], 8);
+        EXPECT_EQ(array[2U], 3);
+    }
+
+    // Case 4 - Verify that the lookup table generated at compile time is intact at runtime.
+    {
+        for (std::size_t i{}; i < squares.size(); ++i) { EXPECT_EQ(squares[i], i * i); }
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,248 @@
+/**
+ * @brief Unit tests for the sorted flat map.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/flat_map.h"
+#include "container/vector.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Check that the given map holds the expected keys in ascending order.
+ *
+ * @tparam Map The map type.
+ * @tparam KeyCount The number of expected keys.
+ *
+ * @param[in] map The map to check.
+ * @param[in] expected The expected keys.
+ */
+template <typename Map, std::size_t KeyCount>
+void expectKeys(const Map& map, const int (&expected)[KeyCount])
+{
+    ASSERT_EQ(map.size(), KeyCount);
+    std::size_t i{};
+    for (const auto& entry : map) { EXPECT_EQ(entry.key, expected[i++]); }
+}
+
+/** Command table built at compile time. */
+constexpr StaticFlatMap<char, int, 4U> commands{{{'t', 1}, {'r', 2}, {'s', 3}, {'t', 4}}};
+static_assert(commands.size() == 3U, "Duplicate key not ignored!");
+static_assert(*commands.find('t') == 1 && *commands.find('s') == 3, "Unexpected values!");
+static_assert(commands.find('x') == nullptr, "Unexpected key found!");
+static_assert(commands.begin() != commands.end(), "Unexpected empty map!");
+
+/**
+ * @brief Flat map modification test.
+ *
+ *        Verify that entries are kept sorted when inserted, assigned and erased.
+ */
+TEST(Container_FlatMap, Modification)
+{
+    FlatMap<int, double> map{};
+
+    // Case 1 - Verify that a new map is empty.
+    {
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.find(1), nullptr);
+        EXPECT_FALSE(map.erase(1));
+    }
+
+    // Case 2 - Verify that entries are sorted regardless of insertion order.
+    {
+        EXPECT_TRUE(map.insert(30, 3.0));
+        EXPECT_TRUE(map.insert(10, 1.0));
+        EXPECT_TRUE(map.insert(50, 5.0));
+        EXPECT_TRUE(map.insert(20, 2.0));
+        EXPECT_TRUE(map.insert(40, 4.0));
+        expectKeys(map, {10, 20, 30, 40, 50});
+    }
+
+    // Case 3 - Verify that existing keys are only overwritten on assignment.
+    {
+        EXPECT_FALSE(map.insert(30, 33.0));
+        EXPECT_EQ(*map.find(30), 3.0);
+        EXPECT_TRUE(map.insertOrAssign(30, 33.0));
+        EXPECT_EQ(*map.find(30), 33.0);
+        EXPECT_TRUE(map.insertOrAssign(35, 3.5));
+        expectKeys(map, {10, 20, 30, 35, 40, 50});
+    }
+
+    // Case 4 - Verify that values can be found and modified.
+    {
+        EXPECT_TRUE(map.contains(10));
+        EXPECT_FALSE(map.contains(15));
+        EXPECT_FALSE(map.contains(60));
+        *map.find(50) = 55.0;
+        EXPECT_EQ(*map.find(50), 55.0);
+    }
+
+    // Case 5 - Verify that entries can be erased anywhere.
+    {
+        EXPECT_TRUE(map.erase(10));
+        EXPECT_TRUE(map.erase(50));
+        EXPECT_TRUE(map.erase(30));
+        EXPECT_FALSE(map.erase(30));
+        expectKeys(map, {20, 35, 40});
+        EXPECT_EQ(*map.find(35), 3.5);
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+    }
+}
+
+/**
+ * @brief Static flat map test.
+ *
+ *        Verify that a map with static capacity rejects entries when full.
+ */
+TEST(Container_FlatMap, StaticCapacity)
+{
+    StaticFlatMap<int, int, 3U> map{};
+
+    EXPECT_TRUE(map.insert(3, 30));
+    EXPECT_TRUE(map.insert(1, 10));
+    EXPECT_TRUE(map.insert(2, 20));
+    EXPECT_FALSE(map.insert(0, 0));
+    EXPECT_FALSE(map.insertOrAssign(4, 40));
+    EXPECT_TRUE(map.insertOrAssign(2, 22));
+    expectKeys(map, {1, 2, 3});
+    EXPECT_EQ(*map.find(2), 22);
+
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_TRUE(map.insert(0, 0));
+    expectKeys(map, {0, 2, 3});
+}
+
+/**
+ * @brief Key counting the comparisons made with it.
+ */
+struct CountedKey
+{
+    /** The number of comparisons made. */
+    static inline std::uint32_t compareCount{};
+
+    /** The key value. */
+    std::uint32_t value;
+
+    /**
+     * @brief Check whether this key orders before the given key.
+     *
+     * @param[in] other The key to compare with.
+     *
+     * @return True if this key is less than the other, false otherwise.
+     */
+    bool operator<(const CountedKey& other) const noexcept
+    {
+        ++compareCount;
+        return value < other.value;
+    }
+
+    /**
+     * @brief Check whether this key equals the given key.
+     *
+     * @param[in] other The key to compare with.
+     *
+     * @return True if the keys are equal, false otherwise.
+     */
+    bool operator==(const CountedKey& other) const noexcept
+    {
+        ++compareCount;
+        return value == other.value;
+    }
+};
+
+/**
+ * @brief Look up all keys of a map and count the key comparisons.
+ *
+ * @param[in] keyCount The number of keys in the map.
+ * @param[in] useFlatMap True to use a flat map, false to scan an unsorted vector of entries.
+ * @param[out] maxCompareCount The highest number of comparisons made for a single lookup.
+ *
+ * @return The total number of comparisons made for all lookups.
+ */
+std::uint32_t countLookupComparisons(const std::uint32_t keyCount, const bool useFlatMap, 
+                                     std::uint32_t& maxCompareCount)
+{
+    using Entry = FlatMapEntry<CountedKey, std::uint32_t>;
+
+    FlatMap<CountedKey, std::uint32_t> map{};
+    Vector<Entry> entries{};
+
+    // Add the keys in scrambled order, use a multiplier coprime with the key count.
+    for (std::uint32_t i{}; i < keyCount; ++i)
+    {
+        const CountedKey key{(i * 7919U) % keyCount};
+        if (useFlatMap) { map.insert(key, key.value + 1U); }
+        else { entries.pushBack(Entry{key, key.value + 1U}); }
+    }
+
+    std::uint32_t total{};
+    maxCompareCount = 0U;
+
+    for (std::uint32_t i{}; i < keyCount; ++i)
+    {
+        const CountedKey key{i};
+        const std::uint32_t* value{nullptr};
+        CountedKey::compareCount = 0U;
+
+        if (useFlatMap) { value = map.find(key); }
+        else
+        {
+            for (const auto& entry : entries)
+            {
+                if (entry.key == key)
+                {
+                    value = &entry.value;
+                    break;
+                }
+            }
+        }
+        EXPECT_NE(value, nullptr);
+        if (nullptr != value) { EXPECT_EQ(*value, i + 1U); }
+
+        total += CountedKey::compareCount;
+        if (CountedKey::compareCount > maxCompareCount) 
+        { 
+            maxCompareCount = CountedKey::compareCount; 
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Flat map lookup comparison count.
+ *
+ *        Look up all keys in maps of 8 - 1024 entries, and compare with a linear scan of 
+ *        unsorted entries. Expect the binary search of the flat map to need at most 
+ *        floor(log2(n)) + 1 comparisons plus one to confirm the match, while the linear scan 
+ *        needs (n + 1) / 2 comparisons on average.
+ */
+TEST(Container_FlatMap, LookupComparisons)
+{
+    constexpr std::uint32_t keyCounts[]{8U, 64U, 256U, 1024U};
+
+    for (const auto& keyCount : keyCounts)
+    {
+        std::uint32_t bound{2U};
+        for (std::uint32_t n{keyCount}; n > 1U; n /= 2U) { ++bound; }
+
+        std::uint32_t linearMax{}, flatMapMax{};
+        const auto linearTotal{countLookupComparisons(keyCount, false, linearMax)};
+        countLookupComparisons(keyCount, true, flatMapMax);
+
+        EXPECT_EQ(linearTotal, keyCount * (keyCount + 1U) / 2U);
+        EXPECT_EQ(linearMax, keyCount);
+        EXPECT_LE(flatMapMax, bound);
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
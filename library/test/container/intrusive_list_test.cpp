@@ -0,0 +1,219 @@
+/**
+ * @brief Unit tests for the intrusive doubly linked list.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "container/intrusive_list.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/** Tag for linking events into a second list. */
+struct PendingTag;
+
+/**
+ * @brief Event that can be linked into two lists at once.
+ */
+struct Event : public IntrusiveListHook<>, public IntrusiveListHook<PendingTag>
+{
+    /**
+     * @brief Create new event.
+     * 
+     * @param[in] id The event ID.
+     */
+    explicit Event(const int id) noexcept
+        : id{id} {}
+
+    /** The event ID. */
+    int id;
+};
+
+/**
+ * @brief Check that the given list holds the expected events, in both directions.
+ *
+ * @tparam Tag The list tag.
+ * @tparam IdCount The number of expected events.
+ *
+ * @param[in] list The list to check.
+ * @param[in] expected The IDs of the expected events.
+ */
+template <typename Tag, std::size_t IdCount>
+void expectIds(IntrusiveList<Event, Tag>& list, const int (&expected)[IdCount])
+{
+    ASSERT_EQ(list.size(), IdCount);
+    std::size_t i{};
+
+    for (const auto& event : list) { EXPECT_EQ(event.id, expected[i++]); }
+    for (auto it{list.rbegin()}; it != list.rend(); --it) { EXPECT_EQ((*it).id, expected[--i]); }
+}
+
+/**
+ * @brief Intrusive list modification test.
+ *
+ *        Verify that elements can be linked and unlinked anywhere in the list.
+ */
+TEST(Container_IntrusiveList, Modification)
+{
+    IntrusiveList<Event> list{};
+    Event e0{0}, e1{1}, e2{2}, e3{3};
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.front(), nullptr);
+    EXPECT_EQ(list.popFront(), nullptr);
+    EXPECT_EQ(list.begin(), list.end());
+
+    // Case 1 - Link elements at the front, in the middle and at the back.
+    {
+        list.pushBack(e1);
+        list.pushBack(e3);
+        list.pushFront(e0);
+        auto it{list.begin()};
+        ++it;
+        ++it;
+        list.insert(it, e2);
+        expectIds(list, {0, 1, 2, 3});
+        EXPECT_EQ(list.front(), &e0);
+        EXPECT_EQ(list.back(), &e3);
+        EXPECT_TRUE(e2.IntrusiveListHook<>::isLinked());
+    }
+
+    // Case 2 - Unlink an element via its hook, expect it to be removed from the list.
+    {
+        e2.IntrusiveListHook<>::unlink();
+        EXPECT_FALSE(e2.IntrusiveListHook<>::isLinked());
+        expectIds(list, {0, 1, 3});
+        list.remove(e0);
+        expectIds(list, {1, 3});
+    }
+
+    // Case 3 - Push a linked element, expect it to be moved.
+    {
+        list.pushBack(e1);
+        expectIds(list, {3, 1});
+    }
+
+    // Case 4 - Push or insert elements where they already are, expect no change.
+    {
+        list.pushFront(*list.front());
+        expectIds(list, {3, 1});
+        list.pushBack(*list.back());
+        expectIds(list, {3, 1});
+        auto it{list.begin()};
+        ++it;
+        list.insert(it, *it);
+        expectIds(list, {3, 1});
+        auto first{list.begin()};
+        list.insert(first, e1);
+        expectIds(list, {1, 3});
+        auto last{list.end()};
+        list.insert(last, e1);
+        expectIds(list, {3, 1});
+    }
+
+    // Case 5 - Pop the elements.
+    {
+        EXPECT_EQ(list.popBack(), &e1);
+        EXPECT_EQ(list.popFront(), &e3);
+        EXPECT_TRUE(list.empty());
+        EXPECT_FALSE(e3.IntrusiveListHook<>::isLinked());
+    }
+}
+
+/**
+ * @brief Intrusive list lifetime test.
+ *
+ *        Verify that elements are unlinked when deleted and that copies are created unlinked.
+ */
+TEST(Container_IntrusiveList, Lifetime)
+{
+    IntrusiveList<Event> list{};
+    IntrusiveList<Event, PendingTag> pending{};
+    Event e0{0};
+
+    // Case 1 - Link an element into two lists.
+    {
+        list.pushBack(e0);
+        pending.pushBack(e0);
+        expectIds(list, {0});
+        expectIds(pending, {0});
+    }
+
+    // Case 2 - Copy the element, expect the copy to be unlinked.
+    {
+        Event copy{e0};
+        EXPECT_FALSE(copy.IntrusiveListHook<>::isLinked());
+        EXPECT_FALSE(copy.IntrusiveListHook<PendingTag>::isLinked());
+        list.pushBack(copy);
+        pending.pushFront(copy);
+        expectIds(list, {0, 0});
+    }
+
+    // Case 3 - Expect the deleted copy to have been unlinked from both lists.
+    {
+        expectIds(list, {0});
+        expectIds(pending, {0});
+    }
+
+    // Case 4 - Clear the list, expect the element to remain in the other list.
+    {
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_FALSE(e0.IntrusiveListHook<>::isLinked());
+        expectIds(pending, {0});
+    }
+}
+
+/**
+ * @brief Intrusive list atomic modification test.
+ *
+ *        Verify that the atomic modifiers restore the previous interrupt state.
+ */
+TEST(Container_IntrusiveList, Atomic)
+{
+    IntrusiveList<Event> list{};
+    Event e0{0}, e1{1};
+
+    // Case 1 - Modify the list with interrupts enabled, expect them to be enabled afterwards.
+    {
+        utils::globalInterruptEnable();
+        list.atomicPushBack(e1);
+        list.atomicPushFront(e0);
+        list.atomicPushFront(e0);
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+        expectIds(list, {0, 1});
+    }
+
+    // Case 2 - Modify the list with interrupts disabled, expect them to be disabled afterwards.
+    {
+        utils::globalInterruptDisable();
+        EXPECT_EQ(list.atomicPopBack(), &e1);
+        list.atomicRemove(e0);
+        EXPECT_EQ(list.atomicPopFront(), nullptr);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        EXPECT_TRUE(list.empty());
+    }
+
+    // Case 3 - Nest interrupt guards, expect the outermost guard to restore the state.
+    {
+        utils::globalInterruptEnable();
+        {
+            utils::InterruptGuard outer{};
+            {
+                utils::InterruptGuard inner{};
+                EXPECT_FALSE(utils::read(SREG, I_FLAG));
+            }
+            EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        }
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
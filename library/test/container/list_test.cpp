@@ -0,0 +1,245 @@
+/**
+ * @brief Unit tests for the doubly linked list.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "container/list.h"
+#include "memory/allocator.h"
+#include "memory/heap_allocator.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/** List allocating each node on the heap. */
+template <typename T>
+using HeapList = List<T, 1U, memory::HeapAllocator>;
+
+/**
+ * @brief Check that the given list holds the expected values, in both directions.
+ *
+ * @tparam ListType The list type.
+ * @tparam ValueCount The number of expected values.
+ *
+ * @param[in] list The list to check.
+ * @param[in] expected The expected values.
+ */
+template <typename ListType, std::size_t ValueCount>
+void expectValues(ListType& list, const int (&expected)[ValueCount])
+{
+    ASSERT_EQ(list.size(), ValueCount);
+    std::size_t i{};
+
+    for (const auto& value : list) { EXPECT_EQ(value, expected[i++]); }
+    for (auto it{list.rbegin()}; it != list.rend(); --it) { EXPECT_EQ(*it, expected[--i]); }
+}
+
+/**
+ * @brief Count the nodes of given list stored right after the previous node in memory.
+ *
+ * @tparam ListType The list type.
+ *
+ * @param[in] list The list to check.
+ * @param[in] stride The distance between adjacent nodes in bytes.
+ *
+ * @return The number of nodes adjacent to the previous node.
+ */
+template <typename ListType>
+std::size_t countAdjacentNodes(const ListType& list, const std::ptrdiff_t stride)
+{
+    std::size_t count{};
+    const std::uint8_t* previous{nullptr};
+
+    for (const auto& value : list)
+    {
+        const auto current{reinterpret_cast<const std::uint8_t*>(&value)};
+        if ((nullptr != previous) && (current - previous == stride)) { ++count; }
+        previous = current;
+    }
+    return count;
+}
+
+/**
+ * @brief List modification test.
+ *
+ *        Verify that values can be added and removed anywhere in the list.
+ */
+TEST(Container_List, Modification)
+{
+    List<int> list{};
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+
+    // Case 1 - Push values to the front and the back.
+    {
+        EXPECT_TRUE(list.pushBack(2));
+        EXPECT_TRUE(list.pushBack(3));
+        EXPECT_TRUE(list.pushFront(1));
+        expectValues(list, {1, 2, 3});
+    }
+
+    // Case 2 - Insert values at the front, in the middle and at the end.
+    {
+        auto it{list.begin()};
+        EXPECT_TRUE(list.insert(it, 0));
+        ++it;
+        EXPECT_TRUE(list.insert(it, 10));
+        auto end{list.end()};
+        EXPECT_TRUE(list.insert(end, 4));
+        expectValues(list, {0, 1, 10, 2, 3, 4});
+    }
+
+    // Case 3 - Remove values, expect the iterator to point at the next value.
+    {
+        auto it{list.begin()};
+        EXPECT_TRUE(list.remove(it));
+        EXPECT_EQ(*it, 1);
+        ++it;
+        EXPECT_TRUE(list.remove(it));
+        EXPECT_EQ(*it, 2);
+        auto last{list.rbegin()};
+        EXPECT_TRUE(list.remove(last));
+        EXPECT_EQ(last, list.end());
+        EXPECT_FALSE(list.remove(last));
+        expectValues(list, {1, 2, 3});
+    }
+
+    // Case 4 - Pop values at the front and the back.
+    {
+        list.popFront();
+        list.popBack();
+        expectValues(list, {2});
+        list.popBack();
+        EXPECT_TRUE(list.empty());
+        list.popFront();
+        EXPECT_TRUE(list.empty());
+    }
+
+    // Case 5 - Resize the list.
+    {
+        EXPECT_TRUE(list.resize(3U, 7));
+        expectValues(list, {7, 7, 7});
+        EXPECT_TRUE(list.resize(1U));
+        expectValues(list, {7});
+    }
+}
+
+/**
+ * @brief List copy and move test.
+ *
+ *        Verify that lists can be copied and moved along with their nodes.
+ */
+TEST(Container_List, CopyAndMove)
+{
+    List<int> list{};
+    for (int i{1}; i <= 3; ++i) { EXPECT_TRUE(list.pushBack(i)); }
+
+    // Case 1 - Copy the list, expect the values to be copied.
+    List<int> copy{list};
+    expectValues(copy, {1, 2, 3});
+    *copy.begin() = 10;
+    expectValues(list, {1, 2, 3});
+
+    // Case 2 - Append the copy, expect its values to be added.
+    list += copy;
+    expectValues(list, {1, 2, 3, 10, 2, 3});
+
+    // Case 3 - Move the list, expect the nodes to be taken over.
+    {
+        const auto* first{&*list.begin()};
+        List<int> moved{static_cast<List<int>&&>(list)};
+        EXPECT_EQ(&*moved.begin(), first);
+        EXPECT_TRUE(list.empty());
+        expectValues(moved, {1, 2, 3, 10, 2, 3});
+
+        copy = static_cast<List<int>&&>(moved);
+        expectValues(copy, {1, 2, 3, 10, 2, 3});
+        EXPECT_TRUE(moved.empty());
+    }
+
+    // Case 4 - Reuse the moved-from list.
+    EXPECT_TRUE(list.pushBack(5));
+    expectValues(list, {5});
+}
+
+/**
+ * @brief List node reuse test.
+ *
+ *        Verify that the memory of removed nodes is reused for new nodes, and that reserved 
+ *        nodes are used without further allocations.
+ */
+TEST(Container_List, NodeReuse)
+{
+    List<int, 4U> list{};
+    EXPECT_TRUE(list.reserve(8U));
+
+    // Fill the list with the reserved nodes, remove all values and fill it again.
+    for (int i{}; i < 8; ++i) { EXPECT_TRUE(list.pushBack(i)); }
+    const auto* first{&*list.begin()};
+    list.clear();
+    for (int i{}; i < 8; ++i) { EXPECT_TRUE(list.pushFront(i)); }
+
+    // Expect the same memory to be used, i.e. the last node allocated is the first released.
+    bool reused{false};
+    for (const auto& value : list) { reused |= (&value == first); }
+    EXPECT_TRUE(reused);
+}
+
+/**
+ * @brief List node allocation test.
+ *
+ *        Fill lists of 1k - 100k values with pooled nodes and with each node allocated 
+ *        individually on the heap. Unrelated allocations are made between the insertions to 
+ *        mimic a heap shared with the rest of the system. Expect the pooled nodes to come from
+ *        one allocation per slab and to be adjacent in memory within each slab, while heap
+ *        nodes need one allocation each.
+ */
+TEST(Container_List, NodeAllocation)
+{
+    constexpr std::size_t counts[]{1000U, 10000U, 100000U};
+    constexpr std::size_t slabSize{64U};
+    const auto allocationCount{[]() { return memory::allocator::stats().allocationCount; }};
+
+    for (const auto& count : counts)
+    {
+        List<std::uint32_t, slabSize> pooled{};
+        HeapList<std::uint32_t> heap{};
+        std::vector<std::uint8_t*> unrelated(count);
+        std::uint32_t pooledAllocations{}, heapAllocations{};
+
+        for (std::size_t i{}; i < count; ++i)
+        {
+            auto before{allocationCount()};
+            EXPECT_TRUE(pooled.pushBack(static_cast<std::uint32_t>(i)));
+            pooledAllocations += allocationCount() - before;
+
+            before = allocationCount();
+            EXPECT_TRUE(heap.pushBack(static_cast<std::uint32_t>(i)));
+            heapAllocations += allocationCount() - before;
+
+            unrelated[i] = utils::newMemory<std::uint8_t>(16U + (i % 7U) * 24U);
+        }
+
+        // Expect one allocation per slab of pooled nodes, one per heap node.
+        const auto slabCount{(count + slabSize - 1U) / slabSize};
+        EXPECT_EQ(pooledAllocations, slabCount);
+        EXPECT_EQ(heapAllocations, count);
+
+        // Expect the pooled nodes to be adjacent except between slabs.
+        const auto first{reinterpret_cast<const std::uint8_t*>(&*pooled.begin())};
+        const auto second{reinterpret_cast<const std::uint8_t*>(&*++pooled.begin())};
+        EXPECT_EQ(countAdjacentNodes(pooled, second - first), count - slabCount);
+
+        for (std::size_t i{}; i < count; ++i) { utils::deleteMemory(unrelated[i]); }
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
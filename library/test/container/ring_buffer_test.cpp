@@ -0,0 +1,257 @@
+/**
+ * @brief Unit tests for the fixed-capacity lock-free ring buffer.
+ */
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "container/ring_buffer.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/** Number of values passed between the threads in the stress tests. */
+constexpr std::uint32_t StressValueCount{1000000U};
+
+/**
+ * @brief Ring buffer single element test.
+ *
+ *        Verify that single values can be pushed and popped in FIFO order, also when the
+ *        indices wrap around.
+ */
+TEST(Container_RingBuffer, SingleElement)
+{
+    RingBuffer<int, 4U> buffer{};
+    int value{};
+
+    // Case 1 - Verify that a new buffer is empty.
+    {
+        EXPECT_EQ(buffer.capacity(), 4U);
+        EXPECT_EQ(buffer.size(), 0U);
+        EXPECT_TRUE(buffer.empty());
+        EXPECT_FALSE(buffer.full());
+        EXPECT_FALSE(buffer.pop(value));
+        EXPECT_FALSE(buffer.peek(value));
+    }
+
+    // Case 2 - Verify that all slots can be used and that a full buffer rejects new values.
+    {
+        for (int i{}; i < 4; ++i) { EXPECT_TRUE(buffer.push(i)); }
+        EXPECT_EQ(buffer.size(), 4U);
+        EXPECT_TRUE(buffer.full());
+        EXPECT_FALSE(buffer.push(4));
+    }
+
+    // Case 3 - Verify that values are popped in FIFO order.
+    {
+        EXPECT_TRUE(buffer.peek(value));
+        EXPECT_EQ(value, 0);
+        EXPECT_TRUE(buffer.pop(value));
+        EXPECT_EQ(value, 0);
+        EXPECT_TRUE(buffer.pop(value));
+        EXPECT_EQ(value, 1);
+        EXPECT_EQ(buffer.size(), 2U);
+    }
+
+    // Case 4 - Verify that the order is maintained when the indices wrap around many times.
+    {
+        int next{4};
+        int expected{2};
+
+        for (int i{}; i < 1000; ++i)
+        {
+            EXPECT_TRUE(buffer.push(next++));
+            EXPECT_TRUE(buffer.pop(value));
+            EXPECT_EQ(value, expected++);
+        }
+        EXPECT_EQ(buffer.size(), 2U);
+    }
+
+    // Case 5 - Verify that the buffer can be cleared.
+    {
+        buffer.clear();
+        EXPECT_TRUE(buffer.empty());
+        EXPECT_FALSE(buffer.pop(value));
+        EXPECT_TRUE(buffer.push(42));
+        EXPECT_TRUE(buffer.pop(value));
+        EXPECT_EQ(value, 42);
+    }
+}
+
+/**
+ * @brief Ring buffer bulk test.
+ *
+ *        Verify that spans of values can be pushed and popped, also across the end of the
+ *        storage.
+ */
+TEST(Container_RingBuffer, Bulk)
+{
+    RingBuffer<std::uint16_t, 8U> buffer{};
+    const std::uint16_t input[]{1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U};
+    std::uint16_t output[10U]{};
+
+    // Case 1 - Verify that only the values there is room for are pushed.
+    {
+        EXPECT_EQ(buffer.push(input, 10U), 8U);
+        EXPECT_TRUE(buffer.full());
+        EXPECT_EQ(buffer.push(input, 1U), 0U);
+    }
+
+    // Case 2 - Verify that only the available values are popped.
+    {
+        EXPECT_EQ(buffer.pop(output, 5U), 5U);
+        EXPECT_EQ(buffer.pop(output + 5U, 10U), 3U);
+        EXPECT_EQ(buffer.pop(output, 10U), 0U);
+        for (std::uint8_t i{}; i < 8U; ++i) { EXPECT_EQ(output[i], input[i]); }
+    }
+
+    // Case 3 - Verify that spans wrapping around the end of the storage are handled.
+    {
+        EXPECT_EQ(buffer.push(input, 5U), 5U);
+        EXPECT_EQ(buffer.pop(output, 3U), 3U);
+
+        // The head is now at index 5, hence the values are split between the end and the start.
+        EXPECT_EQ(buffer.push(input + 5U, 5U), 5U);
+        EXPECT_EQ(buffer.size(), 7U);
+        EXPECT_EQ(buffer.pop(output, 10U), 7U);
+        for (std::uint8_t i{}; i < 7U; ++i) { EXPECT_EQ(output[i], input[i + 3U]); }
+    }
+
+    // Case 4 - Verify that single and bulk operations can be mixed.
+    {
+        std::uint16_t value{};
+        EXPECT_TRUE(buffer.push(100U));
+        EXPECT_EQ(buffer.push(input, 2U), 2U);
+        EXPECT_TRUE(buffer.pop(value));
+        EXPECT_EQ(value, 100U);
+        EXPECT_EQ(buffer.pop(output, 10U), 2U);
+        EXPECT_EQ(output[0U], 1U);
+        EXPECT_EQ(output[1U], 2U);
+    }
+}
+
+/**
+ * @brief Ring buffer wide index test.
+ *
+ *        Verify that buffers with more than 128 elements use 16-bit indices and that all
+ *        slots can be used.
+ */
+TEST(Container_RingBuffer, WideIndex)
+{
+    RingBuffer<std::uint8_t, 128U> small{};
+    RingBuffer<std::uint8_t, 256U> large{};
+    std::uint8_t value{};
+
+    EXPECT_EQ(sizeof(RingBuffer<std::uint8_t, 128U>::Index), 1U);
+    EXPECT_EQ(sizeof(RingBuffer<std::uint8_t, 256U>::Index), 2U);
+
+    for (int round{}; round < 3; ++round)
+    {
+        for (std::uint16_t i{}; i < 256U; ++i)
+        {
+            EXPECT_EQ(small.push(static_cast<std::uint8_t>(i)), i < 128U);
+            EXPECT_TRUE(large.push(static_cast<std::uint8_t>(i)));
+        }
+        EXPECT_TRUE(small.full());
+        EXPECT_TRUE(large.full());
+
+        for (std::uint16_t i{}; i < 256U; ++i)
+        {
+            EXPECT_TRUE(large.pop(value));
+            EXPECT_EQ(value, static_cast<std::uint8_t>(i));
+        }
+        small.clear();
+        EXPECT_TRUE(large.empty());
+    }
+}
+
+/**
+ * @brief Ring buffer single element stress test.
+ *
+ *        Verify that a producer and a consumer running in separate threads pass all values
+ *        in order without losses or duplicates.
+ */
+TEST(Container_RingBuffer, StressSingleElement)
+{
+    RingBuffer<std::uint32_t, 16U> buffer{};
+    bool success{true};
+
+    std::thread producer{[&buffer]()
+    {
+        for (std::uint32_t i{}; i < StressValueCount; ++i)
+        {
+            while (!buffer.push(i)) { std::this_thread::yield(); }
+        }
+    }};
+
+    // Consume in this thread, accumulate the result to keep gtest out of the hot loop.
+    for (std::uint32_t expected{}; expected < StressValueCount; ++expected)
+    {
+        std::uint32_t value{};
+        while (!buffer.pop(value)) { std::this_thread::yield(); }
+        success &= value == expected;
+    }
+
+    producer.join();
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(buffer.empty());
+}
+
+/**
+ * @brief Ring buffer bulk stress test.
+ *
+ *        Verify that a producer and a consumer running in separate threads pass all values
+ *        in order when using spans of varying lengths.
+ */
+TEST(Container_RingBuffer, StressBulk)
+{
+    RingBuffer<std::uint32_t, 64U> buffer{};
+    bool success{true};
+
+    std::thread producer{[&buffer]()
+    {
+        std::uint32_t input[37U]{};
+        std::uint32_t next{};
+        std::size_t length{1U};
+
+        while (next < StressValueCount)
+        {
+            // Vary the span length to hit all wrap-around positions.
+            length = (length % 37U) + 1U;
+            if (length > StressValueCount - next) { length = StressValueCount - next; }
+            for (std::size_t i{}; i < length; ++i) { input[i] = next + i; }
+
+            std::size_t pushed{};
+            while (pushed < length)
+            {
+                const auto count{buffer.push(input + pushed, length - pushed)};
+                if (count == 0U) { std::this_thread::yield(); }
+                pushed += count;
+            }
+            next += length;
+        }
+    }};
+
+    std::uint32_t output[23U]{};
+    std::uint32_t expected{};
+
+    while (expected < StressValueCount)
+    {
+        const auto count{buffer.pop(output, sizeof(output) / sizeof(output[0U]))};
+        if (count == 0U) { std::this_thread::yield(); }
+        for (std::size_t i{}; i < count; ++i) { success &= output[i] == expected++; }
+    }
+
+    producer.join();
+    EXPECT_TRUE(success);
+    EXPECT_EQ(expected, StressValueCount);
+    EXPECT_TRUE(buffer.empty());
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,245 @@
+/**
+ * @brief Unit tests for the dynamic vector with inline storage.
+ */
+#include <cstdint>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "container/small_vector.h"
+#include "memory/allocator.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Check whether given vector stores its content inside the given object.
+ *
+ * @tparam ObjectType The type of the object.
+ *
+ * @param[in] vector The vector to check.
+ * @param[in] object The object to check against.
+ *
+ * @return True if the vector data is located inside the object, false otherwise.
+ */
+template <typename ObjectType>
+bool isStoredIn(const Vector<int>& vector, const ObjectType& object)
+{
+    const auto data{reinterpret_cast<const std::uint8_t*>(vector.data())};
+    const auto start{reinterpret_cast<const std::uint8_t*>(&object)};
+    return (start <= data) && (data < start + sizeof(object));
+}
+
+/**
+ * @brief Calculate the sum of the values in given vector.
+ *
+ * @param[in] vector The vector holding the values to sum.
+ *
+ * @return The sum of the values.
+ */
+int sum(const Vector<int>& vector)
+{
+    int sum{};
+    for (const auto& value : vector) { sum += value; }
+    return sum;
+}
+
+/**
+ * @brief Small vector inline storage test.
+ *
+ *        Verify that up to N elements are stored inline and that the content spills to the heap
+ *        beyond that.
+ */
+TEST(Container_SmallVector, InlineStorage)
+{
+    SmallVector<int, 4U> vector{};
+    EXPECT_TRUE(vector.empty());
+    EXPECT_TRUE(vector.isInline());
+    EXPECT_EQ(vector.capacity(), 4U);
+    EXPECT_EQ(vector.inlineCapacity(), 4U);
+
+    // Case 1 - Push values within the inline capacity, expect the content to be stored inline.
+    {
+        for (int i{}; i < 4; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        EXPECT_TRUE(vector.isInline());
+        EXPECT_TRUE(isStoredIn(vector, vector));
+        EXPECT_EQ(vector.capacity(), 4U);
+    }
+
+    // Case 2 - Exceed the inline capacity, expect the content to spill to the heap.
+    {
+        EXPECT_TRUE(vector.pushBack(4));
+        EXPECT_FALSE(vector.isInline());
+        EXPECT_FALSE(isStoredIn(vector, vector));
+        EXPECT_EQ(vector.capacity(), 8U);
+
+        for (std::size_t i{}; i < vector.size(); ++i) 
+        { 
+            EXPECT_EQ(vector[i], static_cast<int>(i)); 
+        }
+    }
+
+    // Case 3 - Pop and shrink, expect the content to be moved back inline.
+    {
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_TRUE(vector.shrinkToFit());
+        EXPECT_TRUE(vector.isInline());
+        EXPECT_EQ(vector.capacity(), 4U);
+        EXPECT_EQ(sum(vector), 0 + 1 + 2);
+    }
+
+    // Case 4 - Clear the vector, expect the inline storage to be kept.
+    {
+        vector.clear();
+        EXPECT_TRUE(vector.empty());
+        EXPECT_TRUE(vector.isInline());
+        EXPECT_EQ(vector.capacity(), 4U);
+    }
+}
+
+/**
+ * @brief Small vector compatibility test.
+ *
+ *        Verify that small vectors use the same iterators as Vector<T> and can be used wherever
+ *        a Vector<T> is expected.
+ */
+TEST(Container_SmallVector, Compatibility)
+{
+    static_assert(std::is_same<SmallVector<int, 4U>::Iterator, Vector<int>::Iterator>::value,
+                  "Small vectors must use the vector iterator!");
+    static_assert(sizeof(Vector<int>) == sizeof(int*) + 2U * sizeof(std::size_t),
+                  "Inline storage must not add fields to plain vectors!");
+    static_assert(
+        std::is_same<SmallVector<int, 4U>::ConstIterator, Vector<int>::ConstIterator>::value,
+        "Small vectors must use the vector iterator!");
+
+    const SmallVector<int, 8U> small{1, 2, 3, 4, 5};
+    EXPECT_EQ(small.size(), 5U);
+    EXPECT_TRUE(small.isInline());
+
+    // Case 1 - Pass the small vector as a vector, expect the content to be accessible.
+    EXPECT_EQ(sum(small), 15);
+
+    // Case 2 - Copy the small vector to a vector and back, expect the content to be copied.
+    {
+        Vector<int> vector{small};
+        EXPECT_EQ(sum(vector), 15);
+        EXPECT_NE(vector.data(), small.data());
+
+        SmallVector<int, 2U> copy{vector};
+        EXPECT_FALSE(copy.isInline());
+        EXPECT_EQ(sum(copy), 15);
+    }
+
+    // Case 3 - Move an inline vector, expect the content to be copied and the source emptied.
+    {
+        SmallVector<int, 8U> source{small};
+        Vector<int> vector{static_cast<Vector<int>&&>(source)};
+        EXPECT_EQ(sum(vector), 15);
+        EXPECT_TRUE(source.empty());
+        EXPECT_TRUE(source.isInline());
+    }
+
+    // Case 4 - Move a spilled vector, expect the allocated memory to be taken over.
+    {
+        SmallVector<int, 2U> source{small};
+        const auto* data{source.data()};
+        SmallVector<int, 2U> target{static_cast<SmallVector<int, 2U>&&>(source)};
+        EXPECT_EQ(target.data(), data);
+        EXPECT_EQ(sum(target), 15);
+        EXPECT_TRUE(source.empty());
+        EXPECT_TRUE(source.isInline());
+        EXPECT_EQ(source.capacity(), 2U);
+    }
+
+    // Case 5 - Assign vectors, expect the content to be copied.
+    {
+        SmallVector<int, 8U> target{};
+        target = small;
+        EXPECT_TRUE(target.isInline());
+        EXPECT_EQ(sum(target), 15);
+
+        const Vector<int> vector{10, 20};
+        target = vector;
+        EXPECT_EQ(target.size(), 2U);
+        EXPECT_EQ(sum(target), 30);
+    }
+
+    // Case 6 - Clear a spilled vector as a vector, expect the memory to be released and
+    //          the inline storage to be used again once cleared as a small vector.
+    {
+        SmallVector<int, 2U> target{small};
+        Vector<int>& vector{target};
+        vector.clear();
+        EXPECT_TRUE(target.empty());
+        EXPECT_EQ(target.capacity(), 0U);
+
+        target.clear();
+        EXPECT_TRUE(target.isInline());
+        EXPECT_EQ(target.capacity(), 2U);
+    }
+}
+
+/**
+ * @brief Small vector allocation count.
+ *
+ *        Repeatedly create and fill small vectors, and compare with vectors allocating their
+ *        memory on the heap. Expect no heap allocation as long as the content fits inline,
+ *        and a single one when it spills.
+ */
+TEST(Container_SmallVector, AllocationCount)
+{
+    constexpr std::size_t iterationCount{100U};
+    constexpr int valueCount{8};
+    int heapSum{}, inlineSum{};
+    const auto allocationCount{[]() { return memory::allocator::stats().allocationCount; }};
+
+    // Case 1 - Fill heap vectors, expect them to reallocate as they grow.
+    {
+        const auto before{allocationCount()};
+
+        for (std::size_t i{}; i < iterationCount; ++i)
+        {
+            Vector<int> vector{};
+            for (int j{}; j < valueCount; ++j) { vector.pushBack(j); }
+            heapSum += sum(vector);
+        }
+        EXPECT_GT(allocationCount() - before, iterationCount);
+    }
+
+    // Case 2 - Fill small vectors within the inline capacity, expect no heap allocations.
+    {
+        const auto before{allocationCount()};
+
+        for (std::size_t i{}; i < iterationCount; ++i)
+        {
+            SmallVector<int, valueCount> vector{};
+            for (int j{}; j < valueCount; ++j) { vector.pushBack(j); }
+            EXPECT_TRUE(vector.isInline());
+            inlineSum += sum(vector);
+        }
+        EXPECT_EQ(allocationCount(), before);
+        EXPECT_EQ(heapSum, inlineSum);
+    }
+
+    // Case 3 - Exceed the inline capacity, expect a single allocation per vector.
+    {
+        const auto before{allocationCount()};
+
+        for (std::size_t i{}; i < iterationCount; ++i)
+        {
+            SmallVector<int, valueCount> vector{};
+            for (int j{}; j <= valueCount; ++j) { vector.pushBack(j); }
+            EXPECT_FALSE(vector.isInline());
+        }
+        EXPECT_EQ(allocationCount() - before, iterationCount);
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,177 @@
+/**
+ * @brief Unit tests for the static-capacity vector.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/static_vector.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Check that the given vector holds the expected values, in both directions.
+ *
+ * @tparam T The vector type.
+ * @tparam N The vector capacity.
+ * @tparam ValueCount The number of expected values.
+ *
+ * @param[in] vector The vector to check.
+ * @param[in] expected The expected values.
+ */
+template <typename T, std::size_t N, std::size_t ValueCount>
+void expectValues(const StaticVector<T, N>& vector, const T (&expected)[ValueCount])
+{
+    ASSERT_EQ(vector.size(), ValueCount);
+    std::size_t i{};
+
+    for (const auto& value : vector) { EXPECT_EQ(value, expected[i++]); }
+    for (auto it{vector.rbegin()}; it != vector.rend(); --it) { EXPECT_EQ(*it, expected[--i]); }
+}
+
+/**
+ * @brief Build a vector at compile time via all modifiers.
+ *
+ * @return Vector holding {0, 10, 20, 30}.
+ */
+constexpr StaticVector<int, 8U> buildVector() noexcept
+{
+    StaticVector<int, 8U> vector{};
+    vector.pushBack(10);
+    vector.pushBack(30);
+    vector.emplaceBack(99);
+    vector.insert(1U, 20);
+    vector.insert(vector.begin(), 0);
+    vector.popBack();
+    return vector;
+}
+
+/**
+ * @brief Sum the values of the given vector via iterators.
+ *
+ * @param[in] vector The vector to sum.
+ *
+ * @return The sum of the values.
+ */
+template <std::size_t N>
+constexpr int sum(const StaticVector<int, N>& vector) noexcept
+{
+    int result{};
+    for (const auto& value : vector) { result += value; }
+    return result;
+}
+
+// Verify that the vector can be built, modified and iterated at compile time.
+constexpr auto compileTimeVector{buildVector()};
+static_assert(compileTimeVector.size() == 4U, "Unexpected size of compile-time vector!");
+static_assert(compileTimeVector[0U] == 0 && compileTimeVector[3U] == 30, "Unexpected values!");
+static_assert(*compileTimeVector.last() == 30, "Unexpected last value of compile-time vector!");
+static_assert(sum(compileTimeVector) == 60, "Unexpected sum of compile-time vector!");
+static_assert(sum(StaticVector<int, 4U>{1, 2, 3}) == 6, "Unexpected sum of vector!");
+static_assert(StaticVector<int, 4U>{}.empty(), "New vector isn't empty!");
+static_assert(StaticVector<int, 4U>::capacity() == 4U, "Unexpected vector capacity!");
+
+/**
+ * @brief Static vector modification test.
+ *
+ *        Verify that values can be pushed, popped, inserted and erased within the capacity.
+ */
+TEST(Container_StaticVector, Modification)
+{
+    StaticVector<std::uint32_t, 5U> vector{};
+
+    // Case 1 - Verify that a new vector is empty.
+    {
+        EXPECT_TRUE(vector.empty());
+        EXPECT_FALSE(vector.full());
+        EXPECT_EQ(vector.last(), nullptr);
+        EXPECT_EQ(vector.begin(), vector.end());
+        EXPECT_FALSE(vector.popBack());
+        EXPECT_FALSE(vector.erase(0U));
+    }
+
+    // Case 2 - Verify that values can be pushed until the vector is full.
+    {
+        for (std::uint32_t i{1U}; i <= 5U; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        EXPECT_TRUE(vector.full());
+        EXPECT_FALSE(vector.pushBack(6U));
+        EXPECT_FALSE(vector.emplaceBack(6U));
+        EXPECT_FALSE(vector.insert(0U, 6U));
+        expectValues(vector, {1U, 2U, 3U, 4U, 5U});
+    }
+
+    // Case 3 - Verify that values can be erased by index and iterator.
+    {
+        EXPECT_TRUE(vector.erase(0U));
+        auto it{vector.begin()};
+        it += 2U;
+        EXPECT_TRUE(vector.erase(it));
+        EXPECT_EQ(*it, 5U);
+        EXPECT_FALSE(vector.erase(3U));
+        expectValues(vector, {2U, 3U, 5U});
+    }
+
+    // Case 4 - Verify that values can be inserted by index and iterator, including the end.
+    {
+        EXPECT_TRUE(vector.insert(2U, 4U));
+        EXPECT_TRUE(vector.insert(vector.end(), 6U));
+        EXPECT_FALSE(vector.insert(vector.end(), 7U));
+        expectValues(vector, {2U, 3U, 4U, 5U, 6U});
+
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_FALSE(vector.insert(5U, 7U));
+        EXPECT_TRUE(vector.insert(vector.begin(), vector[3U]));
+        expectValues(vector, {5U, 2U, 3U, 4U, 5U});
+    }
+
+    // Case 5 - Verify that iterators not pointing into the vector are rejected.
+    {
+        StaticVector<std::uint32_t, 5U> other{};
+        EXPECT_FALSE(other.insert(vector.begin(), 1U));
+        EXPECT_FALSE(vector.erase(vector.end()));
+    }
+
+    // Case 6 - Verify that the vector can be resized and cleared, and that removed values
+    //          are reset.
+    {
+        EXPECT_TRUE(vector.resize(2U));
+        EXPECT_FALSE(vector.resize(6U));
+        EXPECT_TRUE(vector.resize(4U));
+        expectValues(vector, {5U, 2U, 0U, 0U});
+
+        vector.clear();
+        EXPECT_TRUE(vector.empty());
+        EXPECT_EQ(vector.data()[0U], 0U);
+    }
+}
+
+/**
+ * @brief Static vector copy test.
+ *
+ *        Verify that vectors are copied by value, including their size.
+ */
+TEST(Container_StaticVector, Copy)
+{
+    StaticVector<double, 4U> vector{0.5, 1.5};
+    StaticVector<double, 4U> copy{vector};
+
+    EXPECT_TRUE(vector.pushBack(2.5));
+    expectValues(copy, {0.5, 1.5});
+
+    copy = vector;
+    expectValues(copy, {0.5, 1.5, 2.5});
+    EXPECT_NE(copy.data(), vector.data());
+
+    // Verify that the size constructor is limited to the capacity.
+    const std::size_t size{10U};
+    const StaticVector<double, 4U> sized{size};
+    EXPECT_EQ(sized.size(), 4U);
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,378 @@
+/**
+ * @brief Unit tests for the dynamic vector.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/vector.h"
+#include "memory/allocator.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Push given number of values to a vector and count the allocations.
+ *
+ * @param[in] count The number of values to push.
+ * @param[in] growPerPush True to reallocate on every push, like the vector did before
+ *                        capacity was introduced.
+ *
+ * @return The number of allocations made via memory::allocator, including reallocations.
+ */
+std::uint32_t countPushAllocations(const std::size_t count, const bool growPerPush)
+{
+    Vector<std::uint32_t> vector{};
+    bool success{true};
+    const auto before{memory::allocator::stats().allocationCount};
+
+    for (std::size_t i{}; i < count; ++i)
+    {
+        // Reserve room for exactly one more element to emulate reallocation on every push.
+        if (growPerPush) { success &= vector.reserve(vector.size() + 1U); }
+        success &= vector.pushBack(static_cast<std::uint32_t>(i));
+    }
+
+    EXPECT_TRUE(success);
+    EXPECT_EQ(vector.size(), count);
+    EXPECT_EQ(*vector.last(), static_cast<std::uint32_t>(count - 1U));
+    return memory::allocator::stats().allocationCount - before;
+}
+
+/**
+ * @brief Element type counting its constructions, copies, moves and destructions.
+ */
+struct Tracked
+{
+    /** The number of living instances. */
+    static inline int liveCount{};
+
+    /** The number of copies made. */
+    static inline int copyCount{};
+
+    /** The number of moves made. */
+    static inline int moveCount{};
+
+    /**
+     * @brief Reset the counters.
+     */
+    static void resetCounters() noexcept
+    {
+        liveCount = 0;
+        copyCount = 0;
+        moveCount = 0;
+    }
+
+    /**
+     * @brief Create new instance holding 0.
+     */
+    Tracked() noexcept
+        : Tracked{0} {}
+
+    /**
+     * @brief Create new instance holding given value.
+     * 
+     * @param[in] value The value to hold.
+     */
+    explicit Tracked(const int value) noexcept
+        : myValue{value} { liveCount++; }
+
+    /**
+     * @brief Create copy of another instance.
+     * 
+     * @param[in] other The instance to copy.
+     */
+    Tracked(const Tracked& other) noexcept
+        : myValue{other.myValue} 
+    { 
+        liveCount++;
+        copyCount++;
+    }
+
+    /**
+     * @brief Move another instance.
+     * 
+     * @param[in] other The instance to move.
+     */
+    Tracked(Tracked&& other) noexcept
+        : myValue{other.myValue} 
+    { 
+        other.myValue = -1;
+        liveCount++;
+        moveCount++;
+    }
+
+    /**
+     * @brief Delete instance.
+     */
+    ~Tracked() noexcept { liveCount--; }
+
+    Tracked& operator=(const Tracked&) = delete; // No copy assignment.
+    Tracked& operator=(Tracked&&)      = delete; // No move assignment.
+
+    /** The value held. */
+    int myValue;
+};
+
+/**
+ * @brief Vector capacity test.
+ *
+ *        Verify that the capacity of the vector grows geometrically and is only released on demand.
+ */
+TEST(Container_Vector, Capacity)
+{
+    Vector<int> vector{};
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.capacity(), 0U);
+
+    // Case 1 - Push values, expect the capacity to double when the vector is full.
+    {
+        constexpr std::size_t expectedCapacity[]{1U, 2U, 4U, 4U, 8U, 8U, 8U, 8U, 16U};
+
+        for (std::size_t i{}; i < sizeof(expectedCapacity) / sizeof(expectedCapacity[0U]); ++i)
+        {
+            EXPECT_TRUE(vector.pushBack(static_cast<int>(i)));
+            EXPECT_EQ(vector.size(), i + 1U);
+            EXPECT_EQ(vector.capacity(), expectedCapacity[i]);
+        }
+        EXPECT_EQ(*vector.last(), 8);
+    }
+
+    // Case 2 - Pop values, expect the size to decrease while the capacity is left unchanged.
+    {
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_EQ(vector.size(), 7U);
+        EXPECT_EQ(vector.capacity(), 16U);
+        EXPECT_EQ(*vector.last(), 6);
+    }
+
+    // Case 3 - Shrink the vector, expect the capacity to match the size.
+    {
+        EXPECT_TRUE(vector.shrinkToFit());
+        EXPECT_EQ(vector.capacity(), 7U);
+
+        for (std::size_t i{}; i < vector.size(); ++i)
+        {
+            EXPECT_EQ(vector[i], static_cast<int>(i));
+        }
+    }
+
+    // Case 4 - Pop all values and shrink, expect the memory to be released.
+    {
+        while (!vector.empty()) { EXPECT_TRUE(vector.popBack()); }
+        EXPECT_TRUE(vector.popBack());
+        EXPECT_EQ(vector.capacity(), 7U);
+        EXPECT_EQ(vector.last(), nullptr);
+
+        EXPECT_TRUE(vector.shrinkToFit());
+        EXPECT_EQ(vector.capacity(), 0U);
+        EXPECT_EQ(vector.data(), nullptr);
+    }
+}
+
+/**
+ * @brief Vector reserve test.
+ *
+ *        Verify that reserved memory is used by subsequent pushes and resizes.
+ */
+TEST(Container_Vector, Reserve)
+{
+    Vector<int> vector{};
+
+    // Case 1 - Reserve memory, expect the size to be unchanged.
+    {
+        EXPECT_TRUE(vector.reserve(10U));
+        EXPECT_EQ(vector.capacity(), 10U);
+        EXPECT_TRUE(vector.empty());
+    }
+
+    // Case 2 - Push values within the capacity, expect no reallocation.
+    {
+        const auto* data{vector.data()};
+
+        for (int i{}; i < 10; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        EXPECT_EQ(vector.data(), data);
+        EXPECT_EQ(vector.capacity(), 10U);
+    }
+
+    // Case 3 - Reserve less memory than available, expect nothing to happen.
+    {
+        EXPECT_TRUE(vector.reserve(5U));
+        EXPECT_EQ(vector.capacity(), 10U);
+        EXPECT_EQ(vector.size(), 10U);
+    }
+
+    // Case 4 - Resize the vector, expect the capacity to only grow when needed.
+    {
+        EXPECT_TRUE(vector.resize(3U));
+        EXPECT_EQ(vector.capacity(), 10U);
+        EXPECT_TRUE(vector.resize(12U));
+        EXPECT_EQ(vector.size(), 12U);
+        EXPECT_EQ(vector.capacity(), 12U);
+        EXPECT_EQ(vector[2U], 2);
+    }
+
+    // Case 5 - Copy and move the vector, expect the capacity to follow.
+    {
+        Vector<int> copy{vector};
+        EXPECT_EQ(copy.size(), 12U);
+        EXPECT_EQ(copy.capacity(), 12U);
+
+        Vector<int> moved{static_cast<Vector<int>&&>(copy)};
+        EXPECT_EQ(moved.capacity(), 12U);
+        EXPECT_EQ(copy.capacity(), 0U);
+        EXPECT_TRUE(copy.empty());
+    }
+
+    // Case 6 - Clear the vector, expect the memory to be released.
+    {
+        vector.clear();
+        EXPECT_TRUE(vector.empty());
+        EXPECT_EQ(vector.capacity(), 0U);
+    }
+}
+
+/**
+ * @brief Vector element handling test.
+ *
+ *        Verify that elements are constructed in place, moved when the vector grows and 
+ *        destroyed when removed.
+ */
+TEST(Container_Vector, ElementHandling)
+{
+    static_assert(type_traits::is_trivially_copyable<int>::value, 
+                  "Integers must be trivially copyable!");
+    static_assert(!type_traits::is_trivially_copyable<Tracked>::value, 
+                  "Tracked must not be trivially copyable!");
+    static_assert(!type_traits::is_trivially_copyable<Vector<int>>::value, 
+                  "Vectors must not be trivially copyable!");
+    Tracked::resetCounters();
+    {
+        Vector<Tracked> vector{};
+
+        // Case 1 - Construct elements in place, expect no copies or moves.
+        {
+            EXPECT_TRUE(vector.reserve(2U));
+            EXPECT_TRUE(vector.emplaceBack(1));
+            EXPECT_TRUE(vector.emplaceBack(2));
+            EXPECT_EQ(Tracked::liveCount, 2);
+            EXPECT_EQ(Tracked::copyCount, 0);
+            EXPECT_EQ(Tracked::moveCount, 0);
+        }
+
+        // Case 2 - Grow the vector, expect the elements to be moved rather than copied.
+        {
+            for (int i{3}; i <= 100; ++i) { EXPECT_TRUE(vector.emplaceBack(i)); }
+            EXPECT_EQ(Tracked::liveCount, 100);
+            EXPECT_EQ(Tracked::copyCount, 0);
+            EXPECT_GT(Tracked::moveCount, 0);
+
+            for (std::size_t i{}; i < vector.size(); ++i) 
+            { 
+                EXPECT_EQ(vector[i].myValue, static_cast<int>(i + 1U)); 
+            }
+        }
+
+        // Case 3 - Push an element of the full vector, expect a valid copy.
+        {
+            EXPECT_TRUE(vector.shrinkToFit());
+            EXPECT_EQ(vector.capacity(), vector.size());
+            Tracked::resetCounters();
+            EXPECT_TRUE(vector.pushBack(vector[0U]));
+            EXPECT_EQ(vector.last()->myValue, 1);
+            EXPECT_EQ(Tracked::copyCount, 1);
+            EXPECT_EQ(Tracked::moveCount, 100);
+        }
+
+        // Case 4 - Push lvalues and rvalues, expect them to be copied and moved respectively.
+        {
+            Tracked value{200};
+            Tracked::resetCounters();
+            EXPECT_TRUE(vector.pushBack(value));
+            EXPECT_TRUE(vector.pushBack(Tracked{201}));
+            EXPECT_EQ(Tracked::copyCount, 1);
+            EXPECT_EQ(Tracked::moveCount, 1);
+            EXPECT_EQ(vector.last()->myValue, 201);
+        }
+
+        // Case 5 - Pop and resize the vector, expect removed elements to be destroyed.
+        {
+            Tracked::resetCounters();
+            EXPECT_TRUE(vector.popBack());
+            EXPECT_EQ(Tracked::liveCount, -1);
+            EXPECT_TRUE(vector.resize(10U));
+            EXPECT_EQ(Tracked::liveCount, -int(103U - 10U));
+        }
+    }
+
+    // Case 6 - Delete the vector, expect all elements to be destroyed.
+    EXPECT_EQ(Tracked::liveCount, -int(103U - 10U) - 10);
+}
+
+/**
+ * @brief Nested vector test.
+ *
+ *        Verify that vectors of vectors grow without deep copies.
+ */
+TEST(Container_Vector, Nested)
+{
+    Vector<Vector<int>> vectors{};
+    Vector<const int*> data{};
+
+    // Add vectors and store the address of their data.
+    for (int i{}; i < 20; ++i)
+    {
+        Vector<int> vector{};
+        EXPECT_TRUE(vector.pushBack(i));
+        data.pushBack(vector.data());
+        EXPECT_TRUE(vectors.pushBack(static_cast<Vector<int>&&>(vector)));
+        EXPECT_TRUE(vector.empty());
+    }
+
+    // Expect the data to have been moved along with the vectors, not copied.
+    for (std::size_t i{}; i < vectors.size(); ++i)
+    {
+        EXPECT_EQ(vectors[i].data(), data[i]);
+        EXPECT_EQ(vectors[i][0U], static_cast<int>(i));
+    }
+
+    // Copy the vectors, expect deep copies.
+    const Vector<Vector<int>> copy{vectors};
+    EXPECT_EQ(copy.size(), vectors.size());
+
+    for (std::size_t i{}; i < copy.size(); ++i)
+    {
+        EXPECT_NE(copy[i].data(), vectors[i].data());
+        EXPECT_EQ(copy[i][0U], vectors[i][0U]);
+    }
+}
+
+/**
+ * @brief Vector push allocation count.
+ *
+ *        Push 1k - 1M values to a vector with geometric growth, and compare with reallocating
+ *        on every push. Expect one allocation per push in the latter case, but only one per
+ *        doubling of the capacity with geometric growth, i.e. O(log n) reallocations.
+ */
+TEST(Container_Vector, PushAllocations)
+{
+    constexpr std::size_t counts[]{1000U, 10000U, 100000U, 1000000U};
+
+    for (const auto& count : counts)
+    {
+        // The capacity grows 1, 2, 4, ..., up to the first power of two holding all values.
+        std::uint32_t expected{1U};
+        for (std::size_t capacity{1U}; capacity < count; capacity *= 2U) { ++expected; }
+
+        EXPECT_EQ(countPushAllocations(count, false), expected);
+        EXPECT_EQ(countPushAllocations(count, true), count);
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
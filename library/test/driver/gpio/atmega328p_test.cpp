@@ -8,12 +8,19 @@
 
 #include "arch/avr/hw_platform.h"
 #include "driver/gpio/atmega328p.h"
+#include "utils/delegate.h"
 #include "utils/utils.h"
 
 #ifdef TESTSUITE
 
 namespace driver
 {
+namespace gpio
+{
+/** Pin change interrupt service routine of I/O port B, defined via ISR() in the GPIO driver. */
+void PCINT0_vect() noexcept;
+} // namespace gpio
+
 namespace
 {
 /**
@@ -237,6 +244,86 @@ TEST(Gpio_Atmega328p, Input)
         runInputTest(pin, regs);
     }
 }
+
+/**
+ * @brief Counter of pin change events.
+ */
+struct EventCounter
+{
+    /** The number of events. */
+    int count;
+
+    /**
+     * @brief Count an event.
+     */
+    void handleEvent() noexcept { count++; }
+};
+
+/**
+ * @brief GPIO pin change dispatch test.
+ * 
+ *        Verify that several GPIOs on the same I/O port can subscribe to pin change interrupts,
+ *        and that only the subscribers of the changed pins are notified.
+ */
+TEST(Gpio_Atmega328p, PinChangeDispatch)
+{
+    using Callback = utils::Delegate<void()>;
+    constexpr std::uint8_t firstPin{PinOffset::B};
+    constexpr std::uint8_t secondPin{PinOffset::B + 5U};
+    EventCounter first{0};
+    EventCounter second{0};
+    PINB = 0U;
+
+    gpio::Atmega328p firstButton{firstPin, gpio::Direction::InputPullup, 
+                                 Callback::bind<&EventCounter::handleEvent>(first)};
+    gpio::Atmega328p secondButton{secondPin, gpio::Direction::InputPullup,
+                                  Callback::bind<&EventCounter::handleEvent>(second)};
+    firstButton.enableInterrupt(true);
+    secondButton.enableInterrupt(true);
+
+    // Case 1 - Change the first pin, expect only the first subscriber to be notified.
+    {
+        utils::set(PINB, getPhysicalPin(firstPin));
+        gpio::PCINT0_vect();
+        EXPECT_EQ(first.count, 1);
+        EXPECT_EQ(second.count, 0);
+    }
+
+    // Case 2 - Change both pins, expect both subscribers to be notified once.
+    {
+        utils::clear(PINB, getPhysicalPin(firstPin));
+        utils::set(PINB, getPhysicalPin(secondPin));
+        gpio::PCINT0_vect();
+        EXPECT_EQ(first.count, 2);
+        EXPECT_EQ(second.count, 1);
+    }
+
+    // Case 3 - Trigger an interrupt without any pin change, expect no notifications.
+    {
+        gpio::PCINT0_vect();
+        EXPECT_EQ(first.count, 2);
+        EXPECT_EQ(second.count, 1);
+    }
+
+    // Case 4 - Disable the interrupt of the second pin, expect its changes to be ignored.
+    {
+        secondButton.enableInterrupt(false);
+        utils::clear(PINB, getPhysicalPin(secondPin));
+        utils::set(PINB, getPhysicalPin(firstPin));
+        gpio::PCINT0_vect();
+        EXPECT_EQ(first.count, 3);
+        EXPECT_EQ(second.count, 1);
+    }
+
+    // Case 5 - Remove the callback of the first pin, expect it to no longer be notified.
+    {
+        firstButton.setCallback(nullptr);
+        utils::clear(PINB, getPhysicalPin(firstPin));
+        gpio::PCINT0_vect();
+        EXPECT_EQ(first.count, 3);
+    }
+    PINB = 0U;
+}
 } // namespace
 } // namespace driver
 
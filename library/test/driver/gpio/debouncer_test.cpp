@@ -0,0 +1,203 @@
+/**
+ * @brief Unit tests for the sampling debounce engine.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/debouncer.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace gpio
+{
+namespace
+{
+/** Alias for the pin numbers. */
+using Port = Atmega328p::Port;
+
+/** Active-low buttons on I/O port B, in the same order as in main.cpp. */
+using Buttons = Debouncer<Port::B0, Port::B5>;
+
+/**
+ * @brief Recorder of button events.
+ */
+struct Recorder
+{
+    /** The number of events recorded per button and event. */
+    std::uint8_t counts[2U][static_cast<std::uint8_t>(ButtonEvent::Count)];
+
+    /**
+     * @brief Record a button event.
+     *
+     * @param[in] button The index of the button.
+     * @param[in] event The button event.
+     */
+    void record(const std::uint8_t button, const ButtonEvent event) noexcept
+    {
+        counts[button][static_cast<std::uint8_t>(event)]++;
+    }
+
+    /**
+     * @brief Get the number of recorded events.
+     *
+     * @param[in] button The index of the button.
+     * @param[in] event The button event.
+     *
+     * @return The number of events recorded for the button.
+     */
+    std::uint8_t count(const std::uint8_t button, const ButtonEvent event) const noexcept
+    {
+        return counts[button][static_cast<std::uint8_t>(event)];
+    }
+};
+
+// -----------------------------------------------------------------------------
+void tick(Buttons& buttons, const std::uint16_t tickCount) noexcept
+{
+    for (std::uint16_t i{}; i < tickCount; ++i) { buttons.tick(); }
+}
+
+/**
+ * @brief Debounce test.
+ *
+ *        Verify that a button changes state after four equal samples, that bounces are
+ *        filtered out, and that the samples are taken once per sample period.
+ */
+TEST(Gpio_Debouncer, Debounce)
+{
+    // Release both buttons, i.e. the pins read high via the pull-up resistors.
+    PINB = 0xFFU;
+    Recorder recorder{};
+    Buttons buttons{Buttons::Handler::bind<&Recorder::record>(recorder), 2U};
+    EXPECT_EQ(buttons.state(), 0U);
+
+    // Case 1 - Verify that a short glitch doesn't change the state.
+    {
+        PINB = 0xFEU;
+        tick(buttons, 6U);
+        PINB = 0xFFU;
+        tick(buttons, 2U);
+        PINB = 0xFEU;
+        tick(buttons, 6U);
+        EXPECT_FALSE(buttons.isPressed(0U));
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 0U);
+    }
+
+    // Case 2 - Verify that the press is reported on the fourth equal sample, i.e. tick 8.
+    {
+        PINB = 0xFEU;
+        tick(buttons, 1U);
+        EXPECT_FALSE(buttons.isPressed(0U));
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 0U);
+        tick(buttons, 1U);
+        EXPECT_TRUE(buttons.isPressed(0U));
+        EXPECT_FALSE(buttons.isPressed(1U));
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 1U);
+    }
+
+    // Case 3 - Verify that the release is reported once, despite bounces.
+    {
+        PINB = 0xFFU;
+        tick(buttons, 4U);
+        PINB = 0xFEU;
+        tick(buttons, 2U);
+        PINB = 0xFFU;
+        tick(buttons, 20U);
+        EXPECT_FALSE(buttons.isPressed(0U));
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 1U);
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Released), 1U);
+    }
+
+    // Case 4 - Verify that invalid buttons are never pressed.
+    EXPECT_FALSE(buttons.isPressed(Buttons::ButtonCount));
+}
+
+/**
+ * @brief Parallel debounce test.
+ *
+ *        Verify that the buttons are debounced independently, i.e. a button bouncing doesn't
+ *        delay or hide the events of another button.
+ */
+TEST(Gpio_Debouncer, Parallel)
+{
+    PINB = 0xFFU;
+    Recorder recorder{};
+    Buttons buttons{Buttons::Handler::bind<&Recorder::record>(recorder)};
+
+    // Press button 1 while button 0 bounces on every sample.
+    PINB = 0xDFU;
+
+    for (std::uint8_t i{}; i < 8U; ++i)
+    {
+        PINB ^= 0x01U;
+        buttons.tick();
+    }
+    EXPECT_EQ(buttons.state(), 0x02U);
+    EXPECT_EQ(recorder.count(1U, ButtonEvent::Pressed), 1U);
+    EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 0U);
+
+    // Press button 0 as well, then release both at once.
+    PINB = 0xDEU;
+    tick(buttons, 4U);
+    EXPECT_EQ(buttons.state(), 0x03U);
+    PINB = 0xFFU;
+    tick(buttons, 4U);
+    EXPECT_EQ(buttons.state(), 0U);
+    EXPECT_EQ(recorder.count(0U, ButtonEvent::Released), 1U);
+    EXPECT_EQ(recorder.count(1U, ButtonEvent::Released), 1U);
+}
+
+/**
+ * @brief Long press test.
+ *
+ *        Verify that a single long-press event is reported per press once a button has been
+ *        held down for the long-press duration.
+ */
+TEST(Gpio_Debouncer, LongPress)
+{
+    PINB = 0xFFU;
+    Recorder recorder{};
+    Buttons buttons{Buttons::Handler::bind<&Recorder::record>(recorder), 1U, 10U};
+
+    // Case 1 - Verify that a short press doesn't cause a long-press event.
+    {
+        PINB = 0xDFU;
+        tick(buttons, 8U);
+        PINB = 0xFFU;
+        tick(buttons, 4U);
+        EXPECT_EQ(recorder.count(1U, ButtonEvent::Pressed), 1U);
+        EXPECT_EQ(recorder.count(1U, ButtonEvent::LongPressed), 0U);
+    }
+
+    // Case 2 - Verify that the long-press event is reported once, on the 10th sample pressed.
+    {
+        PINB = 0xDFU;
+        tick(buttons, 12U);
+        EXPECT_EQ(recorder.count(1U, ButtonEvent::LongPressed), 0U);
+        tick(buttons, 1U);
+        EXPECT_EQ(recorder.count(1U, ButtonEvent::LongPressed), 1U);
+        tick(buttons, 100U);
+        EXPECT_EQ(recorder.count(1U, ButtonEvent::LongPressed), 1U);
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::LongPressed), 0U);
+    }
+
+    // Case 3 - Verify that active-high buttons are supported as well.
+    {
+        PINB = 0x00U;
+        Buttons activeHigh{Buttons::Handler::bind<&Recorder::record>(recorder), 1U, 0U, false};
+        PINB = 0x01U;
+        tick(activeHigh, 4U);
+        EXPECT_TRUE(activeHigh.isPressed(0U));
+        EXPECT_EQ(recorder.count(0U, ButtonEvent::Pressed), 1U);
+    }
+}
+} // namespace
+} // namespace gpio
+} // namespace driver
+
+#endif /** TESTSUITE */
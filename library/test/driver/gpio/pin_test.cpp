@@ -0,0 +1,143 @@
+/**
+ * @brief Unit tests for compile-time GPIO pins.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/pin.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace gpio
+{
+namespace
+{
+/** Alias for the pin numbers. */
+using Port = Atmega328p::Port;
+
+// -----------------------------------------------------------------------------
+void resetRegisters() noexcept
+{
+    DDRB = DDRC = DDRD = 0U;
+    PORTB = PORTC = PORTD = 0U;
+    PINB = PINC = PIND = 0U;
+    PCMSK0 = PCMSK1 = PCMSK2 = 0U;
+    PCICR = 0U;
+}
+
+/**
+ * @brief Compile-time pin test.
+ *
+ *        Verify that the pin is configured, written, toggled and read via its own registers
+ *        only, and that it holds no data.
+ */
+TEST(Gpio_Pin, Operation)
+{
+    static_assert(sizeof(Pin<Port::B1, Direction::Output>) == 1U, "Unexpected pin size!");
+    static_assert(Atmega328p::IoPort::B == Pin<Port::B1, Direction::Output>::IoPort, 
+                  "Unexpected I/O port!");
+    static_assert(0x02U == Pin<Port::B1, Direction::Output>::Mask, "Unexpected pin mask!");
+    resetRegisters();
+
+    // Case 1 - Verify that outputs are set, cleared and toggled.
+    {
+        Pin<Port::B1, Direction::Output> led{};
+        EXPECT_EQ(DDRB, 0x02U);
+
+        led.write(true);
+        EXPECT_EQ(PORTB, 0x02U);
+        led.clear();
+        EXPECT_EQ(PORTB, 0U);
+        led.set();
+        EXPECT_EQ(PORTB, 0x02U);
+        led.toggle();
+        EXPECT_EQ(PINB, 0x02U);
+    }
+    EXPECT_EQ(DDRB, 0U);
+    EXPECT_EQ(PORTB, 0U);
+
+    // Case 2 - Verify that inputs are read and writes to inputs are ignored.
+    {
+        Pin<Port::C4, Direction::InputPullup> button{};
+        EXPECT_EQ(DDRC, 0U);
+        EXPECT_EQ(PORTC, 0x10U);
+        EXPECT_FALSE(button.read());
+        PINC = 0x10U;
+        EXPECT_TRUE(button.read());
+        button.clear();
+        EXPECT_EQ(PORTC, 0x10U);
+
+        button.enableInterrupt(true);
+        EXPECT_EQ(PCMSK1, 0x10U);
+        button.enableInterrupt(false);
+        EXPECT_EQ(PCMSK1, 0U);
+    }
+    EXPECT_EQ(PORTC, 0U);
+
+    // Case 3 - Verify that the pin is usable through the GPIO interface.
+    {
+        PinAdapter<Port::D6, Direction::Output> adapter{};
+        Interface& gpio{adapter};
+        EXPECT_TRUE(gpio.isInitialized());
+        EXPECT_EQ(gpio.direction(), Direction::Output);
+        gpio.write(true);
+        EXPECT_EQ(PORTD, 0x40U);
+        EXPECT_EQ(DDRD, 0x40U);
+    }
+    EXPECT_EQ(DDRD, 0U);
+    resetRegisters();
+}
+
+/**
+ * @brief Compile-time pin register accesses.
+ *
+ *        Write a pin via the compile-time pin and via the adapter, called through the GPIO
+ *        interface. Expect each write to take a single read-modify-write of PORTD, like the
+ *        SBI/CBI instruction it compiles to on the target, with no other register accessed.
+ */
+TEST(Gpio_Pin, RegisterAccesses)
+{
+    constexpr std::uint32_t iterationCount{1000U};
+    resetRegisters();
+
+    // Write the outputs via the interface, so that the calls can't be devirtualized.
+    const auto expectSingleAccess{[](Interface& gpio, const std::uint8_t mask)
+    {
+        for (std::uint32_t i{}; i < iterationCount; ++i)
+        {
+            test::Memory::resetAccessCounts();
+            gpio.write(i & 1U);
+            EXPECT_EQ(PORTD & mask, (i & 1U) ? mask : 0U);
+            EXPECT_EQ(test::Memory::reads(PORTD), 1U);
+            EXPECT_EQ(test::Memory::writes(PORTD), 1U);
+            EXPECT_EQ(test::Memory::writes(DDRD), 0U);
+            EXPECT_EQ(test::Memory::reads(PIND), 0U);
+        }
+    }};
+
+    PinAdapter<Port::D3, Direction::Output> adapter{};
+    expectSingleAccess(adapter, 1U << 3U);
+
+    Pin<Port::D4, Direction::Output> pin{};
+    for (std::uint32_t i{}; i < iterationCount; ++i)
+    {
+        test::Memory::resetAccessCounts();
+        pin.write(i & 1U);
+        EXPECT_EQ(PORTD & 0x10U, (i & 1U) ? 0x10U : 0U);
+        EXPECT_EQ(test::Memory::reads(PORTD), 1U);
+        EXPECT_EQ(test::Memory::writes(PORTD), 1U);
+    }
+    EXPECT_EQ(PORTD, 0x08U | 0x10U);
+    test::Memory::resetAccessCounts();
+    resetRegisters();
+}
+} // namespace
+} // namespace gpio
+} // namespace driver
+
+#endif /** TESTSUITE */
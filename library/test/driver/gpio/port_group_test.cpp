@@ -0,0 +1,189 @@
+/**
+ * @brief Unit tests for GPIO port groups.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/gpio/port_group.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace gpio
+{
+namespace
+{
+/** Alias for the pin numbers. */
+using Port = Atmega328p::Port;
+
+/** Contiguous output group covering I/O port D. */
+using OutputBus = PortGroup<Direction::Output, Port::D0, Port::D1, Port::D2, Port::D3, 
+                            Port::D4, Port::D5, Port::D6, Port::D7>;
+
+/** Scattered output group on I/O port B, in descending pin order. */
+using ScatteredOutputs = PortGroup<Direction::Output, Port::B5, Port::B3, Port::B0>;
+
+/** Input group on I/O port C with internal pull-up resistors enabled. */
+using Inputs = PortGroup<Direction::InputPullup, Port::C1, Port::C2>;
+
+// -----------------------------------------------------------------------------
+void resetRegisters() noexcept
+{
+    DDRB = DDRC = DDRD = 0U;
+    PORTB = PORTC = PORTD = 0U;
+    PINB = PINC = PIND = 0U;
+}
+
+/**
+ * @brief Port group pin map test.
+ *
+ *        Verify that the pin maps are resolved at compile time.
+ */
+TEST(Gpio_PortGroup, PinMap)
+{
+    static_assert(Atmega328p::IoPort::D == OutputBus::IoPort, "Unexpected I/O port!");
+    static_assert(0xFFU == OutputBus::PortMask, "Unexpected port mask!");
+    static_assert(0x5AU == OutputBus::scatter(0x5AU), "Unexpected scatter!");
+
+    static_assert(Atmega328p::IoPort::B == ScatteredOutputs::IoPort, "Unexpected I/O port!");
+    static_assert(0x29U == ScatteredOutputs::PortMask, "Unexpected port mask!");
+    static_assert(0x20U == ScatteredOutputs::scatter(0x01U), "Unexpected scatter!");
+    static_assert(0x09U == ScatteredOutputs::scatter(0x06U), "Unexpected scatter!");
+    static_assert(0x05U == ScatteredOutputs::gather(0x21U), "Unexpected gather!");
+
+    static_assert(Atmega328p::IoPort::C == Inputs::IoPort, "Unexpected I/O port!");
+    static_assert(0x06U == Inputs::PortMask, "Unexpected port mask!");
+    static_assert(0x01U == Inputs::gather(0xFBU), "Unexpected gather!");
+    EXPECT_EQ(PinMap<Port::C5>::Pin, 5U);
+}
+
+/**
+ * @brief Port group output test.
+ *
+ *        Verify that the outputs of a group are written, set, cleared and toggled together
+ *        without affecting the other pins of the port.
+ */
+TEST(Gpio_PortGroup, Output)
+{
+    resetRegisters();
+
+    // Case 1 - Verify that a contiguous group writes the whole port at once.
+    {
+        OutputBus bus{};
+        PortGroupInterface& group{bus};
+        EXPECT_EQ(DDRD, 0xFFU);
+        EXPECT_EQ(group.pinCount(), 8U);
+
+        group.write(0xA5U);
+        EXPECT_EQ(PORTD, 0xA5U);
+        group.clear(0x0FU);
+        EXPECT_EQ(PORTD, 0xA0U);
+        group.set(0x03U);
+        EXPECT_EQ(PORTD, 0xA3U);
+
+        // Expect the toggled pins to be written to the pin register.
+        group.toggle(0x81U);
+        EXPECT_EQ(PIND, 0x81U);
+    }
+    EXPECT_EQ(DDRD, 0U);
+    EXPECT_EQ(PORTD, 0U);
+
+    // Case 2 - Verify that a scattered group leaves the other pins of the port untouched.
+    {
+        DDRB  = 0x02U;
+        PORTB = 0x02U;
+        ScatteredOutputs outputs{};
+        EXPECT_EQ(DDRB, 0x2BU);
+
+        outputs.write(0x05U);
+        EXPECT_EQ(PORTB, 0x23U);
+        outputs.write(0x02U);
+        EXPECT_EQ(PORTB, 0x0AU);
+        outputs.clear(0x07U);
+        EXPECT_EQ(PORTB, 0x02U);
+        outputs.toggle(0x04U);
+        EXPECT_EQ(PINB, 0x01U);
+    }
+    EXPECT_EQ(DDRB, 0x02U);
+    EXPECT_EQ(PORTB, 0x02U);
+    resetRegisters();
+}
+
+/**
+ * @brief Port group input test.
+ *
+ *        Verify that the inputs of a group are configured and read together.
+ */
+TEST(Gpio_PortGroup, Input)
+{
+    resetRegisters();
+    {
+        Inputs inputs{};
+        EXPECT_EQ(DDRC, 0U);
+        EXPECT_EQ(PORTC, 0x06U);
+
+        PINC = 0x04U;
+        EXPECT_EQ(inputs.read(), 0x02U);
+        PINC = 0x3FU;
+        EXPECT_EQ(inputs.read(), 0x03U);
+
+        // Expect writes to be ignored for inputs.
+        inputs.write(0U);
+        EXPECT_EQ(PORTC, 0x06U);
+    }
+    EXPECT_EQ(PORTC, 0U);
+    resetRegisters();
+}
+
+/**
+ * @brief Port group register accesses.
+ *
+ *        Write bytes to eight pins via a port group, and compare with writing the pins one by
+ *        one via GPIO drivers, which takes a read-modify-write of PORTD per pin. Expect the
+ *        same output, with a single read-modify-write of PORTD per byte written via the group.
+ */
+TEST(Gpio_PortGroup, RegisterAccesses)
+{
+    constexpr std::uint32_t iterationCount{1000U};
+    resetRegisters();
+
+    Atmega328p gpio0{Port::D0, Direction::Output}, gpio1{Port::D1, Direction::Output};
+    Atmega328p gpio2{Port::D2, Direction::Output}, gpio3{Port::D3, Direction::Output};
+    Atmega328p gpio4{Port::D4, Direction::Output}, gpio5{Port::D5, Direction::Output};
+    Atmega328p gpio6{Port::D6, Direction::Output}, gpio7{Port::D7, Direction::Output};
+    Interface* pins[]{&gpio0, &gpio1, &gpio2, &gpio3, &gpio4, &gpio5, &gpio6, &gpio7};
+    {
+        OutputBus bus{};
+        PortGroupInterface& group{bus};
+
+        for (std::uint32_t i{}; i < iterationCount; ++i)
+        {
+            for (std::uint8_t pin{}; pin < 8U; ++pin) { pins[pin]->write((i >> pin) & 1U); }
+            const std::uint8_t driverResult{PORTD};
+            PORTD = 0U;
+
+            test::Memory::resetAccessCounts();
+            group.write(static_cast<std::uint8_t>(i));
+
+            // Expect the same output, written with a single load and store of PORTD.
+            EXPECT_EQ(PORTD, driverResult);
+            EXPECT_EQ(test::Memory::reads(PORTD), 1U);
+            EXPECT_EQ(test::Memory::writes(PORTD), 1U);
+
+            // Expect no other I/O register to be accessed.
+            EXPECT_EQ(test::Memory::writes(DDRD), 0U);
+            EXPECT_EQ(test::Memory::writes(PIND), 0U);
+        }
+    }
+    test::Memory::resetAccessCounts();
+    resetRegisters();
+}
+} // namespace
+} // namespace gpio
+} // namespace driver
+
+#endif /** TESTSUITE */
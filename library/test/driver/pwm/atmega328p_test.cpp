@@ -0,0 +1,178 @@
+/**
+ * @brief Unit tests for the ATmega328p hardware PWM driver.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/pwm/atmega328p.h"
+#include "driver/timer/atmega328p.h"
+#include "driver/timer/circuit.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace pwm
+{
+namespace
+{
+/** Alias for the PWM modes. */
+using Mode = Atmega328p::Mode;
+
+// -----------------------------------------------------------------------------
+void resetRegisters() noexcept
+{
+    TCCR0A = TCCR0B = OCR0A = OCR0B = 0U;
+    TCCR1A = TCCR1B = 0U;
+    OCR1A = OCR1B = ICR1 = 0U;
+    TCCR2A = TCCR2B = OCR2A = OCR2B = 0U;
+    DDRB = DDRD = PORTB = PORTD = 0U;
+}
+
+/**
+ * @brief PWM initialization test.
+ *
+ *        Verify that only pins connected to output compare units can be used, once at a time,
+ *        and that the outputs of a timer must share its mode.
+ */
+TEST(Pwm_Atmega328p, Initialization)
+{
+    resetRegisters();
+
+    // Case 1 - Verify that only the six output compare pins are supported.
+    for (std::uint8_t pin{}; pin < 20U; ++pin)
+    {
+        Atmega328p pwm{pin};
+        const bool supported{(3U == pin) || (5U == pin) || (6U == pin) || 
+                             (9U == pin) || (10U == pin) || (11U == pin)};
+        EXPECT_EQ(pwm.isInitialized(), supported);
+    }
+
+    // Case 2 - Verify that each output and each timer mode is reserved once at a time.
+    {
+        Atmega328p first{6U, 1000U, Mode::Fast};
+        Atmega328p duplicate{6U};
+        Atmega328p otherMode{5U, 1000U, Mode::PhaseCorrect};
+        Atmega328p sameMode{5U, 1000U, Mode::Fast};
+        EXPECT_TRUE(first.isInitialized());
+        EXPECT_FALSE(duplicate.isInitialized());
+        EXPECT_FALSE(otherMode.isInitialized());
+        EXPECT_TRUE(sameMode.isInitialized());
+        EXPECT_TRUE(timer::isCircuitReserved(timer::Circuit::Timer0));
+
+        // Expect an invalid frequency and an invalid mode to be rejected.
+        EXPECT_FALSE(Atmega328p(9U, 0U).isInitialized());
+        EXPECT_FALSE(Atmega328p(9U, 1000U, Mode::Count).isInitialized());
+    }
+    EXPECT_FALSE(timer::isCircuitReserved(timer::Circuit::Timer0));
+    EXPECT_EQ(TCCR0A | TCCR0B, 0U);
+}
+
+/**
+ * @brief PWM resource arbitration test.
+ *
+ *        Verify that the timer circuits are shared between the timer driver and the PWM driver.
+ */
+TEST(Pwm_Atmega328p, Arbitration)
+{
+    resetRegisters();
+
+    // Case 1 - Verify that PWM is unavailable while the timer driver uses all circuits.
+    {
+        timer::Atmega328p timer0{100U}, timer1{100U}, timer2{100U};
+        EXPECT_FALSE(Atmega328p(6U).isInitialized());
+        EXPECT_FALSE(Atmega328p(9U).isInitialized());
+        EXPECT_FALSE(Atmega328p(11U).isInitialized());
+    }
+
+    // Case 2 - Verify that the timer driver skips circuits used for PWM.
+    {
+        Atmega328p pwm{9U};
+        ASSERT_TRUE(pwm.isInitialized());
+        timer::Atmega328p timer0{100U}, timer2{100U}, unavailable{100U};
+        EXPECT_TRUE(timer0.isInitialized());
+        EXPECT_TRUE(timer2.isInitialized());
+        EXPECT_FALSE(unavailable.isInitialized());
+    }
+    for (std::uint8_t i{}; i < static_cast<std::uint8_t>(timer::Circuit::Count); ++i)
+    {
+        EXPECT_FALSE(timer::isCircuitReserved(static_cast<timer::Circuit>(i)));
+    }
+}
+
+/**
+ * @brief PWM output test.
+ *
+ *        Verify that the timers are configured for the given mode, frequency and duty cycle.
+ */
+TEST(Pwm_Atmega328p, Output)
+{
+    resetRegisters();
+
+    // Case 1 - Verify fast PWM on Timer 0, the frequency is selected by prescaler (64).
+    {
+        Atmega328p pwm{6U, 1000U};
+        EXPECT_EQ(pwm.frequency_hz(), 977U);
+        EXPECT_EQ(TCCR0A, (1U << WGM01) | (1U << WGM00));
+        EXPECT_EQ(TCCR0B, 3U);
+        EXPECT_EQ(DDRD, 1U << 6U);
+
+        // Expect the pin to be connected once enabled with a duty cycle above 0.
+        pwm.setDutyCycle(128U);
+        EXPECT_FALSE(TCCR0A & (1U << COM0A1));
+        pwm.setEnabled(true);
+        EXPECT_EQ(OCR0A, 128U);
+        EXPECT_TRUE(TCCR0A & (1U << COM0A1));
+        pwm.setDutyCycle(0U);
+        EXPECT_FALSE(TCCR0A & (1U << COM0A1));
+    }
+    EXPECT_EQ(DDRD, 0U);
+
+    // Case 2 - Verify phase correct PWM on Timer 2.
+    {
+        Atmega328p pwm{3U, 30U, Mode::PhaseCorrect};
+        EXPECT_EQ(pwm.frequency_hz(), 31U);
+        EXPECT_EQ(TCCR2A, 1U << WGM20);
+        EXPECT_EQ(TCCR2B, 7U);
+        pwm.setEnabled(true);
+        pwm.setDutyCycle(255U);
+        EXPECT_EQ(OCR2B, 255U);
+        EXPECT_TRUE(TCCR2A & (1U << COM2B1));
+    }
+
+    // Case 3 - Verify that Timer 1 generates any frequency, here 50 Hz for servo control.
+    {
+        Atmega328p servo{9U, 50U};
+        Atmega328p other{10U, 50U};
+        EXPECT_EQ(servo.frequency_hz(), 50U);
+        EXPECT_EQ(ICR1, 39999U);
+        EXPECT_EQ(TCCR1A, 1U << WGM11);
+        EXPECT_EQ(TCCR1B, (1U << WGM13) | (1U << WGM12) | 2U);
+        servo.setEnabled(true);
+        other.setEnabled(true);
+        servo.setDutyCycle(255U);
+        other.setDutyCycle(51U);
+        EXPECT_EQ(OCR1A, 39999U);
+        EXPECT_EQ(OCR1B, 7999U);
+
+        // Expect both outputs to follow when the frequency is changed.
+        EXPECT_TRUE(servo.setFrequency_hz(20000U));
+        EXPECT_EQ(other.frequency_hz(), 20000U);
+        EXPECT_EQ(ICR1, 799U);
+        EXPECT_EQ(OCR1A, 799U);
+        EXPECT_EQ(OCR1B, 159U);
+
+        // Expect frequencies requiring less than 8-bit resolution to be rejected.
+        EXPECT_FALSE(servo.setFrequency_hz(100000U));
+        EXPECT_EQ(servo.frequency_hz(), 20000U);
+    }
+    EXPECT_EQ(ICR1, 0U);
+    EXPECT_EQ(TCCR1A | TCCR1B, 0U);
+}
+} // namespace
+} // namespace pwm
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,150 @@
+/**
+ * @brief Unit tests for the software PWM engine.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/gpio/atmega328p.h"
+#include "driver/pwm/software.h"
+#include "driver/timer/atmega328p.h"
+#include "utils/delegate.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace timer
+{
+/** Interrupt service routine of Timer 0, defined via ISR() in the timer driver. */
+void TIMER0_OVF_vect() noexcept;
+} // namespace timer
+
+namespace pwm
+{
+namespace
+{
+/** Alias for the pin numbers. */
+using Port = gpio::Atmega328p::Port;
+
+/** 
+ * Engine with channels on I/O ports B and D, two of them sharing a duty cycle. The period is 
+ * sized for at least 100 Hz at the 0.128 ms interrupt of the timer driver.
+ */
+using Engine = Software<78U, Port::D2, Port::B1, Port::D7, Port::B4, Port::D3>;
+
+static_assert(Engine::Period * 128U <= 10000U, "The PWM frequency must be at least 100 Hz!");
+
+// -----------------------------------------------------------------------------
+void resetRegisters() noexcept
+{
+    DDRB = DDRD = 0U;
+    PORTB = PORTD = 0U;
+}
+
+/**
+ * @brief Run a PWM period and count the ticks each channel is high.
+ *
+ * @param[in] tick Function advancing the engine one tick.
+ * @param[out] highCounts The number of ticks each channel is high.
+ */
+template <typename Tick>
+void runPeriod(Tick&& tick, std::uint32_t (&highCounts)[Engine::ChannelCount]) noexcept
+{
+    constexpr std::uint8_t portD{static_cast<std::uint8_t>(gpio::Atmega328p::IoPort::D)};
+    constexpr volatile std::uint8_t* ports[]{&PORTB, &PORTC, &PORTD};
+    constexpr std::uint8_t pins[]{2U, 1U, 7U, 4U, 3U};
+    constexpr std::uint8_t channelPorts[]{portD, 0U, portD, 0U, portD};
+
+    for (auto& count : highCounts) { count = 0U; }
+
+    for (std::uint8_t i{}; i < Engine::Period; ++i)
+    {
+        tick();
+        for (std::uint8_t channel{}; channel < Engine::ChannelCount; ++channel)
+        {
+            if (*ports[channelPorts[channel]] & (1U << pins[channel])) { highCounts[channel]++; }
+        }
+    }
+}
+
+/**
+ * @brief Software PWM duty cycle test.
+ *
+ *        Verify that each channel is high for as many ticks per period as its duty cycle, and
+ *        that new duty cycles take effect at the start of the next period.
+ */
+TEST(Pwm_Software, DutyCycle)
+{
+    resetRegisters();
+    {
+        Engine engine{};
+        std::uint32_t highCounts[Engine::ChannelCount]{};
+        const auto tick{[&engine]() { engine.tick(); }};
+        EXPECT_EQ(DDRD, 0x8CU);
+        EXPECT_EQ(DDRB, 0x12U);
+
+        // Case 1 - Verify that all channels are low by default.
+        runPeriod(tick, highCounts);
+        for (const auto count : highCounts) { EXPECT_EQ(count, 0U); }
+
+        // Case 2 - Verify that the duty cycles are respected, including the extremes.
+        constexpr std::uint8_t dutyCycles[]{1U, 40U, 78U, 40U, 77U};
+        for (std::uint8_t channel{}; channel < Engine::ChannelCount; ++channel)
+        {
+            EXPECT_TRUE(engine.setDutyCycle(channel, dutyCycles[channel]));
+            EXPECT_EQ(engine.dutyCycle(channel), dutyCycles[channel]);
+        }
+        EXPECT_FALSE(engine.setDutyCycle(Engine::ChannelCount, 1U));
+        EXPECT_EQ(engine.dutyCycle(Engine::ChannelCount), 0U);
+        EXPECT_FALSE(engine.setDutyCycle(0U, Engine::Period + 1U));
+        EXPECT_EQ(engine.dutyCycle(0U), 1U);
+
+        runPeriod(tick, highCounts);
+        for (std::uint8_t channel{}; channel < Engine::ChannelCount; ++channel)
+        {
+            EXPECT_EQ(highCounts[channel], dutyCycles[channel]);
+        }
+
+        // Case 3 - Verify that an update in the middle of a period takes effect at the next one.
+        for (std::uint8_t i{}; i < 10U; ++i) { engine.tick(); }
+        EXPECT_TRUE(engine.setDutyCycle(2U, 0U));
+        for (std::uint8_t i{10U}; i < Engine::Period; ++i) { engine.tick(); }
+        EXPECT_TRUE(PORTD & (1U << 7U));
+
+        runPeriod(tick, highCounts);
+        EXPECT_EQ(highCounts[2U], 0U);
+        EXPECT_EQ(highCounts[1U], 40U);
+    }
+    EXPECT_EQ(DDRB | DDRD | PORTB | PORTD, 0U);
+}
+
+/**
+ * @brief Software PWM timer test.
+ *
+ *        Verify that the engine can be driven by the interrupt of a hardware timer.
+ */
+TEST(Pwm_Software, TimerInterrupt)
+{
+    resetRegisters();
+    Engine engine{};
+    timer::Atmega328p timer{1U, {}, true};
+    ASSERT_TRUE(timer.isInitialized());
+    timer.setInterruptHandler(utils::Delegate<void()>::bind<&Engine::tick>(engine));
+
+    std::uint32_t highCounts[Engine::ChannelCount]{};
+    engine.setDutyCycle(0U, 50U);
+    runPeriod([]() { timer::TIMER0_OVF_vect(); }, highCounts);
+    EXPECT_EQ(highCounts[0U], 50U);
+
+    // Expect the engine not to be ticked once the timer is stopped.
+    timer.stop();
+    runPeriod([]() { timer::TIMER0_OVF_vect(); }, highCounts);
+    EXPECT_EQ(highCounts[0U], 0U);
+}
+} // namespace
+} // namespace pwm
+} // namespace driver
+
+#endif /** TESTSUITE */
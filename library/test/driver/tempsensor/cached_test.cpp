@@ -0,0 +1,171 @@
+/**
+ * @brief Unit tests for the caching temperature sensor decorator.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/tempsensor/cached.h"
+#include "driver/tempsensor/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** Max age of cached readings used in the tests, in clock ticks. */
+constexpr std::uint32_t MaxAge{100U};
+
+/** Simulated clock tick. */
+std::uint32_t myTick{};
+
+/**
+ * @brief Get the simulated clock tick.
+ *
+ * @return The current tick.
+ */
+std::uint32_t tick() noexcept { return myTick; }
+
+/**
+ * @brief Cached temp sensor initialization test.
+ *
+ *        Verify that the cache isn't initialized if the sensor isn't initialized or if no clock
+ *        is present.
+ */
+TEST(TempSensor_Cached, Initialization)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::Cached cache{sensor, MaxAge, tick};
+
+    // Case 1 - Expect the cache to be initialized if the sensor is.
+    EXPECT_TRUE(cache.isInitialized());
+
+    // Case 2 - Expect the cache to not be initialized and read 0 if the sensor isn't.
+    {
+        sensor.setTemp(25);
+        sensor.setInitialized(false);
+        EXPECT_FALSE(cache.isInitialized());
+        EXPECT_EQ(cache.read(), 0);
+        EXPECT_FALSE(cache.update());
+        sensor.setInitialized(true);
+    }
+
+    // Case 3 - Expect the cache to not be initialized without a clock.
+    {
+        tempsensor::Cached noClock{sensor, MaxAge, nullptr};
+        EXPECT_FALSE(noClock.isInitialized());
+        EXPECT_FALSE(noClock.isValid());
+        EXPECT_FALSE(noClock.update());
+    }
+}
+
+/**
+ * @brief Cached temp sensor staleness test.
+ *
+ *        Verify that the cached temperature is returned until it's refreshed by update() after
+ *        the max age has been reached, i.e. that reads never wait for the sensor once cached.
+ */
+TEST(TempSensor_Cached, Staleness)
+{
+    tempsensor::Stub sensor{};
+    myTick = 0U;
+    tempsensor::Cached cache{sensor, MaxAge, tick};
+
+    // Case 1 - Expect the first read to be taken from the sensor, since nothing is cached.
+    {
+        sensor.setTemp(25);
+        EXPECT_FALSE(cache.isValid());
+        EXPECT_EQ(cache.read(), 25);
+        EXPECT_TRUE(cache.isValid());
+        EXPECT_EQ(cache.hitCount(), 0U);
+        EXPECT_EQ(cache.missCount(), 1U);
+    }
+
+    // Case 2 - Expect subsequent reads to be served from the cache before the max age is reached.
+    {
+        sensor.setTemp(30);
+        myTick = MaxAge - 1U;
+        EXPECT_EQ(cache.read(), 25);
+        EXPECT_EQ(cache.read(), 25);
+        EXPECT_FALSE(cache.update());
+        EXPECT_EQ(cache.hitCount(), 2U);
+        EXPECT_EQ(cache.missCount(), 1U);
+    }
+
+    // Case 3 - Reach the max age, expect the expired temperature to be returned until the
+    //          next update, which takes the new reading from the sensor.
+    {
+        myTick = MaxAge;
+        EXPECT_FALSE(cache.isValid());
+        EXPECT_EQ(cache.read(), 25);
+        EXPECT_EQ(cache.missCount(), 2U);
+
+        EXPECT_TRUE(cache.update());
+        EXPECT_TRUE(cache.isValid());
+        EXPECT_EQ(cache.read(), 30);
+        EXPECT_EQ(cache.hitCount(), 3U);
+        EXPECT_EQ(cache.missCount(), 2U);
+    }
+
+    // Case 4 - Expect the age to be measured correctly when the clock wraps around.
+    {
+        sensor.setTemp(35);
+        myTick = static_cast<std::uint32_t>(-10);
+        EXPECT_TRUE(cache.update());
+        myTick = MaxAge - 11U;
+        EXPECT_TRUE(cache.isValid());
+        myTick = MaxAge - 10U;
+        EXPECT_FALSE(cache.isValid());
+        EXPECT_EQ(cache.read(), 35);
+    }
+
+    // Case 5 - Expect the counters to be cleared on reset.
+    {
+        cache.resetCounters();
+        EXPECT_EQ(cache.hitCount(), 0U);
+        EXPECT_EQ(cache.missCount(), 0U);
+    }
+}
+
+/**
+ * @brief Cached temp sensor update test.
+ *
+ *        Verify that update() only refreshes an expired cache, so that following reads are hits.
+ */
+TEST(TempSensor_Cached, Update)
+{
+    tempsensor::Stub sensor{};
+    myTick = 0U;
+    tempsensor::Cached cache{sensor, MaxAge, tick};
+
+    // Case 1 - Expect an empty cache to be refreshed without counting a miss.
+    {
+        sensor.setTemp(20);
+        EXPECT_TRUE(cache.update());
+        EXPECT_EQ(cache.read(), 20);
+        EXPECT_EQ(cache.hitCount(), 1U);
+        EXPECT_EQ(cache.missCount(), 0U);
+    }
+
+    // Case 2 - Expect a valid cache to be left untouched.
+    {
+        sensor.setTemp(22);
+        EXPECT_FALSE(cache.update());
+        EXPECT_EQ(cache.read(), 20);
+    }
+
+    // Case 3 - Invalidate the cache manually, expect it to be refreshed once more.
+    {
+        cache.invalidate();
+        EXPECT_FALSE(cache.isValid());
+        EXPECT_TRUE(cache.update());
+        EXPECT_EQ(cache.read(), 22);
+        EXPECT_FALSE(cache.update());
+        EXPECT_EQ(cache.missCount(), 0U);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -7,6 +7,7 @@
 
 #include "arch/avr/hw_platform.h"
 #include "driver/timer/atmega328p.h"
+#include "utils/delegate.h"
 #include "utils/utils.h"
 
 #ifdef TESTSUITE
@@ -16,6 +17,12 @@
 //! @todo Implement tests according to project requirements.
 namespace driver
 {
+namespace timer
+{
+/** Interrupt service routine of Timer 0, defined via ISR() in the timer driver. */
+void TIMER0_OVF_vect() noexcept;
+} // namespace timer
+
 namespace
 {
 /** Maximum number of timer circuits available on ATmega328P. */
@@ -284,6 +291,45 @@ TEST(Timer_Atmega328p, Restart)
         EXPECT_TRUE(callbackInvoked);
 }
 
+/**
+ * @brief Timer interrupt dispatch test.
+ * 
+ *        Verify that timer interrupts are dispatched to the timer reserving the circuit, and 
+ *        that member functions can be bound as timeout callbacks.
+ */
+TEST(Timer_Atmega328p, InterruptDispatch)
+{
+    /** Object counting the timeouts. */
+    struct Counter
+    {
+        int count;
+        void increment() noexcept { count++; }
+    } counter{0};
+
+    // Case 1 - Verify that the timeout callback is invoked via the interrupt of Timer 0.
+    {
+        timer::Atmega328p timer{
+            10U, utils::Delegate<void()>::bind<&Counter::increment>(counter), true};
+        ASSERT_TRUE(timer.isInitialized());
+
+        for (std::uint32_t i{}; i < getMaxCount(10U); ++i) { timer::TIMER0_OVF_vect(); }
+        EXPECT_EQ(counter.count, 1);
+
+        // Replace the callback, expect the new callback to be invoked on the next timeout.
+        resetCallbackFlag();
+        timer.setCallback(testCallback);
+        for (std::uint32_t i{}; i < getMaxCount(10U); ++i) { timer::TIMER0_OVF_vect(); }
+        EXPECT_TRUE(callbackInvoked);
+        EXPECT_EQ(counter.count, 1);
+    }
+
+    // Case 2 - Verify that interrupts are ignored once the timer has been deleted.
+    {
+        timer::TIMER0_OVF_vect();
+        EXPECT_EQ(counter.count, 1);
+    }
+}
+
 //! @todo Add more tests here (e.g., register verification, multiple timers running simultaneously).
 
 } // namespace
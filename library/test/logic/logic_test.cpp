@@ -10,12 +10,16 @@
 #include <gtest/gtest.h>
 
 #include "driver/eeprom/stub.h"
+#include "driver/gpio/debouncer.h"
 #include "driver/gpio/stub.h"
 #include "driver/serial/stub.h"
+#include "driver/tempsensor/cached.h"
 #include "driver/tempsensor/stub.h"
 #include "driver/timer/stub.h"
 #include "driver/watchdog/stub.h"
 #include "logic/stub.h"
+#include "profiler/clock.h"
+#include "profiler/handler.h"
 
 //! @todo Remove this #ifdef block once all stubs are implemented!
 
@@ -105,6 +109,19 @@ struct mock final
         return *logicImpl;
     }
 
+    /**
+     * @brief Create logic implementation for buttons debounced by a sampling debouncer.
+     * 
+     * @return Reference to the logic implementation.
+     */
+    logic::Stub& createDebouncedLogic()
+    {
+        logicImpl = std::make_unique<logic::Stub>(
+            led, toggleButton, tempButton, toggleTimer, tempTimer, serial, watchdog, eeprom, 
+            tempSensor);
+        return *logicImpl;
+    }
+
     /**
      * @brief Run system.
      * 
@@ -447,6 +464,220 @@ TEST(Logic, Eeprom)
         EXPECT_TRUE(mock.toggleTimer.isEnabled());
     }
 }
+
+/**
+ * @brief Debounced button event test.
+ *
+ *        Verify that the events of a sampling debouncer are handled without a debounce timer
+ *        or pin change interrupts.
+ */
+TEST(Logic, DebouncedButtonEvents)
+{
+    using driver::gpio::ButtonEvent;
+    mock mock{};
+    logic::Stub& logic{mock.createDebouncedLogic()};
+    EXPECT_TRUE(logic.isInitialized());
+    EXPECT_FALSE(mock.toggleButton.isInterruptEnabled());
+    EXPECT_FALSE(mock.tempButton.isInterruptEnabled());
+
+    // Case 1 - Verify that the toggle timer is toggled when the toggle button is pressed only.
+    {
+        logic.handleButtonEvent(Logic::ToggleButton, ButtonEvent::Pressed);
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+        logic.handleButtonEvent(Logic::ToggleButton, ButtonEvent::Released);
+        logic.handleButtonEvent(Logic::ToggleButton, ButtonEvent::LongPressed);
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+        logic.handleButtonEvent(Logic::ToggleButton, ButtonEvent::Pressed);
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+    }
+
+    // Case 2 - Verify that the temperature is printed when the temperature button is pressed.
+    {
+        logic.handleButtonEvent(Logic::TempButton, ButtonEvent::Pressed);
+        logic.handleButtonEvent(Logic::TempButton, ButtonEvent::Released);
+        EXPECT_EQ(logic.tempPrintoutCount(), 1U);
+    }
+
+    // Case 3 - Verify that the pin change handler is ignored, since no debounce timer is used.
+    {
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+    }
+}
+
+/** Simulated clock tick measuring the age of cached temperatures. */
+std::uint32_t myTempTick{};
+
+/**
+ * @brief Get the simulated clock tick measuring the age of cached temperatures.
+ *
+ * @return The current tick.
+ */
+std::uint32_t tempTick() noexcept { return myTempTick; }
+
+/**
+ * @brief Cached temperature test.
+ *
+ *        Verify that a cached temperature is refreshed by the main loop, so that the event 
+ *        handlers print the cached temperature without reading the sensor.
+ */
+TEST(Logic, CachedTemperature)
+{
+    using driver::gpio::ButtonEvent;
+    constexpr std::uint32_t maxAge{100U};
+    mock mock{};
+    myTempTick = 0U;
+    driver::tempsensor::Cached cachedSensor{mock.tempSensor, maxAge, tempTick};
+    mock.logicImpl = std::make_unique<logic::Stub>(
+        mock.led, mock.toggleButton, mock.tempButton, mock.toggleTimer, mock.tempTimer, 
+        mock.serial, mock.watchdog, mock.eeprom, cachedSensor);
+    logic::Stub& logic{*mock.logicImpl};
+
+    // Expect the printed lines to hold the given temperature.
+    const auto expectPrinted{[&mock](const char* temperature)
+    {
+        const auto& printedLines{mock.serial.getPrintedLines()};
+        ASSERT_EQ(printedLines.size(), 1U);
+        EXPECT_NE(printedLines[0].find(temperature), std::string::npos);
+        mock.serial.clearPrintedLines();
+    }};
+
+    // Case 1 - Run the system, expect the main loop to fill the cache.
+    {
+        mock.tempSensor.setTemp(25);
+        mock.runSystem();
+        EXPECT_TRUE(cachedSensor.isValid());
+        mock.serial.clearPrintedLines();
+    }
+
+    // Case 2 - Print the temperature, expect the cached temperature to be printed.
+    {
+        mock.tempSensor.setTemp(30);
+        logic.handleButtonEvent(Logic::TempButton, ButtonEvent::Pressed);
+        expectPrinted("25 Celsius");
+        EXPECT_EQ(cachedSensor.hitCount(), 1U);
+    }
+
+    // Case 3 - Expire the cache, expect the last temperature to be printed until the main 
+    //          loop has refreshed the cache.
+    {
+        myTempTick = maxAge;
+        mock.tempTimer.setTimedOut(true);
+        logic.handleTempTimerTimeout();
+        expectPrinted("25 Celsius");
+        EXPECT_EQ(cachedSensor.missCount(), 1U);
+
+        mock.runSystem();
+        mock.serial.clearPrintedLines();
+        logic.handleTempTimerTimeout();
+        expectPrinted("30 Celsius");
+        EXPECT_EQ(cachedSensor.hitCount(), 2U);
+    }
+    mock.logicImpl.reset();
+}
+
+/**
+ * @brief Memory usage command test.
+ *
+ *        Verify that the memory usage is printed when the 'm' command is received.
+ */
+TEST(Logic, MemoryCommand)
+{
+    mock<1024> mock;
+    mock.createLogic();
+
+    const std::uint8_t command{'m'};
+    mock.serial.setReadBuffer(&command, 1U);
+    mock.runSystem();
+
+    bool heapPrinted{false};
+    bool stackPrinted{false};
+
+    for (const auto& line : mock.serial.getPrintedLines())
+    {
+        if (0U == line.find("Heap:")) { heapPrinted = true; }
+        if (0U == line.find("Stack:")) { stackPrinted = true; }
+    }
+    EXPECT_TRUE(heapPrinted);
+    EXPECT_TRUE(stackPrinted);
+}
+
+/**
+ * @brief Interrupt profile command test.
+ *
+ *        Verify that the interrupt profile is printed when the 'i' command is received.
+ */
+TEST(Logic, IsrProfileCommand)
+{
+    mock<1024> mock;
+    mock.createLogic();
+
+    const std::uint8_t command{'i'};
+    mock.serial.setReadBuffer(&command, 1U);
+    mock.runSystem();
+
+    bool profilePrinted{false};
+
+    for (const auto& line : mock.serial.getPrintedLines())
+    {
+        if (0U == line.find("ISR profile")) { profilePrinted = true; }
+    }
+    EXPECT_TRUE(profilePrinted);
+}
+/**
+ * @brief Handler cycle budget test.
+ *
+ *        Verify that the profiled handlers stay within their cycle budgets on the host model,
+ *        and that the profiles are printed when the 'b' command is received.
+ */
+TEST(Logic, HandlerBudgets)
+{
+    ASSERT_TRUE(profiler::clock::start());
+    Logic::resetHandlerProfiles();
+    {
+        mock<1024> mock;
+        logic::Stub& logic{static_cast<logic::Stub&>(mock.createLogic())};
+
+        // Run all profiled handlers, then print the profiles.
+        const std::uint8_t toggleCommand{'t'};
+        mock.serial.setReadBuffer(&toggleCommand, 1U);
+        mock.runSystem();
+
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+        logic.handleButtonEvent(Logic::TempButton, driver::gpio::ButtonEvent::Pressed);
+        mock.tempTimer.setTimedOut(true);
+        logic.handleTempTimerTimeout();
+
+        const std::uint8_t printCommand{'b'};
+        mock.serial.setReadBuffer(&printCommand, 1U);
+        mock.runSystem();
+
+        bool profilePrinted{false};
+
+        for (const auto& line : mock.serial.getPrintedLines())
+        {
+            if (0U == line.find("Handler profile")) { profilePrinted = true; }
+        }
+        EXPECT_TRUE(profilePrinted);
+    }
+    profiler::clock::stop();
+
+    for (std::uint8_t i{}; i < static_cast<std::uint8_t>(Logic::Handler::Count); ++i)
+    {
+        const auto profile{Logic::handlerProfile(static_cast<Logic::Handler>(i))};
+        ASSERT_NE(profile, nullptr);
+        EXPECT_LT(0U, profile->count()) << profile->name() << " was never called";
+        EXPECT_TRUE(profile->isWithinBudget()) 
+            << profile->name() << " exceeded its budget: " << profile->worst() << " > " 
+            << profile->budget() << " cycles";
+    }
+    EXPECT_EQ(Logic::handlerProfile(Logic::Handler::Count), nullptr);
+}
 } // namespace
 } // namespace logic
 
@@ -0,0 +1,206 @@
+/**
+ * @brief Unit tests for the allocator layer.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "container/vector.h"
+#include "memory/allocator.h"
+#include "memory/arena.h"
+#include "memory/block_pool.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace allocator
+{
+namespace
+{
+/**
+ * @brief Allocator phase test.
+ *
+ *        Verify that init-time blocks are taken from the arena, runtime blocks from the smallest
+ *        fitting pool, and that the heap is used as fallback.
+ */
+TEST(Memory_Allocator, Phases)
+{
+    const StatsGuard statsGuard{};
+    reset();
+    StaticArena<128U> arena{};
+    StaticBlockPool<64U, 2U> largePool{};
+    StaticBlockPool<32U, 2U> smallPool{};
+
+    EXPECT_TRUE(setArena(&arena));
+    EXPECT_TRUE(addPool(largePool));
+    EXPECT_TRUE(addPool(smallPool));
+    EXPECT_FALSE(addPool(smallPool));
+    EXPECT_TRUE(isStartup());
+
+    // Case 1 - Allocate during startup, expect the blocks to be taken from the arena.
+    auto initBlock{utils::newMemory<std::uint32_t>(4U)};
+    {
+        ASSERT_NE(initBlock, nullptr);
+        EXPECT_TRUE(arena.owns(initBlock));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(initBlock) % alignof(max_align_t), 0U);
+    }
+
+    // Case 2 - Exhaust the arena, expect the heap to be used as fallback.
+    auto heapBlock{allocate(arena.capacity())};
+    {
+        ASSERT_NE(heapBlock, nullptr);
+        EXPECT_FALSE(arena.owns(heapBlock));
+        EXPECT_EQ(stats().lateHeapCount, 0U);
+    }
+
+    // Case 3 - End startup, expect the arena to be closed and the pools to be used.
+    endStartup(false);
+    void* small{allocate(4U)};
+    void* large{allocate(40U)};
+    {
+        EXPECT_FALSE(isStartup());
+        EXPECT_FALSE(setArena(nullptr));
+        EXPECT_TRUE(smallPool.owns(small));
+        EXPECT_TRUE(largePool.owns(large));
+    }
+
+    // Case 4 - Exhaust the small pool, expect the next larger pool to be used.
+    void* spill{allocate(4U)};
+    void* overflow{allocate(4U)};
+    {
+        EXPECT_TRUE(smallPool.owns(spill));
+        EXPECT_TRUE(largePool.owns(overflow));
+        EXPECT_EQ(largePool.freeCount(), 0U);
+    }
+
+    // Case 5 - Exhaust all pools, expect the heap to be used and counted.
+    void* late{allocate(4U)};
+    {
+        ASSERT_NE(late, nullptr);
+        EXPECT_EQ(stats().lateHeapCount, 1U);
+        EXPECT_EQ(stats().blockCount, 7U);
+    }
+
+    // Case 6 - Release all blocks, expect them to be returned to their backends.
+    {
+        for (auto block : {small, large, spill, overflow, late, heapBlock}) { deallocate(block); }
+        utils::deleteMemory(initBlock);
+        EXPECT_EQ(initBlock, nullptr);
+        EXPECT_EQ(smallPool.freeCount(), 2U);
+        EXPECT_EQ(largePool.freeCount(), 2U);
+        EXPECT_EQ(arena.used(), 0U);
+        EXPECT_EQ(stats().blockCount, 0U);
+        EXPECT_EQ(stats().usedBytes, 0U);
+        EXPECT_EQ(stats().reservedBytes, 0U);
+    }
+    reset();
+}
+
+/**
+ * @brief Forbidden heap test.
+ *
+ *        Verify that the heap isn't used after startup when forbidden, while the pools are.
+ */
+TEST(Memory_Allocator, ForbiddenHeap)
+{
+    const StatsGuard statsGuard{};
+    reset();
+    StaticBlockPool<32U, 1U> pool{};
+    EXPECT_TRUE(addPool(pool));
+    endStartup(true);
+
+    // Case 1 - Verify that the pool is used as long as it has free blocks.
+    auto block{allocate(8U)};
+    {
+        EXPECT_TRUE(pool.owns(block));
+        EXPECT_EQ(allocate(8U), nullptr);
+        EXPECT_EQ(allocate(1024U), nullptr);
+        EXPECT_EQ(stats().failedCount, 2U);
+        EXPECT_EQ(stats().lateHeapCount, 0U);
+    }
+
+    // Case 2 - Verify that containers fail gracefully once the pool is exhausted.
+    {
+        container::Vector<std::uint64_t> vector{};
+        EXPECT_FALSE(vector.resize(64U));
+        EXPECT_EQ(stats().failedCount, 3U);
+    }
+
+    deallocate(block);
+    reset();
+}
+
+/**
+ * @brief Reallocation test.
+ *
+ *        Verify that blocks are resized in place when possible, moved between backends otherwise,
+ *        and that the content is preserved.
+ */
+TEST(Memory_Allocator, Reallocation)
+{
+    const StatsGuard statsGuard{};
+    reset();
+    StaticArena<256U> arena{};
+    StaticBlockPool<48U, 2U> pool{};
+    EXPECT_TRUE(setArena(&arena));
+    EXPECT_TRUE(addPool(pool));
+
+    // Case 1 - Grow the last arena block, expect it to be resized in place.
+    auto block{static_cast<char*>(allocate(8U))};
+    {
+        ASSERT_NE(block, nullptr);
+        std::strcpy(block, "arena");
+        EXPECT_EQ(reallocate(block, 64U), block);
+        EXPECT_STREQ(block, "arena");
+        EXPECT_EQ(stats().usedBytes, 64U);
+    }
+
+    // Case 2 - Grow beyond the arena, expect the content to be moved to the heap.
+    {
+        auto moved{static_cast<char*>(reallocate(block, 512U))};
+        ASSERT_NE(moved, nullptr);
+        EXPECT_FALSE(arena.owns(moved));
+        EXPECT_STREQ(moved, "arena");
+        EXPECT_EQ(arena.used(), 0U);
+        block = moved;
+    }
+
+    // Case 3 - Shrink into a pool block after startup, expect the content to be preserved.
+    endStartup(false);
+    {
+        auto pooled{static_cast<char*>(allocate(4U))};
+        ASSERT_TRUE(pool.owns(pooled));
+        std::strcpy(pooled, "abc");
+        EXPECT_EQ(reallocate(pooled, 16U), pooled);
+        EXPECT_EQ(stats().usedBytes, 512U + 16U);
+
+        auto grown{static_cast<char*>(reallocate(pooled, 256U))};
+        ASSERT_NE(grown, nullptr);
+        EXPECT_FALSE(pool.owns(grown));
+        EXPECT_STREQ(grown, "abc");
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(reallocate(grown, 0U), nullptr);
+    }
+
+    // Case 4 - Verify the statistics.
+    {
+        EXPECT_EQ(stats().blockCount, 1U);
+        EXPECT_EQ(stats().usedBytes, 512U);
+        EXPECT_GE(stats().highWaterMark, 512U + 256U);
+        EXPECT_GT(stats().fragmentation(), 0U);
+        EXPECT_LT(stats().fragmentation(), 10U);
+    }
+
+    deallocate(block);
+    EXPECT_EQ(stats().reservedBytes, 0U);
+    EXPECT_EQ(stats().fragmentation(), 0U);
+    reset();
+}
+} // namespace
+} // namespace allocator
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,97 @@
+/**
+ * @brief Unit tests for the static arena allocator.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/arena.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Arena allocation test.
+ *
+ *        Verify that blocks are handed out in address order until the arena is exhausted.
+ */
+TEST(Memory_Arena, Allocation)
+{
+    constexpr std::size_t blockSize{Arena::alignedSize(1U)};
+    StaticArena<4U * blockSize> arena{};
+
+    EXPECT_EQ(arena.capacity(), 4U * blockSize);
+    EXPECT_EQ(arena.used(), 0U);
+
+    // Case 1 - Allocate blocks, expect them to be aligned and adjacent.
+    {
+        auto first{static_cast<std::uint8_t*>(arena.allocate(1U))};
+        auto second{static_cast<std::uint8_t*>(arena.allocate(blockSize + 1U))};
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % Arena::Alignment, 0U);
+        EXPECT_EQ(second, first + blockSize);
+        EXPECT_EQ(arena.used(), 3U * blockSize);
+        EXPECT_TRUE(arena.owns(first));
+        EXPECT_FALSE(arena.owns(&arena));
+    }
+
+    // Case 2 - Allocate more than what's left, expect the allocation to fail.
+    {
+        EXPECT_EQ(arena.allocate(blockSize + 1U), nullptr);
+        EXPECT_EQ(arena.allocate(0U), nullptr);
+        EXPECT_EQ(arena.failedCount(), 2U);
+        EXPECT_NE(arena.allocate(blockSize), nullptr);
+        EXPECT_EQ(arena.used(), arena.capacity());
+    }
+
+    // Case 3 - Reset the arena, expect all memory to be available while the peak is kept.
+    {
+        arena.reset();
+        EXPECT_EQ(arena.used(), 0U);
+        EXPECT_EQ(arena.highWaterMark(), arena.capacity());
+    }
+}
+
+/**
+ * @brief Arena resize test.
+ *
+ *        Verify that only the most recently allocated block can be resized or reclaimed.
+ */
+TEST(Memory_Arena, Resize)
+{
+    constexpr std::size_t blockSize{Arena::alignedSize(1U)};
+    StaticArena<4U * blockSize> arena{};
+    auto first{arena.allocate(blockSize)};
+    auto second{arena.allocate(blockSize)};
+
+    // Case 1 - Verify that the last block can grow and shrink in place.
+    {
+        EXPECT_TRUE(arena.resize(second, blockSize, 3U * blockSize));
+        EXPECT_EQ(arena.used(), 4U * blockSize);
+        EXPECT_FALSE(arena.resize(second, 3U * blockSize, 4U * blockSize));
+        EXPECT_TRUE(arena.resize(second, 3U * blockSize, blockSize));
+        EXPECT_EQ(arena.used(), 2U * blockSize);
+    }
+
+    // Case 2 - Verify that other blocks can neither be resized nor reclaimed.
+    {
+        EXPECT_FALSE(arena.resize(first, blockSize, 2U * blockSize));
+        arena.deallocate(first, blockSize);
+        EXPECT_EQ(arena.used(), 2U * blockSize);
+    }
+
+    // Case 3 - Verify that the last block is reclaimed on release.
+    {
+        arena.deallocate(second, blockSize);
+        EXPECT_EQ(arena.used(), blockSize);
+        EXPECT_EQ(arena.allocate(blockSize), second);
+    }
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
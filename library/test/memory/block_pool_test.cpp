@@ -0,0 +1,78 @@
+/**
+ * @brief Unit tests for the static fixed-size block pool.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/block_pool.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Block pool allocation test.
+ *
+ *        Verify that blocks are allocated in address order, reused once returned and that the
+ *        statistics are updated accordingly.
+ */
+TEST(Memory_BlockPool, Allocation)
+{
+    constexpr std::size_t blockCount{4U};
+    StaticBlockPool<3U, blockCount> pool{};
+    void* blocks[blockCount]{};
+
+    EXPECT_EQ(pool.blockSize(), BlockPool::alignedSize(3U));
+    EXPECT_GE(pool.blockSize(), sizeof(void*));
+    EXPECT_EQ(pool.blockCount(), blockCount);
+    EXPECT_EQ(pool.freeCount(), blockCount);
+
+    // Case 1 - Allocate all blocks, expect them to be adjacent and aligned.
+    {
+        for (std::size_t i{}; i < blockCount; ++i)
+        {
+            blocks[i] = pool.allocate();
+            ASSERT_NE(blocks[i], nullptr);
+            EXPECT_TRUE(pool.owns(blocks[i]));
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks[i]) % BlockPool::Alignment, 0U);
+            if (i > 0U)
+            {
+                EXPECT_EQ(static_cast<std::uint8_t*>(blocks[i]),
+                          static_cast<std::uint8_t*>(blocks[i - 1U]) + pool.blockSize());
+            }
+        }
+        EXPECT_EQ(pool.freeCount(), 0U);
+        EXPECT_EQ(pool.highWaterMark(), blockCount);
+    }
+
+    // Case 2 - Allocate from the empty pool, expect the allocation to fail.
+    {
+        EXPECT_EQ(pool.allocate(), nullptr);
+        EXPECT_EQ(pool.failedCount(), 1U);
+    }
+
+    // Case 3 - Return blocks, expect the last returned block to be reused first.
+    {
+        pool.deallocate(blocks[1U]);
+        pool.deallocate(blocks[2U]);
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(pool.allocate(), blocks[2U]);
+        EXPECT_EQ(pool.allocate(), blocks[1U]);
+    }
+
+    // Case 4 - Return foreign blocks, expect them to be ignored.
+    {
+        int value{};
+        pool.deallocate(&value);
+        pool.deallocate(nullptr);
+        EXPECT_FALSE(pool.owns(&value));
+        EXPECT_EQ(pool.freeCount(), 0U);
+    }
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,138 @@
+/**
+ * @brief Unit tests for the memory diagnostics.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "container/list.h"
+#include "container/vector.h"
+#include "memory/allocator.h"
+#include "memory/diagnostics.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace diagnostics
+{
+namespace
+{
+/**
+ * @brief Simulate a function call using the given number of bytes on the stack.
+ *
+ * @param[in] frameSize The size of the stack frame in bytes.
+ */
+void pushFrame(const std::size_t frameSize)
+{
+    test::Stack::pointer -= frameSize;
+    std::memset(test::Stack::pointer, 0, frameSize);
+}
+
+/**
+ * @brief Print the allocation statistics.
+ *
+ * @param[in] name The name of the measured workload.
+ * @param[in] stats The statistics to print.
+ */
+void printStats(const char* name, const allocator::Stats& stats)
+{
+    std::printf("%s: %u allocations, %u deallocations, %zu bytes peak, %u%% fragmented\n",
+                name, stats.allocationCount, stats.deallocationCount, stats.highWaterMark,
+                stats.fragmentation());
+}
+
+/**
+ * @brief Stack usage test.
+ *
+ *        Verify that the deepest stack usage is found after the stack has been painted.
+ */
+TEST(Memory_Diagnostics, StackUsage)
+{
+    constexpr std::size_t size{test::Stack::Size};
+    test::Stack::pointer = test::Stack::data + size;
+
+    // Case 1 - Paint the empty stack, expect all memory to be headroom.
+    {
+        paintStack();
+        const auto usage{stackUsage()};
+        EXPECT_EQ(usage.capacity, size);
+        EXPECT_EQ(usage.used, 0U);
+        EXPECT_EQ(usage.peak, 0U);
+        EXPECT_EQ(usage.headroom, size);
+    }
+
+    // Case 2 - Simulate nested function calls, expect the usage to follow the stack pointer.
+    {
+        pushFrame(32U);
+        pushFrame(64U);
+        const auto usage{stackUsage()};
+        EXPECT_EQ(usage.used, 96U);
+        EXPECT_EQ(usage.peak, 96U);
+        EXPECT_EQ(usage.headroom, size - 96U);
+    }
+
+    // Case 3 - Return from the inner call, expect the peak to be kept.
+    {
+        test::Stack::pointer += 64U;
+        const auto usage{stackUsage()};
+        EXPECT_EQ(usage.used, 32U);
+        EXPECT_EQ(usage.peak, 96U);
+        EXPECT_EQ(usage.headroom, size - 96U);
+    }
+
+    // Case 4 - Repaint the stack, expect the peak to restart from the current usage.
+    {
+        paintStack();
+        EXPECT_EQ(stackUsage().peak, 32U);
+        EXPECT_EQ(report().stack.peak, 32U);
+    }
+    test::Stack::pointer = test::Stack::data + size;
+}
+
+/**
+ * @brief Peak heap usage test.
+ *
+ *        Run representative container workloads and report the allocation counters. Expect the
+ *        peak memory usage to stay within budget, so that regressions are caught.
+ */
+TEST(Memory_Diagnostics, PeakHeapUsage)
+{
+    const allocator::StatsGuard statsGuard{};
+
+    // Case 1 - Grow a vector one element at a time.
+    {
+        allocator::reset();
+        {
+            container::Vector<std::uint16_t> vector{};
+            for (std::uint16_t i{}; i < 64U; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        }
+        const auto stats{allocator::stats()};
+        printStats("Vector growth", stats);
+        EXPECT_EQ(stats.blockCount, 0U);
+        EXPECT_EQ(stats.allocationCount, stats.deallocationCount);
+        EXPECT_LE(stats.highWaterMark, 2U * 64U * sizeof(std::uint16_t) + 64U);
+    }
+
+    // Case 2 - Fill a list, then remove all nodes.
+    {
+        allocator::reset();
+        {
+            container::List<std::uint32_t> list{};
+            for (std::uint32_t i{}; i < 32U; ++i) { EXPECT_TRUE(list.pushBack(i)); }
+            list.clear();
+        }
+        const auto stats{allocator::stats()};
+        printStats("List nodes", stats);
+        EXPECT_EQ(stats.blockCount, 0U);
+        EXPECT_LE(stats.highWaterMark, 32U * 64U);
+    }
+}
+} // namespace
+} // namespace diagnostics
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,172 @@
+/**
+ * @brief Unit tests for the intrusive pointer.
+ */
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "memory/allocator.h"
+#include "memory/intrusive_ptr.h"
+#include "memory/ref_count.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Reference-counted object counting its live instances.
+ *
+ * @tparam Policy The reference counting policy.
+ */
+template <typename Policy>
+struct Tracked : public RefCounted<Tracked<Policy>, Policy>
+{
+    /** The number of live instances. */
+    static int instanceCount;
+
+    /** Value held by the object. */
+    int value;
+
+    /**
+     * @brief Create object holding given value.
+     *
+     * @param[in] value The value to hold.
+     */
+    explicit Tracked(const int value) noexcept
+        : value{value}
+    {
+        instanceCount++;
+    }
+
+    /**
+     * @brief Delete object.
+     */
+    ~Tracked() noexcept { instanceCount--; }
+};
+
+template <typename Policy>
+int Tracked<Policy>::instanceCount{};
+
+/**
+ * @brief Statically allocated reference-counted object, which is never deleted.
+ */
+struct Static : public RefCounted<Static>
+{
+    /** The number of times the last owner has been released. */
+    static int destroyCount;
+
+    /**
+     * @brief Count the release of the last owner instead of deleting the object.
+     */
+    static void destroy(Static*) noexcept { destroyCount++; }
+};
+
+int Static::destroyCount{};
+
+/**
+ * @brief Get the number of allocations made via memory::allocator so far.
+ *
+ * @return The total number of allocations.
+ */
+std::uint32_t allocationCount() noexcept { return allocator::stats().allocationCount; }
+
+/**
+ * @brief Intrusive ownership test.
+ *
+ *        Verify that the count is held by the object, and that the object is destroyed with
+ *        the last owner.
+ */
+TEST(Memory_IntrusivePtr, Ownership)
+{
+    using Object = Tracked<SingleContextCount>;
+    static_assert(sizeof(IntrusivePtr<Object>) == sizeof(Object*),
+                  "Intrusive pointers must be pointer-sized!");
+
+    // Case 1 - Verify that makeIntrusive() only allocates the object.
+    {
+        const auto allocations{allocationCount()};
+        auto ptr{makeIntrusive<Object>(42)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(allocationCount() - allocations, 1U);
+        EXPECT_EQ(ptr->value, 42);
+        EXPECT_EQ(ptr.useCount(), 1U);
+    }
+    EXPECT_EQ(Object::instanceCount, 0);
+
+    // Case 2 - Verify that copies share ownership, also when created from raw pointers.
+    {
+        auto ptr{makeIntrusive<Object>(1)};
+        IntrusivePtr<Object> copy{ptr};
+        IntrusivePtr<Object> raw{ptr.get()};
+        EXPECT_EQ(ptr.useCount(), 3U);
+
+        IntrusivePtr<Object> moved{static_cast<IntrusivePtr<Object>&&>(copy)};
+        EXPECT_FALSE(copy);
+        EXPECT_EQ(moved.useCount(), 3U);
+
+        ptr.reset();
+        raw = moved;
+        EXPECT_EQ(raw.useCount(), 2U);
+        EXPECT_EQ(Object::instanceCount, 1);
+        moved = IntrusivePtr<Object>{};
+        raw   = makeIntrusive<Object>(2);
+        EXPECT_EQ((*raw).value, 2);
+        EXPECT_EQ(Object::instanceCount, 1);
+    }
+    EXPECT_EQ(Object::instanceCount, 0);
+
+    // Case 3 - Verify that the release of the last owner can be customized.
+    {
+        static Static object;
+        {
+            IntrusivePtr<Static> first{&object};
+            IntrusivePtr<Static> second{first};
+            EXPECT_EQ(object.refCount(), 2U);
+        }
+        EXPECT_EQ(object.refCount(), 0U);
+        EXPECT_EQ(Static::destroyCount, 1);
+    }
+}
+
+/**
+ * @brief Atomic reference count test.
+ *
+ *        Verify that pointers using the atomic policy can be copied and released from several
+ *        threads concurrently without losing references.
+ */
+TEST(Memory_IntrusivePtr, AtomicCount)
+{
+    using Object = Tracked<AtomicCount>;
+    constexpr int threadCount{4};
+    constexpr int iterationCount{100000};
+
+    auto ptr{makeIntrusive<Object>(3)};
+    long long sums[threadCount]{};
+
+    // Accumulate the result in each thread to keep gtest out of the hot loop.
+    std::thread threads[threadCount]{};
+    for (int i{}; i < threadCount; ++i)
+    {
+        threads[i] = std::thread{[&ptr, &sums, i]()
+        {
+            for (int j{}; j < iterationCount; ++j)
+            {
+                IntrusivePtr<Object> copy{ptr};
+                sums[i] += copy->value;
+            }
+        }};
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    for (const auto sum : sums) { EXPECT_EQ(sum, 3LL * iterationCount); }
+    EXPECT_EQ(ptr.useCount(), 1U);
+    ptr.reset();
+    EXPECT_EQ(Object::instanceCount, 0);
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,104 @@
+/**
+ * @brief Unit tests for the fixed-block memory pool.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/pool.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Pool allocation test.
+ *
+ *        Verify that blocks are allocated from slabs of the given size and reused once returned.
+ */
+TEST(Memory_Pool, Allocation)
+{
+    constexpr std::size_t slabSize{4U};
+    Pool<std::uint32_t, slabSize> pool{};
+    std::uint32_t* blocks[2U * slabSize]{};
+
+    EXPECT_EQ(pool.slabCount(), 0U);
+    EXPECT_EQ(pool.freeCount(), 0U);
+    EXPECT_EQ(pool.slabSize(), slabSize);
+
+    // Case 1 - Allocate one slab worth of blocks, expect them to be allocated in address order.
+    {
+        for (std::size_t i{}; i < slabSize; ++i)
+        {
+            blocks[i] = pool.allocate();
+            ASSERT_NE(blocks[i], nullptr);
+            *blocks[i] = static_cast<std::uint32_t>(i);
+            if (i > 0U) { EXPECT_GT(blocks[i], blocks[i - 1U]); }
+        }
+        EXPECT_EQ(pool.slabCount(), 1U);
+        EXPECT_EQ(pool.freeCount(), 0U);
+    }
+
+    // Case 2 - Allocate one more block, expect a new slab to be allocated.
+    {
+        blocks[slabSize] = pool.allocate();
+        ASSERT_NE(blocks[slabSize], nullptr);
+        EXPECT_EQ(pool.slabCount(), 2U);
+        EXPECT_EQ(pool.freeCount(), slabSize - 1U);
+    }
+
+    // Case 3 - Return a block and allocate again, expect the same block to be reused.
+    {
+        pool.deallocate(blocks[1U]);
+        EXPECT_EQ(pool.freeCount(), slabSize);
+        EXPECT_EQ(pool.allocate(), blocks[1U]);
+        EXPECT_EQ(pool.slabCount(), 2U);
+        EXPECT_EQ(*blocks[0U], 0U);
+        EXPECT_EQ(*blocks[2U], 2U);
+    }
+
+    // Case 4 - Return all blocks, expect the slabs to be kept for reuse.
+    {
+        for (std::size_t i{}; i <= slabSize; ++i) { pool.deallocate(blocks[i]); }
+        EXPECT_EQ(pool.freeCount(), 2U * slabSize);
+        EXPECT_EQ(pool.slabCount(), 2U);
+    }
+}
+
+/**
+ * @brief Pool reservation test.
+ *
+ *        Verify that reserved blocks can be allocated without allocating new slabs.
+ */
+TEST(Memory_Pool, Reserve)
+{
+    Pool<double, 8U> pool{};
+
+    // Case 1 - Reserve blocks, expect whole slabs to be allocated.
+    {
+        EXPECT_TRUE(pool.reserve(10U));
+        EXPECT_EQ(pool.slabCount(), 2U);
+        EXPECT_EQ(pool.freeCount(), 16U);
+    }
+
+    // Case 2 - Allocate the reserved blocks, expect no new slabs.
+    {
+        for (std::size_t i{}; i < 16U; ++i) { EXPECT_NE(pool.allocate(), nullptr); }
+        EXPECT_EQ(pool.slabCount(), 2U);
+        EXPECT_EQ(pool.freeCount(), 0U);
+    }
+
+    // Case 3 - Move the pool, expect the slabs to be taken over.
+    {
+        Pool<double, 8U> other{static_cast<Pool<double, 8U>&&>(pool)};
+        EXPECT_EQ(other.slabCount(), 2U);
+        EXPECT_EQ(pool.slabCount(), 0U);
+        EXPECT_EQ(pool.freeCount(), 0U);
+    }
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
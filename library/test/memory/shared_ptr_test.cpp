@@ -0,0 +1,210 @@
+/**
+ * @brief Unit tests for the shared pointer.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/allocator.h"
+#include "memory/shared_ptr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Object counting its live instances.
+ */
+struct Tracked
+{
+    /** The number of live instances. */
+    static int instanceCount;
+
+    /** Value held by the object. */
+    int value;
+
+    /**
+     * @brief Create object holding given value.
+     *
+     * @param[in] value The value to hold.
+     */
+    explicit Tracked(const int value) noexcept
+        : value{value}
+    {
+        instanceCount++;
+    }
+
+    /**
+     * @brief Delete object.
+     */
+    ~Tracked() noexcept { instanceCount--; }
+};
+
+int Tracked::instanceCount{};
+
+/**
+ * @brief Get the number of allocations made via memory::allocator so far.
+ *
+ * @return The total number of allocations.
+ */
+std::uint32_t allocationCount() noexcept { return allocator::stats().allocationCount; }
+
+/**
+ * @brief Shared ownership test.
+ *
+ *        Verify that the object is shared between copies and destroyed with the last owner.
+ */
+TEST(Memory_SharedPtr, Ownership)
+{
+    // Case 1 - Verify that makeShared() only allocates a single block.
+    {
+        const auto allocations{allocationCount()};
+        auto ptr{makeShared<Tracked>(42)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(allocationCount() - allocations, 1U);
+        EXPECT_EQ(ptr->value, 42);
+        EXPECT_EQ(ptr.useCount(), 1U);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+    }
+    EXPECT_EQ(Tracked::instanceCount, 0);
+
+    // Case 2 - Verify that copies share ownership and that moves transfer it.
+    {
+        auto ptr{makeShared<Tracked>(1)};
+        SharedPtr<Tracked> copy{ptr};
+        EXPECT_EQ(copy.get(), ptr.get());
+        EXPECT_EQ(ptr.useCount(), 2U);
+
+        SharedPtr<Tracked> moved{static_cast<SharedPtr<Tracked>&&>(copy)};
+        EXPECT_FALSE(copy);
+        EXPECT_EQ(copy.useCount(), 0U);
+        EXPECT_EQ(moved.useCount(), 2U);
+
+        EXPECT_EQ(ptr.release(), moved.get());
+        EXPECT_EQ(moved.useCount(), 1U);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+        EXPECT_EQ(moved.release(), nullptr);
+        EXPECT_EQ(Tracked::instanceCount, 0);
+    }
+
+    // Case 3 - Verify that ownership of raw pointers needs a separate control block.
+    {
+        const auto allocations{allocationCount()};
+        SharedPtr<Tracked> ptr{utils::newObject<Tracked>(2)};
+        EXPECT_EQ(allocationCount() - allocations, 2U);
+        EXPECT_EQ((*ptr).value, 2);
+
+        ptr = makeShared<Tracked>(3);
+        EXPECT_EQ(ptr->value, 3);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+        ptr.reset();
+        EXPECT_FALSE(ptr);
+        EXPECT_EQ(Tracked::instanceCount, 0);
+    }
+
+    // Case 4 - Verify that fields can be shared.
+    {
+        auto field{makeShared<std::uint8_t, 16U>()};
+        ASSERT_TRUE(field);
+        field.get()[15U] = 0xFFU;
+        auto copy{field};
+        EXPECT_EQ(copy.get()[15U], 0xFFU);
+    }
+}
+
+/**
+ * @brief Pool-backed shared pointer test.
+ *
+ *        Verify that objects allocated from a pool are returned to it on destruction.
+ */
+TEST(Memory_SharedPtr, Pool)
+{
+    SharedPool<Tracked, 4U> pool{};
+    ASSERT_TRUE(pool.reserve(4U));
+
+    {
+        const auto allocations{allocationCount()};
+        auto first{allocateShared<Tracked>(pool, 1)};
+        auto second{allocateShared<Tracked>(pool, 2)};
+        EXPECT_EQ(allocationCount(), allocations);
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(first->value + second->value, 3);
+
+        auto copy{second};
+        second.reset();
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(copy->value, 2);
+    }
+    EXPECT_EQ(pool.freeCount(), 4U);
+    EXPECT_EQ(Tracked::instanceCount, 0);
+}
+
+/**
+ * @brief Count the allocations made to create, copy and destroy shared objects.
+ *
+ * @tparam Factory The factory type.
+ *
+ * @param[in] factory Factory creating a shared pointer holding the given value.
+ *
+ * @return The number of allocations made via memory::allocator.
+ */
+template <typename Factory>
+std::uint32_t countSharedAllocations(Factory factory)
+{
+    constexpr int objectCount{100};
+    constexpr int copyCount{4};
+    const auto before{allocator::stats()};
+
+    for (int i{}; i < objectCount; ++i)
+    {
+        SharedPtr<Tracked> ptr{factory(i)};
+        EXPECT_EQ(ptr->value, i);
+
+        // Expect copies to only share the object, never to allocate.
+        const auto created{allocationCount()};
+        for (int j{}; j < copyCount; ++j)
+        {
+            SharedPtr<Tracked> copy{ptr};
+            EXPECT_EQ(copy->value, i);
+        }
+        EXPECT_EQ(allocationCount(), created);
+    }
+    // Expect every allocation to be released with the last owner.
+    const auto after{allocator::stats()};
+    EXPECT_EQ(after.allocationCount - before.allocationCount,
+              after.deallocationCount - before.deallocationCount);
+    return (after.allocationCount - before.allocationCount) / objectCount;
+}
+
+/**
+ * @brief Shared pointer allocation count.
+ *
+ *        Count the allocations per shared object with a separate control block and with a
+ *        control block fused with the object, allocated via the allocator and from a pool.
+ *        Expect two allocations for separate control blocks, a single one when fused and
+ *        none from a pool with reserved blocks.
+ */
+TEST(Memory_SharedPtr, AllocationCount)
+{
+    SharedPool<Tracked> pool{};
+    EXPECT_TRUE(pool.reserve(1U));
+
+    EXPECT_EQ(countSharedAllocations(
+        [](const int value) { return SharedPtr<Tracked>{utils::newObject<Tracked>(value)}; }), 
+        2U);
+    EXPECT_EQ(countSharedAllocations(
+        [](const int value) { return makeShared<Tracked>(value); }), 
+        1U);
+    EXPECT_EQ(countSharedAllocations(
+        [&pool](const int value) { return allocateShared<Tracked>(pool, value); }), 
+        0U);
+    EXPECT_EQ(pool.slabCount(), 1U);
+    EXPECT_EQ(Tracked::instanceCount, 0);
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
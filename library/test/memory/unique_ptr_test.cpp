@@ -0,0 +1,192 @@
+/**
+ * @brief Unit tests for the unique pointer.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "memory/arena.h"
+#include "memory/block_pool.h"
+#include "memory/deleter.h"
+#include "memory/pool.h"
+#include "memory/unique_ptr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Object counting its live instances.
+ */
+struct Tracked
+{
+    /** The number of live instances. */
+    static int instanceCount;
+
+    /** Value held by the object. */
+    int value;
+
+    /**
+     * @brief Create object holding given value.
+     *
+     * @param[in] value The value to hold.
+     */
+    explicit Tracked(const int value) noexcept
+        : value{value}
+    {
+        instanceCount++;
+    }
+
+    /**
+     * @brief Delete object.
+     */
+    ~Tracked() noexcept { instanceCount--; }
+};
+
+int Tracked::instanceCount{};
+
+/** Statically allocated block pool, released via a stateless deleter. */
+StaticBlockPool<sizeof(Tracked), 2U> staticPool{};
+
+/**
+ * @brief Stateless deleter returning objects to the static block pool.
+ */
+struct StaticPoolDelete
+{
+    /**
+     * @brief Destroy the object and return its memory to the static block pool.
+     *
+     * @param[in] data Pointer to the object to delete.
+     */
+    void operator()(Tracked* data) const noexcept
+    {
+        utils::destroyAt(data);
+        staticPool.deallocate(data);
+    }
+};
+
+/**
+ * @brief Unique ownership test.
+ *
+ *        Verify that objects and fields allocated via the utils memory helpers are destroyed
+ *        with their owner, and that stateless deleters keep the pointer pointer-sized.
+ */
+TEST(Memory_UniquePtr, Ownership)
+{
+    static_assert(sizeof(UniquePtr<Tracked>) == sizeof(Tracked*), "Unexpected pointer size!");
+    static_assert(sizeof(UniquePtr<std::uint8_t[]>) == sizeof(std::uint8_t*),
+                  "Unexpected pointer size!");
+    static_assert(sizeof(UniquePtr<Tracked, StaticPoolDelete>) == sizeof(Tracked*),
+                  "Unexpected pointer size!");
+
+    // Case 1 - Verify that the object is destroyed with its owner.
+    {
+        auto ptr{makeUnique<Tracked>(42)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(ptr->value, 42);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+
+        UniquePtr<Tracked> moved{static_cast<UniquePtr<Tracked>&&>(ptr)};
+        EXPECT_FALSE(ptr);
+        EXPECT_EQ((*moved).value, 42);
+
+        moved = makeUnique<Tracked>(1);
+        EXPECT_EQ(moved->value, 1);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+    }
+    EXPECT_EQ(Tracked::instanceCount, 0);
+
+    // Case 2 - Verify that released objects are no longer owned.
+    {
+        auto ptr{makeUnique<Tracked>(2)};
+        auto data{ptr.release()};
+        EXPECT_FALSE(ptr);
+        EXPECT_EQ(Tracked::instanceCount, 1);
+        ptr.reset(data);
+        ptr.reset();
+        EXPECT_EQ(Tracked::instanceCount, 0);
+    }
+
+    // Case 3 - Verify that fields can be owned.
+    {
+        auto field{makeUnique<std::uint8_t, 16U>()};
+        ASSERT_TRUE(field);
+        field[15U] = 0xFFU;
+        EXPECT_EQ(field.get()[15U], 0xFFU);
+    }
+
+    // Case 4 - Verify that a custom stateless deleter returns the object to its pool.
+    {
+        UniquePtr<Tracked, StaticPoolDelete> ptr{
+            utils::constructAt(static_cast<Tracked*>(staticPool.allocate()), 3)};
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(staticPool.freeCount(), 1U);
+    }
+    EXPECT_EQ(staticPool.freeCount(), 2U);
+    EXPECT_EQ(Tracked::instanceCount, 0);
+}
+
+/**
+ * @brief Allocator-aware unique pointer test.
+ *
+ *        Verify that objects and buffers carved from pools and arenas are returned to their
+ *        source exactly once.
+ */
+TEST(Memory_UniquePtr, Allocators)
+{
+    // Case 1 - Verify that objects allocated from a pool are returned to it.
+    {
+        Pool<Tracked, 2U> pool{};
+        {
+            auto first{allocateUnique(pool, 1)};
+            auto second{allocateUnique(pool, 2)};
+            EXPECT_EQ(first->value + second->value, 3);
+            EXPECT_EQ(pool.freeCount(), 0U);
+
+            first = static_cast<decltype(second)&&>(second);
+            EXPECT_EQ(pool.freeCount(), 1U);
+            EXPECT_EQ(Tracked::instanceCount, 1);
+        }
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(Tracked::instanceCount, 0);
+    }
+
+    // Case 2 - Verify that objects and buffers are returned to their block pool.
+    {
+        StaticBlockPool<16U, 2U> pool{};
+        {
+            auto object{allocateUnique<Tracked>(pool, 4)};
+            auto buffer{allocateBuffer<std::uint8_t>(pool)};
+            ASSERT_TRUE(object);
+            ASSERT_TRUE(buffer);
+            buffer[pool.blockSize() - 1U] = 0xAAU;
+            EXPECT_EQ(pool.freeCount(), 0U);
+
+            // Expect allocations to fail when the pool is exhausted or the blocks are too small.
+            EXPECT_FALSE(allocateBuffer<std::uint8_t>(pool));
+            struct Large { std::uint8_t data[32U]; };
+            EXPECT_FALSE(allocateUnique<Large>(pool));
+        }
+        EXPECT_EQ(pool.freeCount(), 2U);
+        EXPECT_EQ(Tracked::instanceCount, 0);
+    }
+
+    // Case 3 - Verify that objects placed in an arena are destroyed, but not deallocated.
+    {
+        StaticArena<64U> arena{};
+        {
+            UniquePtr<Tracked, DestroyOnly<Tracked>> ptr{utils::constructAt(
+                static_cast<Tracked*>(arena.allocate(sizeof(Tracked))), 5)};
+            EXPECT_EQ(ptr->value, 5);
+        }
+        EXPECT_EQ(Tracked::instanceCount, 0);
+        EXPECT_EQ(arena.used(), Arena::alignedSize(sizeof(Tracked)));
+    }
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
@@ -0,0 +1,170 @@
+/**
+ * @brief Unit tests for the weak pointer.
+ */
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "memory/allocator.h"
+#include "memory/ref_count.h"
+#include "memory/shared_ptr.h"
+#include "memory/weak_ptr.h"
+
+#ifdef TESTSUITE
+
+namespace memory
+{
+namespace
+{
+/**
+ * @brief Object counting its live instances.
+ */
+struct Tracked
+{
+    /** The number of live instances. */
+    static int instanceCount;
+
+    /** Value held by the object. */
+    int value;
+
+    /**
+     * @brief Create object holding given value.
+     *
+     * @param[in] value The value to hold.
+     */
+    explicit Tracked(const int value) noexcept
+        : value{value}
+    {
+        instanceCount++;
+    }
+
+    /**
+     * @brief Delete object.
+     */
+    ~Tracked() noexcept { instanceCount--; }
+};
+
+int Tracked::instanceCount{};
+
+/**
+ * @brief Get the number of memory blocks currently allocated via memory::allocator.
+ *
+ * @return The number of allocated blocks.
+ */
+std::size_t blockCount() noexcept { return allocator::stats().blockCount; }
+
+/**
+ * @brief Weak reference test.
+ *
+ *        Verify that weak pointers can be locked while the object is owned, and that the
+ *        memory is kept until the last weak pointer is released.
+ */
+TEST(Memory_WeakPtr, Lock)
+{
+    const auto blocks{blockCount()};
+
+    // Case 1 - Verify that empty weak pointers are expired.
+    {
+        WeakPtr<Tracked> weak{};
+        EXPECT_TRUE(weak.expired());
+        EXPECT_FALSE(weak.lock());
+    }
+
+    // Case 2 - Verify that a weak pointer doesn't own the object, but can gain ownership.
+    {
+        auto shared{makeShared<Tracked>(42)};
+        WeakPtr<Tracked> weak{shared};
+        EXPECT_EQ(weak.useCount(), 1U);
+        EXPECT_FALSE(weak.expired());
+
+        auto locked{weak.lock()};
+        ASSERT_TRUE(locked);
+        EXPECT_EQ(locked->value, 42);
+        EXPECT_EQ(shared.useCount(), 2U);
+    }
+    EXPECT_EQ(Tracked::instanceCount, 0);
+    EXPECT_EQ(blockCount(), blocks);
+
+    // Case 3 - Verify that the object is destroyed with the last owner, but the memory of the
+    //          control block is kept until the last weak pointer is released.
+    {
+        auto shared{makeShared<Tracked>(1)};
+        WeakPtr<Tracked> weak{shared};
+        WeakPtr<Tracked> copy{weak};
+        shared.reset();
+        EXPECT_EQ(Tracked::instanceCount, 0);
+        EXPECT_TRUE(weak.expired());
+        EXPECT_FALSE(copy.lock());
+        EXPECT_EQ(blockCount(), blocks + 1U);
+
+        weak.reset();
+        EXPECT_EQ(blockCount(), blocks + 1U);
+        copy = WeakPtr<Tracked>{};
+        EXPECT_EQ(blockCount(), blocks);
+    }
+
+    // Case 4 - Verify that weak pointers work for pool-backed and separately owned objects.
+    {
+        SharedPool<Tracked, 2U> pool{};
+        WeakPtr<Tracked> pooled{};
+        WeakPtr<Tracked> separate{};
+        {
+            auto first{allocateShared<Tracked>(pool, 1)};
+            SharedPtr<Tracked> second{utils::newObject<Tracked>(2)};
+            pooled   = first;
+            separate = second;
+            EXPECT_EQ(pooled.lock()->value + separate.lock()->value, 3);
+        }
+        EXPECT_EQ(Tracked::instanceCount, 0);
+        EXPECT_EQ(pool.freeCount(), 1U);
+        pooled.reset();
+        EXPECT_EQ(pool.freeCount(), 2U);
+    }
+    EXPECT_EQ(blockCount(), blocks);
+}
+
+/**
+ * @brief Atomic reference count test.
+ *
+ *        Verify that pointers using the atomic policy can be copied, locked and released from
+ *        several threads concurrently without losing references.
+ */
+TEST(Memory_WeakPtr, AtomicCount)
+{
+    constexpr int threadCount{4};
+    constexpr int iterationCount{100000};
+
+    auto shared{makeShared<Tracked, AtomicCount>(7)};
+    WeakPtr<Tracked, AtomicCount> weak{shared};
+    long long sums[threadCount]{};
+
+    // Copy and lock the pointer in each thread, accumulate the result to keep gtest out of
+    // the hot loop.
+    std::thread threads[threadCount]{};
+    for (int i{}; i < threadCount; ++i)
+    {
+        threads[i] = std::thread{[&shared, &weak, &sums, i]()
+        {
+            for (int j{}; j < iterationCount; ++j)
+            {
+                SharedPtr<Tracked, AtomicCount> copy{shared};
+                WeakPtr<Tracked, AtomicCount> weakCopy{weak};
+                auto locked{weakCopy.lock()};
+                sums[i] += copy->value + locked->value;
+            }
+        }};
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    for (const auto sum : sums) { EXPECT_EQ(sum, 14LL * iterationCount); }
+    EXPECT_EQ(shared.useCount(), 1U);
+
+    shared.reset();
+    EXPECT_EQ(Tracked::instanceCount, 0);
+    EXPECT_TRUE(weak.expired());
+}
+} // namespace
+} // namespace memory
+
+#endif /** TESTSUITE */
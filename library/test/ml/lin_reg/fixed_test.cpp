@@ -3,6 +3,7 @@
  */
 #include <gtest/gtest.h>
 
+#include "container/static_vector.h"
 #include "ml/lin_reg/fixed.h"
 #include "ml/types.h"
 
@@ -50,6 +51,42 @@ TEST(LinRegFixed, HappyPath)
     }
 }
 
+/**
+ * @brief Linear regression training with static data.
+ * 
+ *        Verify that the model can be trained with data stored in static vectors.
+ */
+TEST(LinRegFixed, StaticData)
+{
+    // Create training data at compile time, no memory is allocated.
+    constexpr container::StaticVector<double, 8U> trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    constexpr container::StaticVector<double, 8U> trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+    constexpr std::size_t epochCount{100U};
+    constexpr double learningRate{0.01};
+
+    // Case 1 - Verify that training fails without training sets.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_FALSE(linReg.train(trainIn.data(), trainOut.data(), 0U, epochCount, learningRate));
+        EXPECT_FALSE(linReg.train(nullptr, trainOut.data(), trainOut.size(), epochCount));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+
+    // Case 2 - Verify that the model predicts as intended once trained.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_TRUE(linReg.train(trainIn.data(), trainOut.data(), trainIn.size(), 
+                                 epochCount, learningRate));
+        EXPECT_TRUE(linReg.isTrained());
+
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            constexpr double precision{1e-6};
+            EXPECT_NEAR(trainOut[i], linReg.predict(trainIn[i]), precision);
+        }
+    }
+}
+
 /**
  * @brief Linear regression training with invalid sets.
  * 
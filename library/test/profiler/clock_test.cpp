@@ -0,0 +1,85 @@
+/**
+ * @brief Unit tests for the profiler clock.
+ */
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/timer/circuit.h"
+#include "profiler/clock.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace profiler
+{
+namespace clock
+{
+namespace
+{
+/**
+ * @brief Profiler clock control test.
+ *
+ *        Verify that timer 1 is reserved and run free at the CPU clock while the clock is 
+ *        running.
+ */
+TEST(Profiler_Clock, Control)
+{
+    // Case 1 - Verify that timer 1 is reserved while the clock is running.
+    {
+        EXPECT_FALSE(isRunning());
+        EXPECT_TRUE(start());
+        EXPECT_TRUE(start());
+        EXPECT_TRUE(isRunning());
+        EXPECT_TRUE(driver::timer::isCircuitReserved(driver::timer::Circuit::Timer1));
+        EXPECT_EQ(TCCR1B, 1U << CS10);
+        EXPECT_EQ(TIMSK1, 1U << TOIE1);
+
+        stop();
+        EXPECT_FALSE(isRunning());
+        EXPECT_FALSE(driver::timer::isCircuitReserved(driver::timer::Circuit::Timer1));
+        EXPECT_EQ(TCCR1B, 0U);
+        EXPECT_EQ(TIMSK1, 0U);
+    }
+
+    // Case 2 - Verify that the clock can't start while timer 1 is in use.
+    {
+        ASSERT_TRUE(driver::timer::reserveCircuit(driver::timer::Circuit::Timer1));
+        EXPECT_FALSE(start());
+        EXPECT_FALSE(isRunning());
+        driver::timer::releaseCircuit(driver::timer::Circuit::Timer1);
+    }
+}
+
+/**
+ * @brief Profiler clock cycle count test.
+ *
+ *        Verify that the CPU time of the host is converted to CPU cycles at 16 MHz, and that
+ *        time spent preempted or sleeping isn't counted.
+ */
+TEST(Profiler_Clock, Cycles)
+{
+    // Case 1 - Expect a 2 ms delay loop to take at least 32000 cycles.
+    {
+        const std::uint32_t start{cycles()};
+        utils::delay_ms(2U);
+        const std::uint32_t elapsed{cycles() - start};
+        EXPECT_GE(elapsed, 32000U);
+        EXPECT_LE(elapsed, 16000000U);
+    }
+
+    // Case 2 - Expect a 20 ms sleep to take far fewer cycles than the sleep duration.
+    {
+        const std::uint32_t start{cycles()};
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        EXPECT_LT(cycles() - start, 320000U / 2U);
+    }
+}
+} // namespace
+} // namespace clock
+} // namespace profiler
+
+#endif /** TESTSUITE */
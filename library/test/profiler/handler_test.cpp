@@ -0,0 +1,105 @@
+/**
+ * @brief Unit tests for the handler profiler.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "profiler/clock.h"
+#include "profiler/handler.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace profiler
+{
+namespace handler
+{
+namespace
+{
+/**
+ * @brief Handler profile test.
+ *
+ *        Verify that the call count, total, mean and worst-case execution time are
+ *        accumulated and compared against the budget.
+ */
+TEST(Profiler_Handler, Profile)
+{
+    Profile profile{"handler", 1000U};
+    EXPECT_STREQ(profile.name(), "handler");
+    EXPECT_EQ(profile.budget(), 1000U);
+    EXPECT_EQ(profile.mean(), 0U);
+    EXPECT_TRUE(profile.isWithinBudget());
+
+    // Case 1 - Verify that calls within the budget are accumulated.
+    {
+        profile.record(400U);
+        profile.record(1000U);
+        EXPECT_EQ(profile.count(), 2U);
+        EXPECT_EQ(profile.worst(), 1000U);
+        EXPECT_EQ(profile.total(), 1400U);
+        EXPECT_EQ(profile.mean(), 700U);
+        EXPECT_TRUE(profile.isWithinBudget());
+    }
+
+    // Case 2 - Verify that a single call over budget is detected.
+    {
+        profile.record(1001U);
+        EXPECT_FALSE(profile.isWithinBudget());
+    }
+
+    // Case 3 - Verify that the total doesn't overflow 32 bits.
+    {
+        profile.record(0xFFFFFFFFUL);
+        profile.record(0xFFFFFFFFUL);
+        EXPECT_EQ(profile.total(), 2401ULL + 2ULL * 0xFFFFFFFFULL);
+        EXPECT_EQ(profile.count(), 5U);
+    }
+
+    // Case 4 - Verify that the profile is cleared on reset.
+    {
+        profile.reset();
+        EXPECT_EQ(profile.count(), 0U);
+        EXPECT_EQ(profile.worst(), 0U);
+        EXPECT_EQ(profile.total(), 0U);
+        EXPECT_TRUE(profile.isWithinBudget());
+    }
+}
+
+/**
+ * @brief Scoped handler measurement test.
+ *
+ *        Verify that the execution time of a scope is measured in CPU cycles, and only while 
+ *        the profiler clock is running.
+ */
+TEST(Profiler_Handler, Scope)
+{
+    Profile profile{"handler", 16000U};
+
+    // Case 1 - Verify that calls aren't recorded while the clock is stopped.
+    {
+        ASSERT_FALSE(clock::isRunning());
+        { HANDLER_PROFILE(profile); }
+        EXPECT_EQ(profile.count(), 0U);
+    }
+
+    // Case 2 - Verify that a 2 ms call is measured as at least 32000 cycles, i.e. over budget.
+    {
+        ASSERT_TRUE(clock::start());
+        { HANDLER_PROFILE(profile); }
+        EXPECT_TRUE(profile.isWithinBudget());
+        {
+            HANDLER_PROFILE(profile);
+            utils::delay_ms(2U);
+        }
+        clock::stop();
+        EXPECT_EQ(profile.count(), 2U);
+        EXPECT_GE(profile.worst(), 32000U);
+        EXPECT_FALSE(profile.isWithinBudget());
+    }
+}
+} // namespace
+} // namespace handler
+} // namespace profiler
+
+#endif /** TESTSUITE */
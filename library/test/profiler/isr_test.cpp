@@ -0,0 +1,148 @@
+/**
+ * @brief Unit tests for the ISR profiler.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "profiler/clock.h"
+#include "profiler/isr.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace timer
+{
+/** Timer 0 overflow interrupt handler, see the timer driver. */
+void TIMER0_OVF_vect() noexcept;
+} // namespace timer
+} // namespace driver
+
+namespace profiler
+{
+namespace isr
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::uint32_t bucketSum(const Stats& stats) noexcept
+{
+    std::uint32_t sum{};
+    for (const auto count : stats.buckets) { sum += count; }
+    return sum;
+}
+
+/**
+ * @brief ISR profiler control test.
+ *
+ *        Verify that calls are only recorded while the profiler clock is running.
+ */
+TEST(Profiler_Isr, Control)
+{
+    static_assert(Enabled, "The test suite must be built with ISR_PROFILING defined!");
+    static_assert(32U == bucketLimit(0U), "Unexpected bucket limit!");
+    static_assert(2048U == bucketLimit(BucketCount - 2U), "Unexpected bucket limit!");
+    reset();
+
+    // Case 1 - Verify that calls aren't recorded while the clock is stopped.
+    {
+        EXPECT_FALSE(clock::isRunning());
+        { Scope scope{Vector::PinChangeB}; }
+        EXPECT_EQ(stats(Vector::PinChangeB).count, 0U);
+    }
+
+    // Case 2 - Verify that calls are recorded while the clock is running.
+    {
+        ASSERT_TRUE(clock::start());
+        { Scope scope{Vector::PinChangeB}; }
+        clock::stop();
+        EXPECT_EQ(stats(Vector::PinChangeB).count, 1U);
+    }
+
+    // Case 3 - Verify that invalid vectors are handled.
+    {
+        EXPECT_STREQ(name(Vector::Timer0), "TIMER0_OVF");
+        EXPECT_STREQ(name(Vector::Count), "unknown");
+        EXPECT_EQ(stats(Vector::Count).count, 0U);
+    }
+}
+
+/**
+ * @brief ISR profiler statistics test.
+ *
+ *        Verify that durations measured on the host are converted to CPU cycles and
+ *        accumulated into min, max, mean and histogram.
+ */
+TEST(Profiler_Isr, Statistics)
+{
+    reset();
+    ASSERT_TRUE(clock::start());
+
+    // Case 1 - Verify that a 50 us call is measured as at least 800 cycles at 16 MHz.
+    {
+        {
+            Scope scope{Vector::PinChangeC};
+            utils::delay_us(50U);
+        }
+        const auto result{stats(Vector::PinChangeC)};
+        EXPECT_EQ(result.count, 1U);
+        EXPECT_GE(result.min, 800U);
+        EXPECT_EQ(result.min, result.max);
+        EXPECT_EQ(result.mean(), result.max);
+        EXPECT_EQ(result.maxLatency, 0U);
+        EXPECT_EQ(bucketSum(result), 1U);
+        EXPECT_EQ(result.buckets[0U], 0U);
+    }
+
+    // Case 2 - Verify min, max and mean over calls with given durations.
+    {
+        record(Vector::PinChangeD, static_cast<std::uint16_t>(clock::timestamp() - 800U), 0U);
+        record(Vector::PinChangeD, static_cast<std::uint16_t>(clock::timestamp() - 3000U), 0U);
+        const auto result{stats(Vector::PinChangeD)};
+        EXPECT_EQ(result.count, 2U);
+        EXPECT_NEAR(result.min, 800U, 200U);
+        EXPECT_NEAR(result.max, 3000U, 200U);
+        EXPECT_NEAR(result.mean(), 1900U, 200U);
+        EXPECT_EQ(result.buckets[5U], 1U);
+        EXPECT_EQ(result.buckets[BucketCount - 1U], 1U);
+    }
+
+    // Case 3 - Verify that the mean is preserved when the sum is about to overflow.
+    {
+        for (std::uint32_t i{}; i < 70000U; ++i)
+        {
+            record(Vector::Timer2, static_cast<std::uint16_t>(clock::timestamp() - 65000U), 0U);
+        }
+        const auto result{stats(Vector::Timer2)};
+        EXPECT_EQ(result.count, 70000U);
+        EXPECT_LT(result.sampleCount, result.count);
+        EXPECT_NEAR(result.mean(), 65000U, 500U);
+        EXPECT_EQ(result.buckets[BucketCount - 1U], 0xFFFFU);
+    }
+
+    // Case 4 - Verify that the timer interrupt latency is read from the timer counter.
+    {
+        TCNT0 = 10U;
+        driver::timer::TIMER0_OVF_vect();
+        TCNT0 = 0U;
+        const auto result{stats(Vector::Timer0)};
+        EXPECT_EQ(result.count, 1U);
+        EXPECT_EQ(result.maxLatency, 80U);
+    }
+
+    // Case 5 - Verify that the statistics are kept when stopped, and cleared on reset.
+    {
+        clock::stop();
+        EXPECT_EQ(stats(Vector::Timer0).count, 1U);
+        reset();
+        EXPECT_EQ(stats(Vector::Timer0).count, 0U);
+    }
+}
+} // namespace
+} // namespace isr
+} // namespace profiler
+
+#endif /** TESTSUITE */
@@ -1,17 +1,43 @@
 /**
  * @brief Test suite for the libatmega library.
  */
+#include <cstdio>
 #include <iostream>
 
 #include <gtest/gtest.h>
 
+#include "memory/allocator.h"
+
+namespace
+{
+/**
+ * @brief Test environment reporting the allocation counters once all tests have run.
+ */
+class MemoryReport final : public testing::Environment
+{
+public:
+    /**
+     * @brief Print the allocation counters and check for leaked blocks.
+     */
+    void TearDown() override
+    {
+        const auto stats{memory::allocator::stats()};
+        std::printf("Allocator: %u allocations, %u deallocations, %zu failed, %zu bytes peak\n",
+                    stats.allocationCount, stats.deallocationCount, stats.failedCount,
+                    stats.highWaterMark);
+        EXPECT_EQ(stats.blockCount, 0U);
+    }
+};
+} // namespace
+
 /**
  * @brief Run test suite.
- * 
+ *
  * @return The number of failed tests.
  */
-int main(int argc, char **argv) 
+int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
+    testing::AddGlobalTestEnvironment(new MemoryReport{});
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -0,0 +1,145 @@
+/**
+ * @brief Unit tests for delegates and callback arrays.
+ */
+#include <gtest/gtest.h>
+
+#include "utils/callback_array.h"
+#include "utils/delegate.h"
+
+#ifdef TESTSUITE
+
+namespace utils
+{
+namespace
+{
+/** The number of calls made to the free function. */
+int functionCallCount{};
+
+// -----------------------------------------------------------------------------
+void countCall() noexcept { functionCallCount++; }
+
+// -----------------------------------------------------------------------------
+int twice(const int value) noexcept { return 2 * value; }
+
+/**
+ * @brief Counter, whose member functions are bound to delegates.
+ */
+struct Counter
+{
+    /** The counted value. */
+    int count;
+
+    /**
+     * @brief Increment the counter.
+     */
+    void increment() noexcept { count++; }
+
+    /**
+     * @brief Add given value to the counter.
+     *
+     * @param[in] value The value to add.
+     *
+     * @return The new count.
+     */
+    int add(const int value) noexcept { return count += value; }
+
+    /**
+     * @brief Get the count.
+     *
+     * @return The count.
+     */
+    int get() const noexcept { return count; }
+};
+
+/**
+ * @brief Delegate binding test.
+ *
+ *        Verify that free functions, member functions and callable objects can be bound and
+ *        invoked, and that delegates compare equal if bound to the same target.
+ */
+TEST(Utils_Delegate, Binding)
+{
+    static_assert(sizeof(Delegate<void()>) == 2U * sizeof(void*), "Unexpected delegate size!");
+
+    // Case 1 - Verify that empty delegates are unbound.
+    {
+        constexpr Delegate<void()> empty{};
+        constexpr Delegate<void()> null{nullptr};
+        EXPECT_FALSE(empty);
+        EXPECT_FALSE(null);
+        EXPECT_EQ(empty, null);
+    }
+
+    // Case 2 - Verify that free functions can be bound at runtime and at compile time.
+    {
+        functionCallCount = 0;
+        Delegate<void()> runtime{countCall};
+        constexpr auto compileTime{Delegate<void()>::bind<countCall>()};
+        runtime();
+        compileTime();
+        EXPECT_EQ(functionCallCount, 2);
+        EXPECT_EQ(runtime, Delegate<void()>{countCall});
+        EXPECT_NE(runtime, compileTime);
+        EXPECT_EQ(Delegate<int(int)>::bind<twice>()(21), 42);
+    }
+
+    // Case 3 - Verify that member functions are called on the bound object.
+    {
+        Counter first{0};
+        Counter second{10};
+        const auto increment{Delegate<void()>::bind<&Counter::increment>(first)};
+        const auto add{Delegate<int(int)>::bind<&Counter::add>(second)};
+        const auto get{Delegate<int()>::bind<&Counter::get>(static_cast<const Counter&>(first))};
+
+        increment();
+        increment();
+        EXPECT_EQ(first.count, 2);
+        EXPECT_EQ(add(5), 15);
+        EXPECT_EQ(get(), 2);
+        EXPECT_EQ(increment, Delegate<void()>::bind<&Counter::increment>(first));
+        EXPECT_NE(increment, Delegate<void()>::bind<&Counter::increment>(second));
+    }
+
+    // Case 4 - Verify that callable objects with captures can be bound.
+    {
+        int sum{};
+        auto accumulate{[&sum](const int value) { sum += value; }};
+        const auto delegate{Delegate<void(int)>::bind(accumulate)};
+        delegate(3);
+        delegate(4);
+        EXPECT_EQ(sum, 7);
+    }
+}
+
+/**
+ * @brief Callback array test.
+ *
+ *        Verify that plain functions and bound member functions can be stored and invoked.
+ */
+TEST(Utils_Delegate, CallbackArray)
+{
+    container::CallbackArray<2U> callbacks{};
+    Counter counter{0};
+    const auto increment{Delegate<void()>::bind<&Counter::increment>(counter)};
+    functionCallCount = 0;
+
+    EXPECT_TRUE(callbacks.add(countCall, 0U));
+    EXPECT_TRUE(callbacks.add(increment, 1U));
+    EXPECT_FALSE(callbacks.add(increment, 2U));
+    EXPECT_FALSE(callbacks.add(Delegate<void()>{}, 0U));
+
+    EXPECT_TRUE(callbacks.invoke(0U));
+    EXPECT_TRUE(callbacks.invoke(1U));
+    EXPECT_TRUE(callbacks.invoke(1U));
+    EXPECT_EQ(functionCallCount, 1);
+    EXPECT_EQ(counter.count, 2);
+
+    EXPECT_TRUE(callbacks.remove(increment, 1U));
+    EXPECT_FALSE(callbacks.invoke(1U));
+    EXPECT_TRUE(callbacks.remove(0U));
+    EXPECT_FALSE(callbacks.invoke(0U));
+}
+} // namespace
+} // namespace utils
+
+#endif /** TESTSUITE */
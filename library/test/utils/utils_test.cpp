@@ -0,0 +1,69 @@
+/**
+ * @brief Unit tests for the miscellaneous utility functions.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace utils
+{
+namespace
+{
+/**
+ * @brief Build a register value at compile time via the bit operations.
+ *
+ * @return Register value with bits 0, 2 and 7 set.
+ */
+constexpr std::uint8_t buildRegister() noexcept
+{
+    std::uint8_t reg{};
+    set(reg, 0U, 1U, 2U, 7U);
+    clear(reg, 1U);
+    toggle(reg, 3U, 4U);
+    toggle(reg, 3U, 4U);
+    return reg;
+}
+
+// Verify that the bit operations can be evaluated at compile time.
+static_assert(buildRegister() == 0x85U, "Unexpected register value!");
+static_assert(read(buildRegister(), 7U), "Bit 7 not set!");
+static_assert(!read(buildRegister(), 1U, 3U), "Bits 1 and 3 set!");
+static_assert(read(std::uint32_t{1UL << 31U}, 31U), "Bit 31 not set!");
+
+// Verify that rounding can be evaluated at compile time.
+static_assert(round<std::int16_t>(2.5) == 3, "Invalid rounding of positive number!");
+static_assert(round<std::int16_t>(-2.5) == -3, "Invalid rounding of negative number!");
+static_assert(round<std::uint16_t>(16000000.0 / (16.0 * 9600.0) - 1.0) == 103U, "Invalid rounding!");
+
+// Verify that range checks can be evaluated at compile time.
+static_assert(inRange(5, 0, 10) && inRange(0, 0, 10) && inRange(10, 0, 10), "Invalid range!");
+static_assert(!inRange(-1, 0, 10) && !inRange(11, 0, 10), "Invalid range!");
+static_assert(inRange(0.5, 0.0, 1.0), "Invalid floating-point range!");
+
+/**
+ * @brief Bit operation test.
+ *
+ *        Verify that the bit operations still work on volatile registers.
+ */
+TEST(Utils, BitOperations)
+{
+    volatile std::uint16_t reg{};
+
+    set(reg, 0U, 15U);
+    EXPECT_EQ(reg, 0x8001U);
+    EXPECT_TRUE(read(reg, 15U));
+    EXPECT_TRUE(read(reg, 1U, 15U));
+
+    toggle(reg, 1U);
+    clear(reg, 0U, 15U);
+    EXPECT_EQ(reg, 0x0002U);
+    EXPECT_FALSE(read(reg, 0U, 15U));
+}
+} // namespace
+} // namespace utils
+
+#endif /** TESTSUITE */